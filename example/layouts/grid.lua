@@ -1,4 +1,7 @@
 hl.layout.register("grid", {
+    -- only looks at ctx, so a recalculation with the same targets and area can reuse the last result
+    cacheable = true,
+
     recalculate = function(ctx)
         local n = #ctx.targets
         if n == 0 then
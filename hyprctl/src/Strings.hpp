@@ -9,6 +9,8 @@ commands:
     activeworkspace     → Gets the active workspace and its properties
     animations          → Gets the current config'd info about animations
                           and beziers
+    animationstats      → Prints how many animated variables the last tick
+                          stepped, skipped or fast-forwarded
     binds               → Lists all registered binds
     clients             → Lists all windows with their properties
     configerrors        → Lists all current config parsing errors
@@ -20,6 +22,10 @@ commands:
     dispatch <dispatcher> [args] → Issue a dispatch to call a keybind
                           dispatcher with arguments
     eval <code>         → Issue a Lua string to execute
+    eventqueues         → Prints queue depth and drop counts of socket2
+                          clients
+    frametimes          → Prints per-monitor frame timing percentiles and
+                          missed frames
     getoption <option>  → Gets the config option status (values)
     globalshortcuts     → Lists all global shortcuts
     hyprpaper ...       → Issue a hyprpaper request
@@ -33,6 +39,10 @@ commands:
                           with ESCAPE
     layers              → Lists all the surface layers
     layouts             → Lists all layouts available (including plugin'd ones)
+    luaevents           → Prints call counts and time spent in lua for
+                          every hl.on() subscription
+    lualayouts          → Prints call counts and timings of lua layouts,
+                          and how often their result was reused
     monitors            → Lists active outputs with their properties,
                           'monitors all' lists active and inactive outputs
     notify ...          → Sends a notification using the built-in Hyprland
@@ -46,12 +56,18 @@ commands:
                           or issue a Lua string and print the result
     rollinglog          → Prints tail of the log. Also supports -f/--follow
                           option
+    rulecache           → Prints hit/miss counters of the window rule match
+                          caches
     setcursor <theme> <size> → Sets the cursor theme and reloads the cursor
                           manager
     seterror <color> <message...> → Sets the hyprctl error string. Color has
                           the same format as in colors in config. Will reset
                           when Hyprland's config is reloaded
     setprop ...         → Sets a window property
+    shadercache         → Prints the on-disk shader cache location and
+                          hit/miss and compile time counters
+    shmuploads          → Prints per client counters of shm buffer texture
+                          uploads: rects, bytes and time spent
     getprop ...         → Gets a window property
     splash              → Get the current splash
     status              → Get internal status information
@@ -61,9 +77,15 @@ commands:
                           and branch of build.
     workspacerules      → Lists all workspace rules
     workspaces          → Lists all workspaces with their properties
+    xwmstats            → Prints how often the X window manager waited on
+                          XWayland, and for how long
 
 flags:
     -j                  → Output in JSON
+    --binary (-b)       → Output in MessagePack (clients, workspaces and
+                          monitors only)
+    --fields <a,b,...>  → Only output these fields of clients, workspaces or
+                          monitors. Implies JSON unless -b is given
     -r                  → Refresh state after issuing command (e.g. for
                           updating variables)
     --batch             → Execute a batch of commands, separated by ';'
@@ -44,7 +44,8 @@ using namespace Hyprutils::Memory;
 #define str(a)  #a
 
 std::string instanceSignature;
-bool        quiet = false;
+bool        quiet  = false;
+bool        binary = false;
 
 struct SInstanceData {
     std::string id;
@@ -279,6 +280,8 @@ int request(std::string_view arg, int minArgs = 0, bool needRoll = false, bool i
     // lua interactive REPL: check for incomplete-line error
     if (isRepl && reply.starts_with("error: " xstr(LUA_ERRSYNTAX) " ") && reply.ends_with(LUA_EOFMARK))
         return 8;
+    else if (binary && !quiet)
+        writeAll(STDOUT_FILENO, reply); // msgpack, don't mangle it with a newline
     else
         log(reply);
 
@@ -409,6 +412,7 @@ int main(int argc, char** argv) {
     bool        json             = false;
     bool        needRoll         = false;
     std::string overrideInstance = "";
+    std::string fields           = "";
 
     for (std::size_t i = 0; i < ARGS.size(); ++i) {
         if (ARGS[i] == "--") {
@@ -421,6 +425,18 @@ int main(int argc, char** argv) {
             if (ARGS[i] == "-j" && !fullArgs.contains("j")) {
                 fullArgs += "j";
                 json = true;
+            } else if ((ARGS[i] == "-b" || ARGS[i] == "--binary") && !fullArgs.contains("b")) {
+                fullArgs += "b";
+                binary = true;
+            } else if (ARGS[i] == "--fields") {
+                ++i;
+
+                if (i >= ARGS.size()) {
+                    std::println("{}", USAGE);
+                    return 1;
+                }
+
+                fields = ARGS[i];
             } else if (ARGS[i] == "-r" && !fullArgs.contains("r")) {
                 fullArgs += "r";
             } else if (ARGS[i] == "-a" && !fullArgs.contains("a")) {
@@ -485,6 +501,9 @@ int main(int argc, char** argv) {
 
     fullRequest.pop_back(); // remove trailing space
 
+    if (!fields.empty())
+        fullRequest += std::format(" --fields={}", fields);
+
     fullRequest = std::format("{}/{}", fullArgs, fullRequest);
 
     // instances is HIS-independent
@@ -519,7 +519,7 @@ def generate_stub(root: Path) -> str:
     query_types, query_overrides = parse_query_filter_types(root)
 
     api_signatures: dict[str, str] = {
-        "hl.on": "fun(event: HL.EventName, cb: fun(...)): HL.EventSubscription",
+        "hl.on": "fun(event: HL.EventName, cb: fun(...), opts?: HL.EventOptions): HL.EventSubscription",
         "hl.bind": "fun(keys: string, dispatcher: HL.Dispatcher|function, opts?: HL.BindOptions): HL.Keybind",
         "hl.dispatch": "fun(dispatcher: HL.Dispatcher|function): any",
         "hl.define_submap": "fun(name: string, reset_or_fn: string|function, fn?: function): nil",
@@ -679,6 +679,16 @@ def generate_stub(root: Path) -> str:
     )
     lines.append("")
 
+    lines.extend(
+        emit_class_block(
+            "HL.EventOptions",
+            [
+                ("deferred", "boolean", True),
+            ],
+        )
+    )
+    lines.append("")
+
     lines.extend(
         emit_class_block(
             "HL.TimerOptions",
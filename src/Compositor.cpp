@@ -172,6 +172,13 @@ void CCompositor::restoreNofile() {
         Log::logger->log(Log::ERR, "Failed restoring NOFILE limits");
 }
 
+std::optional<rlimit> CCompositor::originalNofile() const {
+    if (m_originalNofile.rlim_max <= 0)
+        return std::nullopt;
+
+    return m_originalNofile;
+}
+
 bool CCompositor::supportsDrmSyncobjTimeline() const {
     return m_drm.syncobjSupport || m_drmRenderNode.syncObjSupport;
 }
@@ -64,6 +64,7 @@ class CCompositor {
     void                     cleanup();
     void                     bumpNofile();
     void                     restoreNofile();
+    std::optional<rlimit>    originalNofile() const; // the limit before bumpNofile(), for child processes
     bool                     setWatchdogFd(int fd);
     bool                     writeWatchdogFd(std::string);
 
@@ -123,31 +123,71 @@ static void preDamageWorkspace(PHLWORKSPACE pWorkspace, PHLMONITOR pMonitor) {
     }
 }
 
+// whether anything driven by this context can end up on screen right now
+static bool contextVisible(const SAnimationContext& ctx) {
+    if (const auto w = ctx.pWindow.lock()) {
+        const auto PMONITOR = w->m_monitor.lock();
+        if (PMONITOR && !PMONITOR->m_enabled)
+            return false;
+
+        const auto PWORKSPACE = w->m_workspace;
+        if (!PWORKSPACE || (w->m_state & Desktop::View::WINDOW_STATE_PINNED) || w->presentation().movingFromMonitor() ||
+            w->presentation().alpha(Desktop::View::WINDOW_ALPHA_MOVE_TO_WORKSPACE)->isBeingAnimated())
+            return true;
+
+        // same as the renderer: a hidden workspace is still drawn while it slides or fades out
+        return PWORKSPACE->isVisible() || PWORKSPACE->m_forceRendering || PWORKSPACE->m_renderOffset->isBeingAnimated() || PWORKSPACE->m_alpha->isBeingAnimated();
+    }
+
+    if (const auto ws = ctx.pWorkspace.lock()) {
+        const auto PMONITOR = ws->m_monitor.lock();
+        if (PMONITOR && !PMONITOR->m_enabled)
+            return false;
+
+        // a hidden workspace's slide and fade only show through its windows
+        return ws->isVisible() || ws->m_forceRendering || ws->getFirstWindow();
+    }
+
+    if (const auto ls = ctx.pLayer.lock()) {
+        const auto PMONITOR = ls->m_monitor.lock();
+        return ls->mapped() && PMONITOR && PMONITOR->m_enabled;
+    }
+
+    return true;
+}
+
+// returns whether the variable was stepped
 template <Animable VarType>
-static void handleUpdate(CAnimatedVariable<VarType>& av, bool warp) {
+static bool handleUpdate(CAnimatedVariable<VarType>& av, bool warp, bool asleep) {
     bool animationsDisabled = warp;
 
     if (auto w = av.m_Context.pWindow.lock()) {
         if (!w->m_monitor.lock())
-            return;
+            return false;
         animationsDisabled = w->m_ruleApplicator->noAnim().valueOr(animationsDisabled);
     } else if (auto ws = av.m_Context.pWorkspace.lock()) {
         if (!ws->m_monitor.lock())
-            return;
+            return false;
     } else if (auto ls = av.m_Context.pLayer.lock()) {
         if (!State::monitorState()->query().vec(ls->position(Desktop::View::IGeometric::GEOMETRIC_GOAL) + ls->size(Desktop::View::IGeometric::GEOMETRIC_GOAL) / 2.F).run())
-            return;
+            return false;
         animationsDisabled = animationsDisabled || ls->m_ruleApplicator->noanim().valueOrDefault();
     }
 
     const auto STEP = av.getCurveStep();
 
+    // curves are time based, so an off screen variable can sit still until it becomes visible
+    // and pick up where it should be by then. Once it's done, jump to the goal so it retires.
+    if (asleep && !STEP.finished)
+        return false;
+
     if constexpr (std::same_as<VarType, CHyprColor>)
         updateColorVariable(av, STEP.value, STEP.finished || animationsDisabled);
     else
         updateVariable<VarType>(av, STEP.value, STEP.finished || animationsDisabled);
 
     av.onUpdate();
+    return true;
 }
 
 void CHyprAnimationManager::tick() {
@@ -158,6 +198,7 @@ void CHyprAnimationManager::tick() {
     static auto PANIMENABLED = CConfigValue<Config::INTEGER>("animations:enabled");
 
     if (m_vActiveAnimatedVariables.empty()) {
+        m_lastTickStats = {};
         tickDone();
         return;
     }
@@ -180,12 +221,21 @@ void CHyprAnimationManager::tick() {
     std::vector<SDamageOwner> owners;
     owners.reserve(4);
 
+    // variables whose owner is off screen are neither stepped nor damaged
+    std::vector<uint8_t> asleep(CPY.size(), false);
+
     // Collect per-owner damage policies
-    for (const auto& PAV : CPY) {
+    for (size_t i = 0; i < CPY.size(); ++i) {
+        const auto& PAV = CPY[i];
         if (!PAV)
             continue;
 
-        const auto&   ctx = getContext(PAV.get());
+        const auto& ctx = getContext(PAV.get());
+
+        if (*PANIMENABLED && PAV->enabled() && !contextVisible(ctx)) {
+            asleep[i] = true;
+            continue;
+        }
 
         SDamageOwner* owner = nullptr;
 
@@ -258,6 +308,12 @@ void CHyprAnimationManager::tick() {
         owner.trackWindowMotion = true;
     }
 
+    // damage from everything below, including update callbacks, reaches each monitor as one region
+    const std::vector<PHLMONITOR> MONITORS = State::monitorState()->monitors();
+    for (const auto& m : MONITORS) {
+        m->beginDamageBatch();
+    }
+
     // pre-damage each owner once (old state)
     for (const auto& owner : owners) {
         if (owner.window)
@@ -271,33 +327,46 @@ void CHyprAnimationManager::tick() {
         }
     }
 
+    STickStats stats;
+
     // update all variable values
-    for (const auto& PAV : CPY) {
+    for (size_t i = 0; i < CPY.size(); ++i) {
+        const auto& PAV = CPY[i];
         if (!PAV)
             continue;
 
-        bool warp = !*PANIMENABLED || !PAV->enabled();
+        bool warp    = !*PANIMENABLED || !PAV->enabled();
+        bool stepped = false;
 
         switch (PAV->m_Type) {
             case AVARTYPE_FLOAT: {
                 auto pTypedAV = dc<CAnimatedVariable<float>*>(PAV.get());
                 RASSERT(pTypedAV, "Failed to upcast animated float");
-                handleUpdate(*pTypedAV, warp);
+                stepped = handleUpdate(*pTypedAV, warp, asleep[i]);
             } break;
             case AVARTYPE_VECTOR: {
                 auto pTypedAV = dc<CAnimatedVariable<Vector2D>*>(PAV.get());
                 RASSERT(pTypedAV, "Failed to upcast animated Vector2D");
-                handleUpdate(*pTypedAV, warp);
+                stepped = handleUpdate(*pTypedAV, warp, asleep[i]);
             } break;
             case AVARTYPE_COLOR: {
                 auto pTypedAV = dc<CAnimatedVariable<CHyprColor>*>(PAV.get());
                 RASSERT(pTypedAV, "Failed to upcast animated CHyprColor");
-                handleUpdate(*pTypedAV, warp);
+                stepped = handleUpdate(*pTypedAV, warp, asleep[i]);
             } break;
             default: UNREACHABLE();
         }
+
+        if (!stepped)
+            stats.skipped++;
+        else if (asleep[i])
+            stats.fastForwarded++;
+        else
+            stats.active++;
     }
 
+    m_lastTickStats = stats;
+
     for (const auto& owner : owners) {
         if (!owner.window || !owner.trackWindowMotion)
             continue;
@@ -333,6 +402,10 @@ void CHyprAnimationManager::tick() {
             owner.monitor->scheduleFrame(Aquamarine::IOutput::AQ_SCHEDULE_ANIMATION);
     }
 
+    for (const auto& m : MONITORS) {
+        m->endDamageBatch();
+    }
+
     tickDone();
 }
 
@@ -384,6 +457,10 @@ void CHyprAnimationManager::onTicked() {
     m_tickScheduled = false;
 }
 
+const CHyprAnimationManager::STickStats& CHyprAnimationManager::lastTickStats() const {
+    return m_lastTickStats;
+}
+
 void CHyprAnimationManager::resetTickState() {
     m_lastTickValid = false;
     m_tickScheduled = false;
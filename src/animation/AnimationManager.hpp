@@ -59,15 +59,24 @@ namespace Animation {
 
         std::string         styleValidInConfigVar(const std::string&, const std::string&);
 
+        struct STickStats {
+            size_t active        = 0;
+            size_t skipped       = 0; // owner off screen, left for a later tick
+            size_t fastForwarded = 0; // finished while off screen, warped straight to the goal
+        };
+
+        const STickStats&   lastTickStats() const;
+
         SP<CEventLoopTimer> m_animationTimer;
 
         float               m_lastTickTimeMs;
 
       private:
-        bool   m_tickScheduled       = false;
-        bool   m_manualTickRequested = false;
-        bool   m_lastTickValid       = false;
-        CTimer m_lastTickTimer;
+        bool       m_tickScheduled       = false;
+        bool       m_manualTickRequested = false;
+        bool       m_lastTickValid       = false;
+        CTimer     m_lastTickTimer;
+        STickStats m_lastTickStats;
     };
 
     UP<CHyprAnimationManager>& mgr();
@@ -454,17 +454,25 @@ void CConfigManager::watchdogHook(lua_State* L, lua_Debug* /*ar*/) {
     if (!mgr || !mgr->m_watchdogActive)
         return;
 
-    if (std::chrono::steady_clock::now() <= mgr->m_watchdogDeadline)
+    auto& left = mgr->m_watchdogInstructionsLeft;
+    if (left)
+        *left -= lua_gethookcount(L);
+
+    const bool OUTOFINSTRUCTIONS = left && *left <= 0;
+    if (!OUTOFINSTRUCTIONS && std::chrono::steady_clock::now() <= mgr->m_watchdogDeadline)
         return;
 
+    mgr->m_watchdogTripped = true;
+
     const auto& context = mgr->m_watchdogContext;
+    const char* what    = OUTOFINSTRUCTIONS ? "ran out of instructions" : "timed out";
     if (context.empty())
-        luaL_error(L, "[Lua] execution timed out");
+        luaL_error(L, "[Lua] execution %s", what);
 
-    luaL_error(L, "[Lua] execution timed out in %s", context.c_str());
+    luaL_error(L, "[Lua] execution %s in %s", what, context.c_str());
 }
 
-int CConfigManager::guardedPCall(int nargs, int nresults, int errfunc, int timeoutMs, std::string_view context) {
+int CConfigManager::guardedPCall(int nargs, int nresults, int errfunc, int timeoutMs, std::string_view context, int64_t instructionLimit) {
     if (!m_lua)
         return LUA_ERRERR;
 
@@ -474,27 +482,77 @@ int CConfigManager::guardedPCall(int nargs, int nresults, int errfunc, int timeo
 
     const bool                                  prevWatchdogActive   = m_watchdogActive;
     const std::chrono::steady_clock::time_point prevWatchdogDeadline = m_watchdogDeadline;
+    const std::optional<int64_t>                prevInstructionsLeft = m_watchdogInstructionsLeft;
     const std::string                           prevWatchdogContext  = m_watchdogContext;
 
-    m_watchdogActive   = timeoutMs > 0;
-    m_watchdogDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(timeoutMs, 1));
-    m_watchdogContext  = context;
+    m_watchdogActive           = timeoutMs > 0 || instructionLimit > 0;
+    m_watchdogDeadline         = timeoutMs > 0 ? std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs) : std::chrono::steady_clock::time_point::max();
+    m_watchdogInstructionsLeft = instructionLimit > 0 ? std::optional{instructionLimit} : std::nullopt;
+    m_watchdogContext          = context;
+    m_watchdogTripped          = false;
 
-    lua_sethook(m_lua, &CConfigManager::watchdogHook, LUA_MASKCOUNT, LUA_WATCHDOG_INSTRUCTION_INTERVAL);
+    // small budgets need a finer hook, otherwise they'd be rounded up to the interval
+    const int HOOKCOUNT = instructionLimit > 0 ? sc<int>(std::min<int64_t>(instructionLimit, LUA_WATCHDOG_INSTRUCTION_INTERVAL)) : LUA_WATCHDOG_INSTRUCTION_INTERVAL;
+
+    lua_sethook(m_lua, &CConfigManager::watchdogHook, LUA_MASKCOUNT, HOOKCOUNT);
     const int result = lua_pcall(m_lua, nargs, nresults, errfunc);
 
     lua_sethook(m_lua, prevHook, prevMask, prevCount);
-    m_watchdogActive   = prevWatchdogActive;
-    m_watchdogDeadline = prevWatchdogDeadline;
-    m_watchdogContext  = prevWatchdogContext;
+    m_watchdogActive           = prevWatchdogActive;
+    m_watchdogDeadline         = prevWatchdogDeadline;
+    m_watchdogInstructionsLeft = prevInstructionsLeft;
+    m_watchdogContext          = prevWatchdogContext;
 
     return result;
 }
 
+bool CConfigManager::watchdogTripped() const {
+    return m_watchdogTripped;
+}
+
 eConfigManagerType CConfigManager::type() {
     return CONFIG_LUA;
 }
 
+namespace {
+    // what window and layer rules match against, besides the rules themselves
+    struct SRuleMatchState {
+        std::unordered_map<std::string, std::string> values;
+        std::vector<Config::CMonitorRule>            monitorRules;
+        std::vector<Config::CWorkspaceRule>          workspaceRules;
+    };
+}
+
+static SRuleMatchState ruleMatchState(const std::unordered_map<std::string, UP<ILuaConfigValue>>& values) {
+    SRuleMatchState state;
+
+    state.values.reserve(values.size());
+    for (const auto& [name, value] : values) {
+        state.values.emplace(name, value->toString());
+    }
+
+    state.monitorRules = Config::monitorRuleMgr()->all();
+    for (const auto& r : Config::workspaceRuleMgr()->getAllWorkspaceRules()) {
+        state.workspaceRules.emplace_back(*r);
+    }
+
+    return state;
+}
+
+static bool sameRuleMatchState(const SRuleMatchState& a, const SRuleMatchState& b) {
+    if (a.values != b.values || a.workspaceRules != b.workspaceRules || a.monitorRules.size() != b.monitorRules.size())
+        return false;
+
+    for (size_t i = 0; i < a.monitorRules.size(); ++i) {
+        const auto& ma = a.monitorRules[i];
+        const auto& mb = b.monitorRules[i];
+        if (ma.m_name != mb.m_name || ma.m_vrr != mb.m_vrr || ma.compare(mb) != Config::COMPARISON_FULL_MATCH)
+            return false;
+    }
+
+    return true;
+}
+
 void CConfigManager::registerValue(const char* name, UP<ILuaConfigValue>&& val) {
     m_configValues.emplace(name, std::move(val));
 }
@@ -708,6 +766,9 @@ void CConfigManager::reload() {
         return;
     }
 
+    // rules only have to be diffed if nothing they match against changed with this reload
+    const auto BEFORE = ruleMatchState(m_configValues);
+
     // phase 2: syntax is valid, reset and load.
     Config::animationTree()->reset();
     Config::workspaceRuleMgr()->clear();
@@ -764,6 +825,8 @@ void CConfigManager::reload() {
     // promptly release pause leases from dropped references
     lua_gc(m_lua, LUA_GCCOLLECT, 0);
 
+    m_onlyRulesReloaded = sameRuleMatchState(BEFORE, ruleMatchState(m_configValues));
+
     postConfigReload();
 }
 
@@ -856,7 +919,8 @@ void CConfigManager::postConfigReload() {
 
     handlePluginLoads();
 
-    Config::Supplementary::refresher()->scheduleRefresh(Supplementary::REFRESH_ALL);
+    Config::Supplementary::refresher()->scheduleRefresh(Supplementary::REFRESH_ALL, m_onlyRulesReloaded);
+    m_onlyRulesReloaded = false;
 
     Event::bus()->m_events.config.reloaded.emit();
     if (IPC::Socket2::sock())
@@ -108,7 +108,9 @@ namespace Config::Lua {
         // execute an arbitrary lua string on the current state.
         std::optional<std::string> eval(const std::string& code, bool repl = false);
 
-        int                        guardedPCall(int nargs, int nresults, int errfunc, int timeoutMs, std::string_view context);
+        // instructionLimit of 0 means only the timeout applies. watchdogTripped() tells if the last call was stopped by either.
+        int                        guardedPCall(int nargs, int nresults, int errfunc, int timeoutMs, std::string_view context, int64_t instructionLimit = 0);
+        bool                       watchdogTripped() const;
 
         static CConfigManager*     fromLuaState(lua_State* L);
 
@@ -117,7 +119,6 @@ namespace Config::Lua {
         static constexpr int       LUA_TIMEOUT_EVENT_CALLBACK_MS     = 50;
         static constexpr int       LUA_TIMEOUT_KEYBIND_CALLBACK_MS   = 100;
         static constexpr int       LUA_TIMEOUT_TIMER_CALLBACK_MS     = 50;
-        static constexpr int       LUA_TIMEOUT_LAYOUT_CALLBACK_MS    = 50;
         static constexpr int       LUA_TIMEOUT_EVAL_MS               = 250;
         static constexpr int       LUA_TIMEOUT_DISPATCH_MS           = 100;
 
@@ -154,6 +155,9 @@ namespace Config::Lua {
         std::unordered_map<std::string, SP<Desktop::Rule::CWindowRule>> m_luaWindowRules;
         std::unordered_map<std::string, SP<Desktop::Rule::CLayerRule>>  m_luaLayerRules;
 
+        // registered hl.layout providers, for hyprctl lualayouts
+        const std::vector<SP<Layouts::SLuaLayoutProvider>>& luaLayoutProviders() const;
+
       private:
         void                                         reinitLuaState();
         void                                         postConfigReload();
@@ -181,7 +185,11 @@ namespace Config::Lua {
         bool                                         m_isEvaluating                        = false;
         bool                                         m_isREPL                              = false;
 
+        bool                                         m_watchdogTripped                     = false;
+        bool                                         m_onlyRulesReloaded                   = false; // see reload()
+
         std::chrono::steady_clock::time_point        m_watchdogDeadline;
+        std::optional<int64_t>                       m_watchdogInstructionsLeft;
         std::string                                  m_watchdogContext;
 
         std::string                                  m_mainConfigPath;
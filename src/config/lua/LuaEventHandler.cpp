@@ -8,7 +8,11 @@
 
 #include "../../event/EventBus.hpp"
 #include "../../desktop/state/FocusState.hpp"
+#include "../../managers/eventLoop/EventLoopManager.hpp"
+#include <algorithm>
+#include <chrono>
 #include <expected>
+#include <type_traits>
 #include <vector>
 
 extern "C" {
@@ -21,16 +25,56 @@ extern "C" {
 using namespace Config::Lua;
 using namespace Config::Lua::Objects;
 
-void CLuaEventHandler::dispatch(const std::string& name, int nargs, const std::function<void(lua_State*)>& pushArgs) {
+static void pushArg(lua_State* L, const CLuaEventHandler::EventArg& arg) {
+    std::visit(
+        [L](const auto& v) {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, bool>)
+                lua_pushboolean(L, v);
+            else if constexpr (std::is_same_v<T, lua_Integer>)
+                lua_pushinteger(L, v);
+            else if constexpr (std::is_same_v<T, double>)
+                lua_pushnumber(L, v);
+            else if constexpr (std::is_same_v<T, std::string>)
+                lua_pushstring(L, v.c_str());
+            else if constexpr (std::is_same_v<T, PHLWINDOWREF>)
+                CLuaWindow::push(L, v);
+            else if constexpr (std::is_same_v<T, PHLWORKSPACEREF>)
+                CLuaWorkspace::push(L, v);
+            else if constexpr (std::is_same_v<T, PHLMONITORREF>)
+                CLuaMonitor::push(L, v);
+            else if constexpr (std::is_same_v<T, PHLLSREF>)
+                CLuaLayerSurface::push(L, v);
+        },
+        arg);
+}
+
+// what deferred events are coalesced by, the object they're about if there is one
+static const void* eventObject(const std::vector<CLuaEventHandler::EventArg>& args) {
+    if (args.empty())
+        return nullptr;
+
+    return std::visit(
+        [](const auto& v) -> const void* {
+            using T = std::decay_t<decltype(v)>;
+            if constexpr (std::is_same_v<T, PHLWINDOWREF> || std::is_same_v<T, PHLWORKSPACEREF> || std::is_same_v<T, PHLMONITORREF> || std::is_same_v<T, PHLLSREF>)
+                return v.get();
+            else
+                return nullptr;
+        },
+        args.front());
+}
+
+bool CLuaEventHandler::hasSubscribers(std::string_view name) const {
+    const auto IT = m_callbacks.find(name);
+    return IT != m_callbacks.end() && !IT->second.empty();
+}
+
+void CLuaEventHandler::dispatchArgs(const std::string& name, std::vector<EventArg>&& args) {
     auto it = m_callbacks.find(name);
     if (it == m_callbacks.end() || it->second.empty())
         return;
 
-    if (m_dispatchDepth >= MAX_DISPATCH_DEPTH) {
-        Log::logger->log(Log::WARN, "[LuaEvents] max dispatch depth ({}) reached while handling '{}'", MAX_DISPATCH_DEPTH, name);
-        return;
-    }
-
     const auto handles = it->second;
 
     for (const auto handle : handles) {
@@ -38,47 +82,114 @@ void CLuaEventHandler::dispatch(const std::string& name, int nargs, const std::f
         if (sub == m_subscriptions.end())
             continue;
 
-        if (m_activeHandles.contains(handle)) {
-            if (m_reentrancyWarnedHandles.emplace(handle).second)
-                Log::logger->log(Log::WARN, "[LuaEvents] suppressed recursive hl.on(\"{}\") callback invocation", name);
-            continue;
-        }
+        if (sub->second.deferred)
+            defer(handle, name, args);
+        else
+            call(handle, name, args);
+    }
+}
 
-        struct SDispatchScope {
-            CLuaEventHandler* self   = nullptr;
-            uint64_t          handle = 0;
+void CLuaEventHandler::call(uint64_t handle, const std::string& name, const std::vector<EventArg>& args) {
+    const auto sub = m_subscriptions.find(handle);
+    if (sub == m_subscriptions.end())
+        return;
 
-            ~SDispatchScope() {
-                if (!self)
-                    return;
+    if (m_dispatchDepth >= MAX_DISPATCH_DEPTH) {
+        Log::logger->log(Log::WARN, "[LuaEvents] max dispatch depth ({}) reached while handling '{}'", MAX_DISPATCH_DEPTH, name);
+        return;
+    }
 
-                self->m_activeHandles.erase(handle);
-                if (self->m_dispatchDepth > 0)
-                    --self->m_dispatchDepth;
-            }
-        } dispatchScope{.self = this, .handle = handle};
+    if (m_activeHandles.contains(handle)) {
+        if (m_reentrancyWarnedHandles.emplace(handle).second)
+            Log::logger->log(Log::WARN, "[LuaEvents] suppressed recursive hl.on(\"{}\") callback invocation", name);
+        return;
+    }
+
+    struct SDispatchScope {
+        CLuaEventHandler* self   = nullptr;
+        uint64_t          handle = 0;
+
+        ~SDispatchScope() {
+            if (!self)
+                return;
+
+            self->m_activeHandles.erase(handle);
+            if (self->m_dispatchDepth > 0)
+                --self->m_dispatchDepth;
+        }
+    } dispatchScope{.self = this, .handle = handle};
+
+    m_activeHandles.emplace(handle);
+    ++m_dispatchDepth;
+
+    lua_rawgeti(m_lua, LUA_REGISTRYINDEX, sub->second.luaRef);
+    for (const auto& arg : args) {
+        pushArg(m_lua, arg);
+    }
 
-        m_activeHandles.emplace(handle);
-        ++m_dispatchDepth;
+    auto*      mgr   = CConfigManager::fromLuaState(m_lua);
+    const auto BEGIN = std::chrono::steady_clock::now();
 
-        lua_rawgeti(m_lua, LUA_REGISTRYINDEX, sub->second.luaRef);
-        pushArgs(m_lua);
+    int        status = LUA_OK;
+    if (mgr)
+        status = mgr->guardedPCall(sc<int>(args.size()), 0, 0, CConfigManager::LUA_TIMEOUT_EVENT_CALLBACK_MS, std::format("hl.on(\"{}\") callback", name));
+    else
+        status = lua_pcall(m_lua, sc<int>(args.size()), 0, 0);
 
-        auto* mgr = CConfigManager::fromLuaState(m_lua);
+    // the callback may have unsubscribed itself
+    if (const auto SUB = m_subscriptions.find(handle); SUB != m_subscriptions.end()) {
+        SUB->second.calls++;
+        SUB->second.ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - BEGIN).count();
+    }
 
-        int   status = LUA_OK;
+    if (status != LUA_OK) {
+        const char* err = lua_tostring(m_lua, -1);
         if (mgr)
-            status = mgr->guardedPCall(nargs, 0, 0, CConfigManager::LUA_TIMEOUT_EVENT_CALLBACK_MS, std::format("hl.on(\"{}\") callback", name));
-        else
-            status = lua_pcall(m_lua, nargs, 0, 0);
+            mgr->addError(std::format("hl.on(\"{}\") callback: {}", name, err ? err : "(unknown)"));
+        lua_pop(m_lua, 1);
+    }
+}
 
-        if (status != LUA_OK) {
-            const char* err = lua_tostring(m_lua, -1);
-            if (mgr)
-                mgr->addError(std::format("hl.on(\"{}\") callback: {}", name, err ? err : "(unknown)"));
-            lua_pop(m_lua, 1);
-        }
+void CLuaEventHandler::defer(uint64_t handle, const std::string& name, const std::vector<EventArg>& args) {
+    const auto OBJECT = eventObject(args);
+
+    // there's at most one pending event per subscription and object, so this stays short
+    auto it = std::ranges::find_if(m_deferred, [&](const auto& e) { return e.handle == handle && e.object == OBJECT; });
+    if (it != m_deferred.end()) {
+        it->args = args;
+        m_subscriptions[handle].coalesced++;
+        return;
+    }
+
+    m_deferred.emplace_back(SDeferredEvent{.handle = handle, .object = OBJECT, .eventName = name, .args = args});
+
+    if (!g_pEventLoopManager)
+        return;
+
+    if (!m_deferTimer) {
+        m_deferTimer = makeShared<CEventLoopTimer>(std::nullopt, [this](SP<CEventLoopTimer> self, void* data) { flushDeferred(); }, nullptr);
+        g_pEventLoopManager->addTimer(m_deferTimer);
     }
+
+    if (!m_deferTimer->armed())
+        m_deferTimer->updateTimeout(std::chrono::milliseconds(MAX_DEFER_MS));
+}
+
+void CLuaEventHandler::flushDeferred() {
+    if (m_deferTimer)
+        m_deferTimer->updateTimeout(std::nullopt);
+
+    // callbacks can queue new events, those wait for the next frame
+    const auto EVENTS = std::move(m_deferred);
+    m_deferred.clear();
+
+    for (const auto& e : EVENTS) {
+        call(e.handle, e.eventName, e.args);
+    }
+}
+
+const std::unordered_map<uint64_t, CLuaEventHandler::SSubscription>& CLuaEventHandler::subscriptions() const {
+    return m_subscriptions;
 }
 
 CLuaEventHandler::CLuaEventHandler(lua_State* L) : m_lua(L) {
@@ -91,81 +202,62 @@ CLuaEventHandler::CLuaEventHandler(lua_State* L) : m_lua(L) {
     using namespace Event;
 
     // openLate so that actual things people expect to happen will happen.
-    m_listeners.push_back(bus()->m_events.window.openLate.listen([this](PHLWINDOW w) { dispatch("window.open", 1, [&](lua_State* L) { CLuaWindow::push(L, w); }); }));
-    m_listeners.push_back(bus()->m_events.window.openEarly.listen([this](PHLWINDOW w) { dispatch("window.open_early", 1, [&](lua_State* L) { CLuaWindow::push(L, w); }); }));
-    m_listeners.push_back(bus()->m_events.window.close.listen([this](PHLWINDOW w) { dispatch("window.close", 1, [&](lua_State* L) { CLuaWindow::push(L, w); }); }));
-    m_listeners.push_back(bus()->m_events.window.destroy.listen([this](PHLWINDOWREF w) { dispatch("window.destroy", 1, [&](lua_State* L) { CLuaWindow::push(L, w.lock()); }); }));
-    m_listeners.push_back(bus()->m_events.window.kill.listen([this](PHLWINDOW w) { dispatch("window.kill", 1, [&](lua_State* L) { CLuaWindow::push(L, w); }); }));
-    m_listeners.push_back(bus()->m_events.window.active.listen([this](PHLWINDOW w, Desktop::eFocusReason r) {
-        dispatch("window.active", 2, [&](lua_State* L) {
-            CLuaWindow::push(L, w);
-            lua_pushinteger(L, sc<lua_Integer>(r));
-        });
-    }));
-    m_listeners.push_back(bus()->m_events.window.urgent.listen([this](PHLWINDOW w) { dispatch("window.urgent", 1, [&](lua_State* L) { CLuaWindow::push(L, w); }); }));
-    m_listeners.push_back(bus()->m_events.window.title.listen([this](PHLWINDOW w) { dispatch("window.title", 1, [&](lua_State* L) { CLuaWindow::push(L, w); }); }));
-    m_listeners.push_back(bus()->m_events.window.class_.listen([this](PHLWINDOW w) { dispatch("window.class", 1, [&](lua_State* L) { CLuaWindow::push(L, w); }); }));
-    m_listeners.push_back(bus()->m_events.window.pin.listen([this](PHLWINDOW w) { dispatch("window.pin", 1, [&](lua_State* L) { CLuaWindow::push(L, w); }); }));
-    m_listeners.push_back(bus()->m_events.window.fullscreen.listen([this](PHLWINDOW w) { dispatch("window.fullscreen", 1, [&](lua_State* L) { CLuaWindow::push(L, w); }); }));
-    m_listeners.push_back(bus()->m_events.window.updateRules.listen([this](PHLWINDOW w) { dispatch("window.update_rules", 1, [&](lua_State* L) { CLuaWindow::push(L, w); }); }));
-    m_listeners.push_back(bus()->m_events.window.moveToWorkspace.listen([this](PHLWINDOW w, PHLWORKSPACE ws) {
-        dispatch("window.move_to_workspace", 2, [&](lua_State* L) {
-            CLuaWindow::push(L, w);
-            CLuaWorkspace::push(L, ws);
-        });
-    }));
-    m_listeners.push_back(
-        bus()->m_events.window.bell.listen([this](PHLWINDOW w, Event::SCallbackInfo&) { dispatch("window.bell", 1, [&](lua_State* L) { CLuaWindow::push(L, w); }); }));
-
-    m_listeners.push_back(bus()->m_events.layer.opened.listen([this](PHLLS ls) { dispatch("layer.opened", 1, [&](lua_State* L) { CLuaLayerSurface::push(L, ls); }); }));
-    m_listeners.push_back(bus()->m_events.layer.closed.listen([this](PHLLS ls) { dispatch("layer.closed", 1, [&](lua_State* L) { CLuaLayerSurface::push(L, ls); }); }));
-
-    m_listeners.push_back(bus()->m_events.monitor.added.listen([this](PHLMONITOR mon) { dispatch("monitor.added", 1, [&](lua_State* L) { CLuaMonitor::push(L, mon); }); }));
-    m_listeners.push_back(bus()->m_events.monitor.removed.listen([this](PHLMONITOR mon) { dispatch("monitor.removed", 1, [&](lua_State* L) { CLuaMonitor::push(L, mon); }); }));
-    m_listeners.push_back(bus()->m_events.monitor.focused.listen([this](PHLMONITOR mon) { dispatch("monitor.focused", 1, [&](lua_State* L) { CLuaMonitor::push(L, mon); }); }));
-    m_listeners.push_back(bus()->m_events.monitor.layoutChanged.listen([this] { dispatch("monitor.layout_changed", 0, [](lua_State* L) {}); }));
-
-    m_listeners.push_back(bus()->m_events.workspace.active.listen([this](PHLWORKSPACE ws) { dispatch("workspace.active", 1, [&](lua_State* L) { CLuaWorkspace::push(L, ws); }); }));
-    m_listeners.push_back(bus()->m_events.workspace.specialActive.listen([this](PHLWORKSPACE ws, PHLMONITOR mon) {
-        dispatch("workspace.special_active", 2, [&](lua_State* L) {
-            CLuaWorkspace::push(L, ws);
-            CLuaMonitor::push(L, mon);
-        });
-    }));
+    m_listeners.push_back(bus()->m_events.window.openLate.listen([this](PHLWINDOW w) { dispatch("window.open", PHLWINDOWREF{w}); }));
+    m_listeners.push_back(bus()->m_events.window.openEarly.listen([this](PHLWINDOW w) { dispatch("window.open_early", PHLWINDOWREF{w}); }));
+    m_listeners.push_back(bus()->m_events.window.close.listen([this](PHLWINDOW w) { dispatch("window.close", PHLWINDOWREF{w}); }));
+    m_listeners.push_back(bus()->m_events.window.destroy.listen([this](PHLWINDOWREF w) { dispatch("window.destroy", w); }));
+    m_listeners.push_back(bus()->m_events.window.kill.listen([this](PHLWINDOW w) { dispatch("window.kill", PHLWINDOWREF{w}); }));
+    m_listeners.push_back(bus()->m_events.window.active.listen([this](PHLWINDOW w, Desktop::eFocusReason r) { dispatch("window.active", PHLWINDOWREF{w}, sc<lua_Integer>(r)); }));
+    m_listeners.push_back(bus()->m_events.window.urgent.listen([this](PHLWINDOW w) { dispatch("window.urgent", PHLWINDOWREF{w}); }));
+    m_listeners.push_back(bus()->m_events.window.title.listen([this](PHLWINDOW w) { dispatch("window.title", PHLWINDOWREF{w}); }));
+    m_listeners.push_back(bus()->m_events.window.class_.listen([this](PHLWINDOW w) { dispatch("window.class", PHLWINDOWREF{w}); }));
+    m_listeners.push_back(bus()->m_events.window.pin.listen([this](PHLWINDOW w) { dispatch("window.pin", PHLWINDOWREF{w}); }));
+    m_listeners.push_back(bus()->m_events.window.fullscreen.listen([this](PHLWINDOW w) { dispatch("window.fullscreen", PHLWINDOWREF{w}); }));
+    m_listeners.push_back(bus()->m_events.window.updateRules.listen([this](PHLWINDOW w) { dispatch("window.update_rules", PHLWINDOWREF{w}); }));
+    m_listeners.push_back(bus()->m_events.window.moveToWorkspace.listen(
+        [this](PHLWINDOW w, PHLWORKSPACE ws) { dispatch("window.move_to_workspace", PHLWINDOWREF{w}, PHLWORKSPACEREF{ws}); }));
+    m_listeners.push_back(bus()->m_events.window.bell.listen([this](PHLWINDOW w, Event::SCallbackInfo&) { dispatch("window.bell", PHLWINDOWREF{w}); }));
+
+    m_listeners.push_back(bus()->m_events.layer.opened.listen([this](PHLLS ls) { dispatch("layer.opened", PHLLSREF{ls}); }));
+    m_listeners.push_back(bus()->m_events.layer.closed.listen([this](PHLLS ls) { dispatch("layer.closed", PHLLSREF{ls}); }));
+
+    m_listeners.push_back(bus()->m_events.monitor.added.listen([this](PHLMONITOR mon) { dispatch("monitor.added", PHLMONITORREF{mon}); }));
+    m_listeners.push_back(bus()->m_events.monitor.removed.listen([this](PHLMONITOR mon) { dispatch("monitor.removed", PHLMONITORREF{mon}); }));
+    m_listeners.push_back(bus()->m_events.monitor.focused.listen([this](PHLMONITOR mon) { dispatch("monitor.focused", PHLMONITORREF{mon}); }));
+    m_listeners.push_back(bus()->m_events.monitor.layoutChanged.listen([this] { dispatch("monitor.layout_changed"); }));
+
+    m_listeners.push_back(bus()->m_events.workspace.active.listen([this](PHLWORKSPACE ws) { dispatch("workspace.active", PHLWORKSPACEREF{ws}); }));
+    m_listeners.push_back(bus()->m_events.workspace.specialActive.listen(
+        [this](PHLWORKSPACE ws, PHLMONITOR mon) { dispatch("workspace.special_active", PHLWORKSPACEREF{ws}, PHLMONITORREF{mon}); }));
     m_listeners.push_back(bus()->m_events.workspace.created.listen([this](PHLWORKSPACEREF wsRef) {
         const auto ws = wsRef.lock();
         if (!ws)
             return;
-        dispatch("workspace.created", 1, [&](lua_State* L) { CLuaWorkspace::push(L, ws); });
+        dispatch("workspace.created", PHLWORKSPACEREF{ws});
     }));
     m_listeners.push_back(bus()->m_events.workspace.removed.listen([this](PHLWORKSPACEREF wsRef) {
         if (!wsRef)
             return;
-        dispatch("workspace.removed", 1, [&](lua_State* L) { CLuaWorkspace::push(L, wsRef); });
-    }));
-    m_listeners.push_back(bus()->m_events.workspace.moveToMonitor.listen([this](PHLWORKSPACE ws, PHLMONITOR mon) {
-        dispatch("workspace.move_to_monitor", 2, [&](lua_State* L) {
-            CLuaWorkspace::push(L, ws);
-            CLuaMonitor::push(L, mon);
-        });
+        dispatch("workspace.removed", wsRef);
     }));
+    m_listeners.push_back(bus()->m_events.workspace.moveToMonitor.listen(
+        [this](PHLWORKSPACE ws, PHLMONITOR mon) { dispatch("workspace.move_to_monitor", PHLWORKSPACEREF{ws}, PHLMONITORREF{mon}); }));
 
-    m_listeners.push_back(bus()->m_events.config.reloaded.listen([this] { dispatch("config.reloaded", 0, [](lua_State* L) {}); }));
-    m_listeners.push_back(bus()->m_events.config.props_refreshed.listen(
-        [this](const bool execdAsScheduled) { dispatch("config.props_refreshed", 1, [&](lua_State* L) { lua_pushboolean(L, sc<lua_Integer>(execdAsScheduled)); }); }));
-
-    m_listeners.push_back(
-        bus()->m_events.keybinds.submap.listen([this](const std::string& submap) { dispatch("keybinds.submap", 1, [&](lua_State* L) { lua_pushstring(L, submap.c_str()); }); }));
-    m_listeners.push_back(bus()->m_events.screenshare.state.listen([this](bool state, uint8_t type, const std::string& name) {
-        dispatch("screenshare.state", 3, [&](lua_State* L) {
-            lua_pushboolean(L, state);
-            lua_pushinteger(L, sc<lua_Integer>(type));
-            lua_pushstring(L, name.c_str());
-        });
+    m_listeners.push_back(bus()->m_events.config.reloaded.listen([this] { dispatch("config.reloaded"); }));
+    m_listeners.push_back(bus()->m_events.config.props_refreshed.listen([this](const bool execdAsScheduled) { dispatch("config.props_refreshed", execdAsScheduled); }));
+
+    m_listeners.push_back(bus()->m_events.keybinds.submap.listen([this](const std::string& submap) { dispatch("keybinds.submap", submap); }));
+    m_listeners.push_back(bus()->m_events.screenshare.state.listen(
+        [this](bool state, uint8_t type, const std::string& name) { dispatch("screenshare.state", state, sc<lua_Integer>(type), name); }));
+
+    // deferred events go out once the frame is done, not from within the renderer
+    m_listeners.push_back(bus()->m_events.render.stage.listen([this](eRenderStage stage) {
+        if (stage == RENDER_POST && !m_deferred.empty() && m_deferTimer)
+            m_deferTimer->updateTimeout(std::chrono::milliseconds(0));
     }));
 
-    m_listeners.push_back(bus()->m_events.start.listen([this]() { dispatch("hyprland.start", 0, [](lua_State* L) {}); }));
-    m_listeners.push_back(bus()->m_events.exit.listen([this]() { dispatch("hyprland.shutdown", 0, [](lua_State* L) {}); }));
+    m_listeners.push_back(bus()->m_events.start.listen([this]() { dispatch("hyprland.start"); }));
+    m_listeners.push_back(bus()->m_events.exit.listen([this]() { dispatch("hyprland.shutdown"); }));
 
     m_listeners.push_back(bus()->m_events.pluginEventAdded.listen([this](SP<Event::CEventBus::CCustomEvent> event) {
         auto ret = addCustomEvent(event);
@@ -179,25 +271,26 @@ CLuaEventHandler::CLuaEventHandler(lua_State* L) : m_lua(L) {
     }));
 
     m_listeners.push_back(bus()->m_events.input.keyboard.key.listen([this](const IKeyboard::SKeyEvent& keyEvent, const SCallbackInfo& _) {
-        dispatch("input.keyboard.key", 3, [&](lua_State* L) {
-            lua_pushinteger(L, keyEvent.keycode + 8); // Because to xkbcommon it's +8 from libinput
-            lua_pushinteger(L, keyEvent.timeMs);
-            lua_pushinteger(L, keyEvent.state);
-        });
+        dispatch("input.keyboard.key",
+                 sc<lua_Integer>(keyEvent.keycode + 8), // Because to xkbcommon it's +8 from libinput
+                 sc<lua_Integer>(keyEvent.timeMs), sc<lua_Integer>(keyEvent.state));
     }));
 }
 
 CLuaEventHandler::~CLuaEventHandler() {
     clearEvents();
+
+    if (m_deferTimer && g_pEventLoopManager)
+        g_pEventLoopManager->removeTimer(m_deferTimer);
 }
 
-std::optional<uint64_t> CLuaEventHandler::registerEvent(const std::string& name, int luaRef) {
+std::optional<uint64_t> CLuaEventHandler::registerEvent(const std::string& name, int luaRef, bool deferred) {
     if (!knownEvents().contains(name))
         return std::nullopt;
 
     const auto handle = m_nextHandle++;
     m_callbacks[name].push_back(handle);
-    m_subscriptions[handle] = {.eventName = name, .luaRef = luaRef};
+    m_subscriptions[handle] = {.eventName = name, .luaRef = luaRef, .deferred = deferred};
 
     return handle;
 }
@@ -219,6 +312,7 @@ bool CLuaEventHandler::unregisterEvent(uint64_t handle) {
     m_subscriptions.erase(it);
     m_activeHandles.erase(handle);
     m_reentrancyWarnedHandles.erase(handle);
+    std::erase_if(m_deferred, [handle](const auto& e) { return e.handle == handle; });
 
     return true;
 }
@@ -232,26 +326,32 @@ void CLuaEventHandler::clearEvents() {
     m_activeHandles.clear();
     m_reentrancyWarnedHandles.clear();
     m_callbacks.clear();
+    m_deferred.clear();
 }
 
 std::expected<void, std::string> CLuaEventHandler::addCustomEvent(SP<Event::CEventBus::CCustomEvent> event) {
     using namespace Event;
 
     auto listener = event->m_event.listen([this, event](const std::vector<CEventBus::CCustomEvent::ValidVariant>& args) {
-        dispatch(event->m_name, event->m_argTypes.size(), [args](lua_State* L) {
-            for (const auto& arg : args) {
-                switch (arg.index()) {
-                    case CEventBus::CCustomEvent::TYPE_BOOL: lua_pushboolean(L, std::get<bool>(arg)); break;
-                    case CEventBus::CCustomEvent::TYPE_INT: lua_pushinteger(L, std::get<int>(arg)); break;
-                    case CEventBus::CCustomEvent::TYPE_DOUBLE: lua_pushnumber(L, std::get<double>(arg)); break;
-                    case CEventBus::CCustomEvent::TYPE_STRING: lua_pushstring(L, std::get<std::string>(arg).c_str()); break;
-                    case CEventBus::CCustomEvent::TYPE_WINDOW: CLuaWindow::push(L, std::get<PHLWINDOWREF>(arg)); break;
-                    case CEventBus::CCustomEvent::TYPE_WORKSPACE: CLuaWorkspace::push(L, std::get<PHLWORKSPACEREF>(arg)); break;
-                    case CEventBus::CCustomEvent::TYPE_LAYER_SURFACE: CLuaLayerSurface::push(L, std::get<PHLLSREF>(arg)); break;
-                    case CEventBus::CCustomEvent::TYPE_MONITOR: CLuaMonitor::push(L, std::get<PHLMONITORREF>(arg)); break;
-                }
+        if (!hasSubscribers(event->m_name))
+            return;
+
+        std::vector<EventArg> converted;
+        converted.reserve(args.size());
+        for (const auto& arg : args) {
+            switch (arg.index()) {
+                case CEventBus::CCustomEvent::TYPE_BOOL: converted.emplace_back(std::get<bool>(arg)); break;
+                case CEventBus::CCustomEvent::TYPE_INT: converted.emplace_back(sc<lua_Integer>(std::get<int>(arg))); break;
+                case CEventBus::CCustomEvent::TYPE_DOUBLE: converted.emplace_back(std::get<double>(arg)); break;
+                case CEventBus::CCustomEvent::TYPE_STRING: converted.emplace_back(std::get<std::string>(arg)); break;
+                case CEventBus::CCustomEvent::TYPE_WINDOW: converted.emplace_back(std::get<PHLWINDOWREF>(arg)); break;
+                case CEventBus::CCustomEvent::TYPE_WORKSPACE: converted.emplace_back(std::get<PHLWORKSPACEREF>(arg)); break;
+                case CEventBus::CCustomEvent::TYPE_LAYER_SURFACE: converted.emplace_back(std::get<PHLLSREF>(arg)); break;
+                case CEventBus::CCustomEvent::TYPE_MONITOR: converted.emplace_back(std::get<PHLMONITORREF>(arg)); break;
             }
-        });
+        }
+
+        dispatchArgs(event->m_name, std::move(converted));
     });
     if (!m_pluginListeners.try_emplace(event->m_name, listener).second)
         return std::unexpected("event already exists.");
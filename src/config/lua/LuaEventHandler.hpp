@@ -3,8 +3,10 @@
 #include <expected>
 #include <functional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
+#include <variant>
 #include <vector>
 #include <optional>
 #include <cstdint>
@@ -18,6 +20,8 @@ extern "C" {
 #include <lua.h>
 }
 
+class CEventLoopTimer;
+
 namespace Config::Lua {
 
     // Manages hl.on() event subscriptions for a single Lua state lifetime.
@@ -31,26 +35,56 @@ namespace Config::Lua {
         explicit CLuaEventHandler(lua_State* L);
         ~CLuaEventHandler();
 
+        // an argument of a hl.on() callback, owned so that deferred events can be delivered later
+        using EventArg = std::variant<bool, lua_Integer, double, std::string, PHLWINDOWREF, PHLWORKSPACEREF, PHLMONITORREF, PHLLSREF>;
+
+        struct SSubscription {
+            std::string eventName;
+            int         luaRef   = -1;
+            bool        deferred = false; // see registerEvent
+
+            uint64_t    calls     = 0;
+            uint64_t    coalesced = 0; // deferred events replaced by a newer one before they were delivered
+            double      ms        = 0;
+        };
+
         // Store a Lua function (as a registry ref) to be called when `name` fires.
         // Returns a subscription handle, or std::nullopt if the event name is unknown.
-        std::optional<uint64_t>                registerEvent(const std::string& name, int luaRef);
-        bool                                   unregisterEvent(uint64_t handle);
+        // Deferred subscriptions are called once a frame has been rendered instead of right away,
+        // with only the latest event per object (the first argument) in the meantime.
+        std::optional<uint64_t>                            registerEvent(const std::string& name, int luaRef, bool deferred = false);
+        bool                                               unregisterEvent(uint64_t handle);
+
+        void                                               clearEvents();
 
-        void                                   clearEvents();
+        void                                               flushDeferred();
 
-        std::expected<void, std::string>       addCustomEvent(SP<Event::CEventBus::CCustomEvent> event);
-        std::expected<void, std::string>       removeCustomEvent(const std::string& name);
+        std::expected<void, std::string>                   addCustomEvent(SP<Event::CEventBus::CCustomEvent> event);
+        std::expected<void, std::string>                   removeCustomEvent(const std::string& name);
 
-        static std::unordered_set<std::string> knownEvents();
+        const std::unordered_map<uint64_t, SSubscription>& subscriptions() const;
+
+        static std::unordered_set<std::string>             knownEvents();
 
       private:
-        struct SSubscription {
-            std::string eventName;
-            int         luaRef = -1;
+        // so that checking for subscribers doesn't need a std::string
+        struct SNameHash {
+            using is_transparent = void;
+            size_t operator()(std::string_view sv) const {
+                return std::hash<std::string_view>{}(sv);
+            }
+        };
+        using CCallbackMap = std::unordered_map<std::string, std::vector<uint64_t>, SNameHash, std::equal_to<>>;
+
+        struct SDeferredEvent {
+            uint64_t              handle = 0;
+            const void*           object = nullptr;
+            std::string           eventName;
+            std::vector<EventArg> args;
         };
 
         lua_State*                                             m_lua = nullptr;
-        std::unordered_map<std::string, std::vector<uint64_t>> m_callbacks;
+        CCallbackMap                                           m_callbacks;
         std::unordered_map<uint64_t, SSubscription>            m_subscriptions;
         std::unordered_set<uint64_t>                           m_activeHandles;
         std::unordered_set<uint64_t>                           m_reentrancyWarnedHandles;
@@ -59,9 +93,25 @@ namespace Config::Lua {
         std::vector<CHyprSignalListener>                       m_listeners;
         std::unordered_map<std::string, CHyprSignalListener>   m_pluginListeners;
 
+        std::vector<SDeferredEvent>                            m_deferred;
+        SP<CEventLoopTimer>                                    m_deferTimer;
+
         static constexpr size_t                                MAX_DISPATCH_DEPTH = 32;
+        static constexpr int                                   MAX_DEFER_MS       = 100; // how long deferred events wait for a frame at most
+
+        bool                                                   hasSubscribers(std::string_view name) const;
+        void                                                   dispatchArgs(const std::string& name, std::vector<EventArg>&& args);
+        void                                                   call(uint64_t handle, const std::string& name, const std::vector<EventArg>& args);
+        void                                                   defer(uint64_t handle, const std::string& name, const std::vector<EventArg>& args);
+
+        // most events have nobody listening, only build the arguments if someone is
+        template <typename... Args>
+        void dispatch(std::string_view name, Args&&... args) {
+            if (!hasSubscribers(name))
+                return;
 
-        void                                                   dispatch(const std::string& name, int nargs, const std::function<void(lua_State*)>& pushArgs);
+            dispatchArgs(std::string{name}, std::vector<EventArg>{EventArg{std::forward<Args>(args)}...});
+        }
     };
 
 }
@@ -1270,7 +1270,7 @@ static int hlWindowRule(lua_State* L) {
         lua_pop(L, 1);
     }
 
-    Supplementary::refresher()->scheduleRefresh(Supplementary::REFRESH_WINDOW_STATES);
+    Supplementary::refresher()->scheduleRefresh(Supplementary::REFRESH_WINDOW_STATES, true);
 
     Objects::CLuaWindowRule::push(L, rule);
     return 1;
@@ -1385,7 +1385,7 @@ static int hlLayerRule(lua_State* L) {
         lua_pop(L, 1);
     }
 
-    Supplementary::refresher()->scheduleRefresh(Supplementary::REFRESH_RULES);
+    Supplementary::refresher()->scheduleRefresh(Supplementary::REFRESH_RULES, true);
 
     Objects::CLuaLayerRule::push(L, rule);
     return 1;
@@ -364,10 +364,20 @@ static int hlOn(lua_State* L) {
         return Internal::configError(L, std::format("on: bad argument 1: {}", evName.error()));
     luaL_checktype(L, 2, LUA_TFUNCTION);
 
+    bool deferred = false;
+    if (!lua_isnoneornil(L, 3)) {
+        luaL_checktype(L, 3, LUA_TTABLE);
+        lua_getfield(L, 3, "deferred");
+        if (!lua_isnil(L, -1) && !lua_isboolean(L, -1))
+            return Internal::configError(L, "hl.on: opts.deferred must be a boolean");
+        deferred = lua_toboolean(L, -1);
+        lua_pop(L, 1);
+    }
+
     lua_pushvalue(L, 2);
     int        ref = luaL_ref(L, LUA_REGISTRYINDEX);
 
-    const auto handle = mgr->m_eventHandler->registerEvent(*evName, ref);
+    const auto handle = mgr->m_eventHandler->registerEvent(*evName, ref, deferred);
     if (!handle.has_value()) {
         luaL_unref(L, LUA_REGISTRYINDEX, ref);
         const auto& known = CLuaEventHandler::knownEvents();
@@ -6,6 +6,7 @@
 #include "../bindings/Check.hpp"
 #include "../bindings/LuaBindingsInternal.hpp"
 
+#include "../../../config/ConfigValue.hpp"
 #include "../../../debug/log/Logger.hpp"
 #include "../../../layout/algorithm/Algorithm.hpp"
 #include "../../../layout/space/Space.hpp"
@@ -13,6 +14,7 @@
 #include "../../../layout/supplementary/WorkspaceAlgoMatcher.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <format>
 
@@ -52,8 +54,29 @@ void CLuaTiledAlgorithm::recalculate(Layout::eRecalculateReason reason) {
     if (targets.empty())
         return;
 
-    if (!callRecalculate(targets))
+    auto parent = m_parent.lock();
+    auto space  = parent ? parent->space() : nullptr;
+    if (!space)
+        return;
+
+    // the provider only sees the targets and the area (gaps_out is part of it), so if it says it's stateless, the same input gets the same boxes.
+    // Recalculations with a reason are asked for explicitly, those always go to lua.
+    const auto AREA      = space->workArea();
+    const bool CACHEABLE = m_provider && m_provider->cacheable && reason == Layout::RECALCULATE_REASON_UNKNOWN;
+    if (CACHEABLE && applyLastResult(targets, AREA)) {
+        m_provider->stats.cached++;
+        return;
+    }
+
+    if (!callRecalculate(targets)) {
+        // don't keep the fallback around, the next recalculation should give lua another go
+        m_lastResult = {};
         applyDefaultGrid(targets);
+        return;
+    }
+
+    if (m_provider->cacheable)
+        storeLastResult(targets, AREA);
 }
 
 void CLuaTiledAlgorithm::swapTargets(SP<Layout::ITarget> a, SP<Layout::ITarget> b) {
@@ -112,7 +135,13 @@ Config::ErrorResult CLuaTiledAlgorithm::layoutMsg(const std::string_view& sv) {
     pushLayoutContext(L, targets, space->workArea());
     lua_pushlstring(L, sv.data(), sv.size());
 
-    const int status = m_provider->manager->guardedPCall(2, 1, 0, CConfigManager::LUA_TIMEOUT_LAYOUT_CALLBACK_MS, "lua layout_msg callback");
+    static auto PTIMEOUT      = CConfigValue<Config::INTEGER>("layout:lua_timeout");
+    static auto PINSTRUCTIONS = CConfigValue<Config::INTEGER>("layout:lua_instruction_limit");
+
+    // the provider's state may change, so its last result can't be reused anymore
+    m_lastResult = {};
+
+    const int status = m_provider->manager->guardedPCall(2, 1, 0, *PTIMEOUT, "lua layout_msg callback", *PINSTRUCTIONS);
     if (status != LUA_OK) {
         std::string err = lua_tostring(L, -1) ? lua_tostring(L, -1) : "unknown lua error";
         lua_settop(L, top);
@@ -198,12 +227,26 @@ bool CLuaTiledAlgorithm::callRecalculate(const std::vector<SP<Layout::ITarget>>&
         return false;
     }
 
+    static auto PTIMEOUT      = CConfigValue<Config::INTEGER>("layout:lua_timeout");
+    static auto PINSTRUCTIONS = CConfigValue<Config::INTEGER>("layout:lua_instruction_limit");
+
     pushLayoutContext(L, targets, space->workArea());
 
-    const int status = m_provider->manager->guardedPCall(1, 0, 0, CConfigManager::LUA_TIMEOUT_LAYOUT_CALLBACK_MS, "lua layout recalculate callback");
+    const auto BEGIN  = std::chrono::steady_clock::now();
+    const int  status = m_provider->manager->guardedPCall(1, 0, 0, *PTIMEOUT, "lua layout recalculate callback", *PINSTRUCTIONS);
+    const auto MS     = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - BEGIN).count();
+
+    auto&      stats = m_provider->stats;
+    stats.ms += MS;
+    stats.calls++;
+    stats.maxMs = std::max(stats.maxMs, MS);
+
     if (status != LUA_OK) {
         std::string err = lua_tostring(L, -1) ? lua_tostring(L, -1) : "unknown lua error";
         lua_settop(L, top);
+        stats.failed++;
+        if (m_provider->manager->watchdogTripped())
+            stats.overBudget++;
         reportError(err);
         return false;
     }
@@ -229,6 +272,34 @@ void CLuaTiledAlgorithm::applyDefaultGrid(const std::vector<SP<Layout::ITarget>>
     }
 }
 
+bool CLuaTiledAlgorithm::applyLastResult(const std::vector<SP<Layout::ITarget>>& targets, const CBox& area) {
+    if (!m_provider || m_lastResult.area != area || m_lastResult.targets.size() != targets.size())
+        return false;
+
+    for (size_t i = 0; i < targets.size(); ++i) {
+        if (m_lastResult.targets[i].lock() != targets[i])
+            return false;
+    }
+
+    // something else may have moved them since, put them back
+    for (size_t i = 0; i < targets.size(); ++i) {
+        targets[i]->setPositionGlobal(m_lastResult.boxes[i]);
+    }
+
+    return true;
+}
+
+void CLuaTiledAlgorithm::storeLastResult(const std::vector<SP<Layout::ITarget>>& targets, const CBox& area) {
+    m_lastResult.area = area;
+    m_lastResult.targets.clear();
+    m_lastResult.boxes.clear();
+
+    for (const auto& target : targets) {
+        m_lastResult.targets.emplace_back(target);
+        m_lastResult.boxes.emplace_back(target->position());
+    }
+}
+
 void CLuaTiledAlgorithm::reportError(const std::string& message) {
     if (!m_provider)
         return;
@@ -261,14 +332,19 @@ std::expected<void, std::string> CConfigManager::registerLuaLayoutProvider(std::
     if (!hasRecalculate)
         return std::unexpected("provider table must define recalculate(ctx)");
 
+    lua_getfield(L, providerTableIdx, "cacheable");
+    const bool cacheable = lua_toboolean(L, -1);
+    lua_pop(L, 1);
+
     lua_pushvalue(L, providerTableIdx);
     const int ref = luaL_ref(L, LUA_REGISTRYINDEX);
 
-    auto      provider = makeShared<SLuaLayoutProvider>();
-    provider->manager  = this;
-    provider->state    = L;
-    provider->name     = name;
-    provider->tableRef = ref;
+    auto      provider  = makeShared<SLuaLayoutProvider>();
+    provider->manager   = this;
+    provider->state     = L;
+    provider->name      = name;
+    provider->tableRef  = ref;
+    provider->cacheable = cacheable;
 
     if (!Layout::Supplementary::algoMatcher()->registerTiledAlgo(name, &typeid(CLuaTiledAlgorithm), [provider] { return makeUnique<CLuaTiledAlgorithm>(provider); })) {
         luaL_unref(L, LUA_REGISTRYINDEX, ref);
@@ -279,6 +355,10 @@ std::expected<void, std::string> CConfigManager::registerLuaLayoutProvider(std::
     return {};
 }
 
+const std::vector<SP<SLuaLayoutProvider>>& CConfigManager::luaLayoutProviders() const {
+    return m_luaLayoutProviders;
+}
+
 void CConfigManager::clearLuaLayoutProviders() {
     if (m_luaLayoutProviders.empty())
         return;
@@ -4,6 +4,7 @@
 #include "../../../helpers/math/Math.hpp"
 #include "../../../layout/algorithm/TiledAlgorithm.hpp"
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -20,13 +21,24 @@ namespace Config::Lua {
 
 namespace Config::Lua::Layouts {
 
+    struct SLuaLayoutStats {
+        uint64_t calls      = 0; // recalculate() calls into lua
+        uint64_t cached     = 0; // recalculations served from the last result
+        uint64_t failed     = 0;
+        uint64_t overBudget = 0; // stopped by layout:lua_timeout or layout:lua_instruction_limit
+        double   ms         = 0;
+        double   maxMs      = 0;
+    };
+
     struct SLuaLayoutProvider {
         CConfigManager* manager = nullptr;
         lua_State*      state   = nullptr;
         std::string     name;
-        int             tableRef = LUA_NOREF;
-        bool            active   = true;
-        bool            didError = false;
+        int             tableRef  = LUA_NOREF;
+        bool            active    = true;
+        bool            didError  = false;
+        bool            cacheable = false; // `cacheable = true` in the provider table: same targets and area give the same boxes
+        SLuaLayoutStats stats;
     };
 
     class CLuaTiledAlgorithm : public Layout::ITiledAlgorithm {
@@ -50,10 +62,19 @@ namespace Config::Lua::Layouts {
         SP<SLuaLayoutProvider>           m_provider;
         std::vector<WP<Layout::ITarget>> m_targets;
 
+        // the boxes the last recalculate() ended up with, and what they were computed for
+        struct {
+            std::vector<WP<Layout::ITarget>> targets;
+            CBox                             area;
+            std::vector<CBox>                boxes;
+        } m_lastResult;
+
         std::vector<SP<Layout::ITarget>> liveTargets();
         bool                             callRecalculate(const std::vector<SP<Layout::ITarget>>& targets);
         void                             applyDefaultGrid(const std::vector<SP<Layout::ITarget>>& targets);
         void                             reportError(const std::string& message);
+        bool                             applyLastResult(const std::vector<SP<Layout::ITarget>>& targets, const CBox& area);
+        void                             storeLastResult(const std::vector<SP<Layout::ITarget>>& targets, const CBox& area);
     };
 
 }
@@ -87,7 +87,5 @@ void Objects::CLuaLayerSurface::push(lua_State* L, PHLLSREF ls) {
         return;
     }
 
-    new (lua_newuserdata(L, sizeof(PHLLSREF))) PHLLSREF(ls ? ls->m_self : nullptr);
-    luaL_getmetatable(L, MT);
-    lua_setmetatable(L, -2);
+    pushCachedRef(L, MT, ls.lock());
 }
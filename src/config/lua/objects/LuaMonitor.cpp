@@ -219,7 +219,5 @@ void Objects::CLuaMonitor::push(lua_State* L, PHLMONITORREF mon) {
         return;
     }
 
-    new (lua_newuserdata(L, sizeof(PHLMONITORREF))) PHLMONITORREF(mon ? mon->m_self : nullptr);
-    luaL_getmetatable(L, MT);
-    lua_setmetatable(L, -2);
+    pushCachedRef(L, MT, mon.lock());
 }
@@ -42,6 +42,44 @@ namespace Config::Lua::Objects {
         lua_pop(L, 1);
     }
 
+    // Pushes the userdata wrapping `object`, a WP<T> with the given metatable. Wrappers are kept in a weak table per
+    // object, so pushing the same object again (e.g. for every event about it) reuses the one lua still holds.
+    template <typename T>
+    inline void pushCachedRef(lua_State* L, const char* metatable, const SP<T>& object) {
+        if (!object) {
+            lua_pushnil(L);
+            return;
+        }
+
+        lua_getfield(L, LUA_REGISTRYINDEX, "hl_object_cache");
+        if (!lua_istable(L, -1)) {
+            lua_pop(L, 1);
+            lua_newtable(L);
+            lua_newtable(L);
+            lua_pushstring(L, "v");
+            lua_setfield(L, -2, "__mode");
+            lua_setmetatable(L, -2);
+            lua_pushvalue(L, -1);
+            lua_setfield(L, LUA_REGISTRYINDEX, "hl_object_cache");
+        }
+
+        // the address might belong to a new object by now, or to one of another type
+        lua_rawgetp(L, -1, object.get());
+        if (auto* ref = sc<WP<T>*>(luaL_testudata(L, -1, metatable)); ref && ref->lock() == object) {
+            lua_remove(L, -2);
+            return;
+        }
+        lua_pop(L, 1);
+
+        new (lua_newuserdata(L, sizeof(WP<T>))) WP<T>(object);
+        luaL_getmetatable(L, metatable);
+        lua_setmetatable(L, -2);
+
+        lua_pushvalue(L, -1);
+        lua_rawsetp(L, -3, object.get());
+        lua_remove(L, -2);
+    }
+
     class ILuaObjectWrapper {
       public:
         virtual ~ILuaObjectWrapper()     = default;
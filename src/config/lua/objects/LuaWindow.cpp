@@ -261,7 +261,5 @@ void Objects::CLuaWindow::push(lua_State* L, PHLWINDOWREF w) {
         return;
     }
 
-    new (lua_newuserdata(L, sizeof(PHLWINDOWREF))) PHLWINDOWREF(w ? w->m_self : nullptr);
-    luaL_getmetatable(L, MT);
-    lua_setmetatable(L, -2);
+    pushCachedRef(L, MT, w.lock());
 }
@@ -175,9 +175,7 @@ void Objects::CLuaWorkspace::push(lua_State* L, PHLWORKSPACE ws) {
         return;
     }
 
-    new (lua_newuserdata(L, sizeof(PHLWORKSPACEREF))) PHLWORKSPACEREF(ws ? ws->m_self : nullptr);
-    luaL_getmetatable(L, MT);
-    lua_setmetatable(L, -2);
+    pushCachedRef(L, MT, ws);
 }
 
 void Objects::CLuaWorkspace::push(lua_State* L, PHLWORKSPACEREF ws) {
@@ -186,7 +184,5 @@ void Objects::CLuaWorkspace::push(lua_State* L, PHLWORKSPACEREF ws) {
         return;
     }
 
-    new (lua_newuserdata(L, sizeof(PHLWORKSPACEREF))) PHLWORKSPACEREF(ws ? ws->m_self : nullptr);
-    luaL_getmetatable(L, MT);
-    lua_setmetatable(L, -2);
+    pushCachedRef(L, MT, ws.lock());
 }
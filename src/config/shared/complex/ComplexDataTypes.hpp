@@ -126,6 +126,10 @@ namespace Config {
             m_left   = global;
         }
 
+        bool operator==(const CCssGapData& other) const {
+            return m_top == other.m_top && m_right == other.m_right && m_bottom == other.m_bottom && m_left == other.m_left;
+        }
+
         virtual eConfigValueDataTypes getDataType() {
             return CVD_TYPE_CSS_VALUE;
         }
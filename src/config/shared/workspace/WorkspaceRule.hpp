@@ -18,6 +18,7 @@ namespace Config {
         CWorkspaceRule(CWorkspaceRule&&)      = default;
 
         CWorkspaceRule& operator=(const CWorkspaceRule&) = default;
+        bool            operator==(const CWorkspaceRule&) const = default;
 
         // merge other into us
         void                               mergeLeft(const CWorkspaceRule& other);
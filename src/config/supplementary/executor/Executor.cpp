@@ -1,4 +1,5 @@
 #include "Executor.hpp"
+#include "Launcher.hpp"
 
 #include "../../../event/EventBus.hpp"
 #include "../../../Compositor.hpp"
@@ -171,43 +172,18 @@ std::vector<std::pair<std::string, std::string>> CExecutor::getHyprlandLaunchEnv
 std::optional<uint64_t> CExecutor::spawnRawProc(const std::string& args, PHLWORKSPACE pInitialWorkspace, const std::string& execRuleToken) {
     Log::logger->log(Log::DEBUG, "[executor] Executing {}", args);
 
-    const auto HLENV = getHyprlandLaunchEnv(pInitialWorkspace);
+    auto env = getHyprlandLaunchEnv(pInitialWorkspace);
+    env.emplace_back("WAYLAND_DISPLAY", g_pCompositor->m_wlDisplaySocket);
+    if (!execRuleToken.empty())
+        env.emplace_back(Desktop::Rule::EXEC_RULE_ENV_NAME, execRuleToken);
 
-    pid_t      child = fork();
-    if (child < 0) {
-        Log::logger->log(Log::DEBUG, "Fail to fork");
+    const auto RESULT = launchProcess({.command = args, .env = std::move(env), .nofile = g_pCompositor->originalNofile()});
+    if (!RESULT) {
+        Log::logger->log(Log::ERR, "[executor] Failed to launch {}: {}", args, RESULT.error());
         return std::nullopt;
     }
-    if (child == 0) {
-        // run in child
-        g_pCompositor->restoreNofile();
 
-        sigset_t set;
-        sigemptyset(&set);
-        sigprocmask(SIG_SETMASK, &set, nullptr);
+    Log::logger->log(Log::DEBUG, "[executor] Process created with pid {}{}", RESULT->pid, RESULT->direct ? " (direct exec)" : "");
 
-        for (auto const& e : HLENV) {
-            setenv(e.first.c_str(), e.second.c_str(), 1);
-        }
-        setenv("WAYLAND_DISPLAY", g_pCompositor->m_wlDisplaySocket.c_str(), 1);
-        if (!execRuleToken.empty())
-            setenv(Desktop::Rule::EXEC_RULE_ENV_NAME, execRuleToken.c_str(), true);
-
-        int devnull = open("/dev/null", O_WRONLY | O_CLOEXEC);
-        if (devnull != -1) {
-            dup2(devnull, STDOUT_FILENO);
-            dup2(devnull, STDERR_FILENO);
-            close(devnull);
-        }
-
-        execl("/bin/sh", "/bin/sh", "-c", args.c_str(), nullptr);
-
-        // exit child
-        _exit(0);
-    }
-    // run in parent
-
-    Log::logger->log(Log::DEBUG, "[executor] Process created with pid {}", child);
-
-    return child;
+    return RESULT->pid;
 }
@@ -0,0 +1,209 @@
+#include "Launcher.hpp"
+
+#include <hyprutils/memory/Casts.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <format>
+#include <sched.h>
+#include <string_view>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace Config::Supplementary;
+using namespace Hyprutils::Memory;
+
+extern char** environ;
+
+// plenty for the few libc calls the child makes before exec
+constexpr size_t CHILD_STACK_SIZE = 64 * 1024;
+
+namespace {
+    struct SChild {
+        const char*   path      = nullptr;
+        char* const*  argv      = nullptr;
+        char* const*  shellArgv = nullptr; // retried with if a direct exec fails
+        char* const*  envp      = nullptr;
+        const rlimit* nofile    = nullptr;
+
+        int           error = 0; // written by the child, we share its memory
+    };
+
+    std::vector<char*> cStrings(std::vector<std::string>& strings) {
+        std::vector<char*> result;
+        result.reserve(strings.size() + 1);
+        for (auto& s : strings) {
+            result.emplace_back(s.data());
+        }
+        result.emplace_back(nullptr);
+        return result;
+    }
+
+    std::vector<std::string> buildEnv(const std::vector<std::pair<std::string, std::string>>& overrides) {
+        auto overridden = [&overrides](std::string_view key, size_t from) {
+            return std::any_of(overrides.begin() + from, overrides.end(), [key](const auto& o) { return o.first == key; });
+        };
+
+        std::vector<std::string> result;
+        for (char** e = environ; e && *e; ++e) {
+            const std::string_view ENTRY = *e;
+            if (!overridden(ENTRY.substr(0, ENTRY.find('=')), 0))
+                result.emplace_back(ENTRY);
+        }
+
+        for (size_t i = 0; i < overrides.size(); ++i) {
+            if (!overridden(overrides[i].first, i + 1))
+                result.emplace_back(std::format("{}={}", overrides[i].first, overrides[i].second));
+        }
+
+        return result;
+    }
+
+    // what execvp would pick, resolved here because the child can't allocate
+    std::optional<std::string> findExecutable(const std::string& name, const std::vector<std::string>& env) {
+        auto executable = [](const std::string& path) {
+            struct stat st;
+            return stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode) && access(path.c_str(), X_OK) == 0;
+        };
+
+        if (name.contains('/'))
+            return executable(name) ? std::optional{name} : std::nullopt;
+
+        const auto PATHENV = std::ranges::find_if(env, [](const auto& e) { return e.starts_with("PATH="); });
+        if (PATHENV == env.end())
+            return std::nullopt;
+
+        std::string_view dirs = std::string_view{*PATHENV}.substr(5);
+        while (true) {
+            const auto       SEP = dirs.find(':');
+            std::string_view dir = dirs.substr(0, SEP);
+
+            // an empty entry means the working directory
+            const auto CANDIDATE = std::format("{}/{}", dir.empty() ? "." : dir, name);
+            if (executable(CANDIDATE))
+                return CANDIDATE;
+
+            if (SEP == std::string_view::npos)
+                break;
+
+            dirs = dirs.substr(SEP + 1);
+        }
+
+        return std::nullopt;
+    }
+
+    // runs on the parent's memory and a borrowed stack until exec, so no allocations, locks or logging in here
+    int childMain(void* data) {
+        auto* const child = sc<SChild*>(data);
+
+        if (child->nofile)
+            setrlimit(RLIMIT_NOFILE, child->nofile);
+
+        // all signals are blocked right now. Handlers are the parent's code, so reset them before unblocking.
+        struct sigaction dfl = {};
+        dfl.sa_handler       = SIG_DFL;
+        sigemptyset(&dfl.sa_mask);
+        for (int sig = 1; sig < NSIG; ++sig) {
+            struct sigaction old = {};
+            if (sigaction(sig, nullptr, &old) == 0 && old.sa_handler != SIG_DFL && old.sa_handler != SIG_IGN)
+                sigaction(sig, &dfl, nullptr);
+        }
+
+        int devnull = open("/dev/null", O_WRONLY | O_CLOEXEC);
+        if (devnull != -1) {
+            dup2(devnull, STDOUT_FILENO);
+            dup2(devnull, STDERR_FILENO);
+            close(devnull);
+        }
+
+        sigset_t set;
+        sigemptyset(&set);
+        sigprocmask(SIG_SETMASK, &set, nullptr);
+
+        execve(child->path, child->argv, child->envp);
+
+        if (child->shellArgv)
+            execve("/bin/sh", child->shellArgv, child->envp);
+
+        child->error = errno;
+        _exit(127);
+    }
+}
+
+std::optional<std::vector<std::string>> Config::Supplementary::splitPlainCommand(const std::string& command) {
+    // anything sh would do something with instead of passing it through
+    constexpr std::string_view SPECIAL = "|&;<>()$`\\\"'*?[]{}~!#\n";
+
+    if (command.find_first_of(SPECIAL) != std::string::npos)
+        return std::nullopt;
+
+    std::vector<std::string> words;
+    size_t                   pos = 0;
+    while (pos < command.size()) {
+        const auto BEGIN = command.find_first_not_of(" \t", pos);
+        if (BEGIN == std::string::npos)
+            break;
+
+        const auto END = std::min(command.find_first_of(" \t", BEGIN), command.size());
+        words.emplace_back(command.substr(BEGIN, END - BEGIN));
+        pos = END;
+    }
+
+    // FOO=bar cmd sets a variable
+    if (words.empty() || words.front().contains('='))
+        return std::nullopt;
+
+    return words;
+}
+
+std::expected<SLaunchResult, std::string> Config::Supplementary::launchProcess(const SLaunchRequest& request) {
+    auto                       env  = buildEnv(request.env);
+    auto                       envp = cStrings(env);
+
+    std::vector<std::string>   shellArgs = {"/bin/sh", "-c", request.command};
+    auto                       shellArgv = cStrings(shellArgs);
+
+    std::vector<std::string>   directArgs;
+    std::optional<std::string> path;
+    if (request.direct) {
+        if (auto words = splitPlainCommand(request.command); words && (path = findExecutable(words->front(), env)))
+            directArgs = std::move(*words);
+    }
+    auto   directArgv = cStrings(directArgs);
+
+    SChild child;
+    child.envp   = envp.data();
+    child.nofile = request.nofile ? &*request.nofile : nullptr;
+    if (directArgs.empty()) {
+        child.path = "/bin/sh";
+        child.argv = shellArgv.data();
+    } else {
+        child.path      = path->c_str();
+        child.argv      = directArgv.data();
+        child.shellArgv = shellArgv.data();
+    }
+
+    std::vector<uint8_t> stack(CHILD_STACK_SIZE);
+
+    // keep our handlers from running in the child while it still shares our memory, it unblocks once they're reset
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+
+    // CLONE_VFORK: we continue once the child has exec'd or exited, so everything above stays alive long enough
+    const pid_t PID = clone(childMain, stack.data() + stack.size(), CLONE_VM | CLONE_VFORK | SIGCHLD, &child);
+
+    const int   CLONEERR = errno;
+    pthread_sigmask(SIG_SETMASK, &old, nullptr);
+
+    if (PID < 0)
+        return std::unexpected(std::format("clone failed: {}", strerror(CLONEERR)));
+
+    if (child.error)
+        return std::unexpected(std::format("exec failed: {}", strerror(child.error)));
+
+    return SLaunchResult{.pid = PID, .direct = !directArgs.empty()};
+}
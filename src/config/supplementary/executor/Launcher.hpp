@@ -0,0 +1,33 @@
+#pragma once
+
+#include <expected>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/types.h>
+
+namespace Config::Supplementary {
+    // Splits a command into words if it can be exec'd as is, without a shell: no quoting, expansions,
+    // redirections, operators or variable assignments. nullopt means it needs /bin/sh -c.
+    std::optional<std::vector<std::string>> splitPlainCommand(const std::string& command);
+
+    struct SLaunchRequest {
+        std::string                                      command;
+        std::vector<std::pair<std::string, std::string>> env;           // set on top of ours, later entries win
+        std::optional<rlimit>                            nofile;        // RLIMIT_NOFILE for the child
+        bool                                             direct = true; // skip the shell for plain commands
+    };
+
+    struct SLaunchResult {
+        pid_t pid    = 0;
+        bool  direct = false;
+    };
+
+    // Starts a command with an empty signal mask and stdout/stderr on /dev/null. The child is
+    // created with clone(CLONE_VM | CLONE_VFORK), so unlike fork() none of our page tables get
+    // copied, which is most of the cost with a large address space. Everything the child needs
+    // is prepared up front, it only does async-signal-safe calls until exec.
+    std::expected<SLaunchResult, std::string> launchProcess(const SLaunchRequest& request);
+}
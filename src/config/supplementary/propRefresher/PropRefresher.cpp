@@ -27,10 +27,13 @@ UP<CPropRefresher>& Supplementary::refresher() {
     return p;
 }
 
-void CPropRefresher::scheduleRefresh(PropRefreshBits prop) {
+void CPropRefresher::scheduleRefresh(PropRefreshBits prop, bool onlyRuleSetChanged) {
 
     m_propsTripped |= prop;
 
+    if ((prop & REFRESH_RULES) && !onlyRuleSetChanged)
+        m_fullRuleRefresh = true;
+
     if (!m_scheduled && g_pEventLoopManager) {
         m_scheduledRefreshSeq = g_pEventLoopManager->doLater([this, weak = WP<CPropRefresher>{refresher()}] {
             if (!weak)
@@ -89,7 +92,10 @@ void CPropRefresher::refreshProp(const bool execdAsScheduled) {
     }
 
     if (m_propsTripped & REFRESH_WINDOW_STATES) {
-        Desktop::Rule::ruleEngine()->updateAllRules();
+        if (m_fullRuleRefresh)
+            Desktop::Rule::ruleEngine()->updateAllRules();
+        else
+            Desktop::Rule::ruleEngine()->updateChangedRules();
 
         for (auto const& w : Desktop::windowState()->windows())
             w->presentation().uncacheDecorations();
@@ -156,6 +162,7 @@ void CPropRefresher::refreshProp(const bool execdAsScheduled) {
     m_scheduled           = false;
     m_scheduledRefreshSeq = 0;
     m_propsTripped        = 0;
+    m_fullRuleRefresh     = false;
 
     Event::bus()->m_events.config.props_refreshed.emit(execdAsScheduled);
 }
@@ -25,7 +25,9 @@ namespace Config::Supplementary {
 
     class CPropRefresher {
       public:
-        void scheduleRefresh(PropRefreshBits reason);
+        // onlyRuleSetChanged: the rules themselves changed (config reload, new rules), but nothing they match against did.
+        // If that holds for everything that asked for REFRESH_RULES, only targets of changed rules are re-evaluated.
+        void scheduleRefresh(PropRefreshBits reason, bool onlyRuleSetChanged = false);
         int  executeScheduledRefreshImmediately();
 
       private:
@@ -34,6 +36,7 @@ namespace Config::Supplementary {
         bool            m_scheduled           = false;
         uint64_t        m_scheduledRefreshSeq = 0; // 0 if no refresh event scheduled
         PropRefreshBits m_propsTripped        = 0;
+        bool            m_fullRuleRefresh     = false;
     };
 
     UP<CPropRefresher>& refresher();
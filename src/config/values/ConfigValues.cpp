@@ -603,6 +603,9 @@ std::vector<SP<IValue>> Values::getConfigValues() {
         MS<String>("misc:bell_sound", "path to custom wav/ogg system bell. `none` or an empty string mute it. `default` uses the system's current one.", "default"),
         MS<Int>("misc:new_float_force_onscreen", "whether new floating windows must be placed fully/partially on-screen", 2),
         MS<Int>("misc:float_force_onscreen", "whether existing floating windows must remain fully/partially on-screen", 0),
+        MS<Int>("misc:socket2_queue_limit", "how many events can be queued for a socket2 client that isn't reading before the overflow policy kicks in", 64, {.min = 4, .max = 4096}),
+        MS<Int>("misc:socket2_overflow_policy", "what to do with a socket2 client whose queue is full", 0,
+                {.min = 0, .max = 2, .map = OptionMap{{"disconnect", 0}, {"drop_oldest", 1}, {"coalesce", 2}}}),
 
         /*
          * binds:
@@ -649,6 +652,7 @@ std::vector<SP<IValue>> Values::getConfigValues() {
         MS<Int>("render:direct_scanout", "Enables direct scanout.", 0, {.min = 0, .max = 2, .map = OptionMap{{"disable", 0}, {"enable", 1}, {"auto", 2}}}),
         MS<Bool>("render:expand_undersized_textures", "Whether to expand textures that have not yet resized to be larger.", true),
         MS<Bool>("render:xp_mode", "Disable back buffer and bottom layer rendering.", false),
+        MS<Bool>("render:retained_pass", "Reuse occlusion results of pass elements that did not change since the last frame.", true),
         MS<Int>("render:ctm_animation", "Whether to enable a fade animation for CTM changes.", 2,
                 {.min = 0, .max = 2, .map = OptionMap{{"disable", 0}, {"enable", 1}, {"auto", 2}}}),
         MS<Bool>("render:cm_enabled", "Enable Color Management pipelines (requires restart to fully take effect)", true),
@@ -671,6 +675,14 @@ std::vector<SP<IValue>> Values::getConfigValues() {
                 "Control fifo locking for not shown surfaces. always - use fifo lock for any surface, ignore_unfocused - ignore render_unfocused windows, never - skip locking "
                 "invisible surfaces",
                 0, {.min = 0, .max = 2, .map = OptionMap{{"always", 0}, {"ignore_unfocused", 1}, {"never", 2}}}),
+        MS<Bool>("render:shader_cache", "Cache compiled shader variants on disk and compile previously used ones ahead of time on startup. Requires restart", true),
+        MS<Float>("render:shm_upload_merge_waste",
+                  "When uploading shm buffers, merge damaged rects into one if at most this fraction of the merged rect is undamaged. 0 uploads every rect on its own", 0.3,
+                  {.min = 0, .max = 1}),
+        MS<Bool>("render:shm_upload_thread",
+                 "Upload shm buffers on a separate thread with a shared EGL context. Keeps a second texture for each shm surface, their first upload still happens on the main "
+                 "thread",
+                 false),
 
         /*
          * cursor:
@@ -731,6 +743,7 @@ std::vector<SP<IValue>> Values::getConfigValues() {
         MS<Bool>("debug:colored_stdout_logs", "enables colors in the stdout logs.", true),
         MS<Bool>("debug:log_damage", "enables logging the damage.", false),
         MS<Bool>("debug:pass", "enables render pass debugging.", false),
+        MS<Int>("debug:frametimes_event_interval", "if non-zero, post a frametimes socket2 event per monitor at most every this many ms.", 0, {.min = 0, .max = 60000}),
         MS<Bool>("debug:full_cm_proto", "claims support for all cm proto features (requires restart)", false),
         MS<Bool>("debug:ds_handle_same_buffer", "Special case for DS with unmodified buffer", true),
         MS<Bool>("debug:ds_handle_same_buffer_fifo", "Special case for DS with unmodified buffer unlocks fifo", true),
@@ -751,6 +764,10 @@ std::vector<SP<IValue>> Values::getConfigValues() {
                  Config::VEC2{0, 0}, {.validator = vec2Range(0, 0, 1000, 1000), .refresh = Supplementary::REFRESH_LAYOUTS}),
         MS<Float>("layout:single_window_aspect_ratio_tolerance", "Minimum distance for single_window_aspect_ratio to take effect.", 0.1F,
                   {.min = 0.F, .max = 1.F, .refresh = Supplementary::REFRESH_LAYOUTS}),
+        MS<Int>("layout:lua_timeout", "How long a lua layout's recalculate or layout_msg may run, in ms, before it's stopped and the default grid is used instead", 50,
+                {.min = 1, .max = 1000}),
+        MS<Int>("layout:lua_instruction_limit", "How many lua instructions a lua layout's recalculate or layout_msg may run before it's stopped. 0 means no limit", 0,
+                {.min = 0, .max = 1000000000}),
 
         /*
          * dwindle:
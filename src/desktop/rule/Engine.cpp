@@ -1,8 +1,15 @@
 #include "Engine.hpp"
 #include "Rule.hpp"
+#include "windowRule/WindowRule.hpp"
+#include "layerRule/LayerRule.hpp"
 #include "../view/LayerSurface.hpp"
 #include "../../Compositor.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <optional>
+#include <string_view>
+
 using namespace Desktop;
 using namespace Desktop::Rule;
 
@@ -13,6 +20,7 @@ SP<CRuleEngine> Rule::ruleEngine() {
 
 void CRuleEngine::registerRule(SP<IRule>&& rule) {
     m_rules.emplace_back(std::move(rule));
+    invalidateIndex();
 }
 
 void CRuleEngine::unregisterRule(const std::string& name) {
@@ -20,19 +28,74 @@ void CRuleEngine::unregisterRule(const std::string& name) {
         return;
 
     std::erase_if(m_rules, [&name](const auto& el) { return el->name() == name; });
+    invalidateIndex();
 }
 
 void CRuleEngine::unregisterRule(const SP<IRule>& rule) {
     std::erase(m_rules, rule);
     cleanExecRules();
+    invalidateIndex();
 }
 
 void CRuleEngine::cleanExecRules() {
-    std::erase_if(m_rules, [](const auto& e) { return e->isExecRule() && e->execExpired(); });
+    if (std::erase_if(m_rules, [](const auto& e) { return e->isExecRule() && e->execExpired(); }) > 0)
+        invalidateIndex();
 }
 
-void CRuleEngine::updateAllRules() {
-    cleanExecRules();
+std::optional<SRuleDiff> Rule::diffRuleSets(const std::vector<SAppliedRule>& before, const std::vector<SAppliedRule>& after) {
+    // keyed by the whole content, so a hash collision can't make two different rules look the same
+    std::unordered_map<std::string_view, int64_t> balance;
+    for (const auto& r : before) {
+        balance[r.content]++;
+    }
+    for (const auto& r : after) {
+        balance[r.content]--;
+    }
+
+    SRuleDiff                     diff;
+    std::vector<std::string_view> keptBefore, keptAfter;
+
+    auto                          removed = balance;
+    for (const auto& r : before) {
+        if (auto& n = removed[r.content]; n > 0) {
+            n--;
+            if (const auto RULE = r.rule.lock()) {
+                diff.rules.emplace_back(RULE);
+                diff.mutatedInPlace = diff.mutatedInPlace || std::ranges::any_of(after, [&RULE](const auto& a) { return a.rule.lock() == RULE; });
+            } else
+                diff.lostProps[r.type] |= r.props;
+        } else
+            keptBefore.emplace_back(r.content);
+    }
+
+    auto added = balance;
+    for (const auto& r : after) {
+        if (auto& n = added[r.content]; n < 0) {
+            n++;
+            diff.rules.emplace_back(r.rule.lock());
+        } else
+            keptAfter.emplace_back(r.content);
+    }
+
+    // rules that stayed also have to stay in the same order, as later rules override earlier ones
+    if (keptBefore != keptAfter)
+        return std::nullopt;
+
+    return diff;
+}
+
+void CRuleEngine::snapshotAppliedRules() {
+    m_appliedRules.clear();
+    m_appliedRules.reserve(m_rules.size());
+    for (const auto& r : m_rules) {
+        if (!r->isExecRule())
+            m_appliedRules.emplace_back(SAppliedRule{.content = r->contentKey(), .rule = r, .type = r->type(), .props = r->getPropertiesMask()});
+    }
+
+    m_appliedRulesValid = true;
+}
+
+void CRuleEngine::refreshAllTargets() {
     for (const auto& w : Desktop::windowState()->windows()) {
         if (!validMapped(w) || w->isHidden())
             continue;
@@ -47,10 +110,172 @@ void CRuleEngine::updateAllRules() {
     }
 }
 
+void CRuleEngine::updateAllRules() {
+    cleanExecRules();
+    snapshotAppliedRules();
+    refreshAllTargets();
+}
+
+void CRuleEngine::updateChangedRules() {
+    cleanExecRules();
+
+    const auto BEFORE = std::move(m_appliedRules);
+    const bool VALID  = m_appliedRulesValid;
+    snapshotAppliedRules();
+
+    const auto DIFF = VALID ? diffRuleSets(BEFORE, m_appliedRules) : std::nullopt;
+
+    if (!DIFF) {
+        refreshAllTargets();
+        return;
+    }
+
+    std::vector<SP<CWindowRule>>          windowRules;
+    std::vector<SP<CLayerRule>>           layerRules;
+    std::underlying_type_t<eRuleProperty> windowProps = RULE_PROP_NONE, layerProps = RULE_PROP_NONE;
+
+    for (const auto& r : DIFF->rules) {
+        switch (r->type()) {
+            case RULE_TYPE_WINDOW:
+                windowRules.emplace_back(reinterpretPointerCast<CWindowRule>(r));
+                windowProps |= r->getPropertiesMask();
+                break;
+            case RULE_TYPE_LAYER:
+                layerRules.emplace_back(reinterpretPointerCast<CLayerRule>(r));
+                layerProps |= r->getPropertiesMask();
+                break;
+        }
+    }
+
+    // Only targets matched by an added or removed rule can change. Resetting the props of those rules
+    // also rechecks unchanged rules sharing their effects, see CWindowRuleApplicator::propertiesChanged
+    if (!windowRules.empty() || DIFF->lostProps[RULE_TYPE_WINDOW]) {
+        for (const auto& w : Desktop::windowState()->windows()) {
+            if (!validMapped(w) || w->isHidden())
+                continue;
+
+            auto props = DIFF->lostProps[RULE_TYPE_WINDOW];
+            if (DIFF->mutatedInPlace || std::ranges::any_of(windowRules, [&w](const auto& r) { return r->matches(w); }))
+                props |= windowProps;
+
+            if (props)
+                w->m_ruleApplicator->propertiesChanged(props);
+        }
+    }
+
+    if (!layerRules.empty() || DIFF->lostProps[RULE_TYPE_LAYER]) {
+        for (const auto& ls : Desktop::layerState()->layers()) {
+            if (!validMapped(ls))
+                continue;
+
+            auto props = DIFF->lostProps[RULE_TYPE_LAYER];
+            if (DIFF->mutatedInPlace || std::ranges::any_of(layerRules, [&ls](const auto& r) { return r->matches(ls); }))
+                props |= layerProps;
+
+            if (props)
+                ls->m_ruleApplicator->propertiesChanged(props);
+        }
+    }
+}
+
 void CRuleEngine::clearAllRules() {
     std::erase_if(m_rules, [](const auto& e) { return !e->isExecRule() || e->execExpired(); });
+    invalidateIndex();
 }
 
 const std::vector<SP<IRule>>& CRuleEngine::rules() {
     return m_rules;
 }
+
+void CRuleEngine::invalidateIndex() {
+    m_index.dirty = true;
+}
+
+void CRuleEngine::rebuildIndex() {
+    for (auto& t : m_index.types) {
+        t.all.clear();
+        for (auto& b : t.byProp) {
+            b.clear();
+        }
+        t.byEffect.clear();
+    }
+
+    for (uint32_t i = 0; i < m_rules.size(); ++i) {
+        const auto& r    = m_rules[i];
+        const auto  TYPE = r->type();
+
+        if (sc<size_t>(TYPE) >= m_index.types.size())
+            continue;
+
+        auto& buckets = m_index.types[TYPE];
+        buckets.all.emplace_back(i);
+
+        for (auto mask = r->getPropertiesMask(); mask; mask &= mask - 1) {
+            buckets.byProp[std::countr_zero(mask)].emplace_back(i);
+        }
+
+        switch (TYPE) {
+            case RULE_TYPE_WINDOW:
+                for (const auto& e : reinterpretPointerCast<CWindowRule>(r)->effectsSet()) {
+                    buckets.byEffect[e].emplace_back(i);
+                }
+                break;
+            case RULE_TYPE_LAYER:
+                for (const auto& e : reinterpretPointerCast<CLayerRule>(r)->effectsSet()) {
+                    buckets.byEffect[e].emplace_back(i);
+                }
+                break;
+        }
+    }
+
+    m_index.serial = IRule::mutationSerial();
+    m_index.dirty  = false;
+}
+
+std::vector<SP<IRule>> CRuleEngine::candidates(eRuleType type, std::underlying_type_t<eRuleProperty> props, const std::unordered_set<effectStorageType>& effects) {
+    // rules are usually filled in after registration, so a mutation anywhere also makes us stale
+    if (m_index.dirty || m_index.serial != IRule::mutationSerial())
+        rebuildIndex();
+
+    std::vector<SP<IRule>> result;
+
+    if (sc<size_t>(type) >= m_index.types.size())
+        return result;
+
+    const auto& buckets = m_index.types[type];
+
+    if (props == RULE_PROP_ALL) {
+        result.reserve(buckets.all.size());
+        for (const auto& i : buckets.all) {
+            result.emplace_back(m_rules[i]);
+        }
+        return result;
+    }
+
+    std::vector<uint32_t> indices;
+
+    for (auto mask = props; mask; mask &= mask - 1) {
+        const auto& bucket = buckets.byProp[std::countr_zero(mask)];
+        indices.insert(indices.end(), bucket.begin(), bucket.end());
+    }
+
+    for (const auto& e : effects) {
+        const auto IT = buckets.byEffect.find(e);
+        if (IT == buckets.byEffect.end())
+            continue;
+
+        indices.insert(indices.end(), IT->second.begin(), IT->second.end());
+    }
+
+    // keep registration order, later rules override earlier ones
+    std::ranges::sort(indices);
+    const auto [first, last] = std::ranges::unique(indices);
+    indices.erase(first, last);
+
+    result.reserve(indices.size());
+    for (const auto& i : indices) {
+        result.emplace_back(m_rules[i]);
+    }
+
+    return result;
+}
@@ -1,8 +1,39 @@
 #pragma once
 
 #include "Rule.hpp"
+#include "windowRule/WindowRuleEffectContainer.hpp"
+#include "layerRule/LayerRuleEffectContainer.hpp"
+
+#include <array>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace Desktop::Rule {
+    using effectStorageType = CWindowRuleEffectContainer::storageType;
+    static_assert(std::is_same_v<effectStorageType, CLayerRuleEffectContainer::storageType>);
+
+    // a non-exec rule as of the last rule update
+    struct SAppliedRule {
+        std::string                           content; // IRule::contentKey()
+        WP<IRule>                             rule;
+        eRuleType                             type  = RULE_TYPE_WINDOW;
+        std::underlying_type_t<eRuleProperty> props = RULE_PROP_NONE;
+    };
+
+    struct SRuleDiff {
+        // changed rules we can still match against
+        std::vector<SP<IRule>> rules;
+        // props of removed rules that are gone already. Can't tell what they matched, so all targets of their type get these refreshed
+        std::array<std::underlying_type_t<eRuleProperty>, 2> lostProps = {RULE_PROP_NONE, RULE_PROP_NONE};
+        // a rule object changed while registered, its previous matches can't be evaluated anymore
+        bool mutatedInPlace = false;
+    };
+
+    // Rules added and removed between two snapshots. std::nullopt if rules that stayed changed their order,
+    // as later rules override earlier ones.
+    std::optional<SRuleDiff> diffRuleSets(const std::vector<SAppliedRule>& before, const std::vector<SAppliedRule>& after);
+
     class CRuleEngine {
       public:
         CRuleEngine()  = default;
@@ -12,13 +43,42 @@ namespace Desktop::Rule {
         void                          unregisterRule(const std::string& name);
         void                          unregisterRule(const SP<IRule>& rule);
         void                          updateAllRules();
+        // Like updateAllRules, but only touches targets an added or removed rule could affect. Only valid when nothing but
+        // the rule set changed since the last update (config reload), as unchanged rules aren't rechecked.
+        void                          updateChangedRules();
         void                          cleanExecRules();
         void                          clearAllRules();
         const std::vector<SP<IRule>>& rules();
 
+        // Rules of a type that may be affected by a change in props, or that carry one of the given effects.
+        // Returned in registration order, like rules().
+        std::vector<SP<IRule>> candidates(eRuleType type, std::underlying_type_t<eRuleProperty> props, const std::unordered_set<effectStorageType>& effects = {});
+
       private:
         std::vector<SP<IRule>> m_rules;
+
+        // non-exec rules as of the last update, lets a reload only touch what changed
+        std::vector<SAppliedRule> m_appliedRules;
+        bool                      m_appliedRulesValid = false;
+
+        void                      snapshotAppliedRules();
+        void                      refreshAllTargets();
+
+        struct SIndex {
+            struct STypeBuckets {
+                std::vector<uint32_t>                                        all;
+                std::array<std::vector<uint32_t>, 32>                        byProp;
+                std::unordered_map<effectStorageType, std::vector<uint32_t>> byEffect;
+            };
+
+            std::array<STypeBuckets, 2> types;
+            uint64_t                    serial = 0;
+            bool                        dirty  = true;
+        } m_index;
+
+        void invalidateIndex();
+        void rebuildIndex();
     };
 
     SP<CRuleEngine> ruleEngine();
-}
\ No newline at end of file
+}
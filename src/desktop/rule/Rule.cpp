@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <array>
+#include <format>
 #include <utility>
 
 using namespace Desktop;
@@ -83,10 +84,20 @@ std::optional<eRuleProperty> Rule::matchPropFromString(std::string_view s) {
     return MATCH_PROP_STRINGS.first[std::distance(MATCH_PROP_STRINGS.second.begin(), IT)];
 }
 
+static uint64_t ruleMutationSerial = 0;
+
 IRule::IRule(const std::string& name) : m_name(name) {
     ;
 }
 
+uint64_t IRule::mutationSerial() {
+    return ruleMutationSerial;
+}
+
+void IRule::bumpMutationSerial() {
+    ruleMutationSerial++;
+}
+
 void IRule::registerMatch(eRuleProperty p, const std::string& s) {
     const auto IT = std::ranges::lower_bound(RULE_ENGINES, p, {}, [](auto pair) { return pair.first; });
     if (IT == RULE_ENGINES.end() || IT->first != p) {
@@ -102,7 +113,10 @@ void IRule::registerMatch(eRuleProperty p, const std::string& s) {
         case RULE_MATCH_ENGINE_TAG: m_matchEngines[p] = makeUnique<CTagMatchEngine>(s); break;
     }
 
+    m_matchSources[p] = s;
     m_mask |= p;
+
+    bumpMutationSerial();
 }
 
 std::underlying_type_t<eRuleProperty> IRule::getPropertiesMask() {
@@ -143,6 +157,21 @@ const std::string& IRule::name() {
     return m_name;
 }
 
+std::string IRule::contentKey() {
+    // length prefixed, so no two different rules can end up with the same key
+    std::string key = std::format("{}|{}|", sc<int>(type()), m_enabled);
+
+    for (const auto& [prop, source] : m_matchSources) {
+        key += std::format("{}:{}:{}|", sc<uint64_t>(prop), source.size(), source);
+    }
+
+    return key;
+}
+
+size_t IRule::contentHash() {
+    return std::hash<std::string>{}(contentKey());
+}
+
 void IRule::markAsExecRule(const std::string& token, uint64_t pid, bool persistent) {
     m_execData.isExecRule       = true;
     m_execData.isExecPersistent = persistent;
@@ -5,6 +5,7 @@
 #include "../../helpers/memory/Memory.hpp"
 #include "../../helpers/time/Time.hpp"
 #include <vector>
+#include <map>
 #include <unordered_map>
 #include <optional>
 #include <span>
@@ -62,9 +63,18 @@ namespace Desktop::Rule {
 
         const std::string&                            name();
 
+        // everything that affects what this rule matches and applies, used to diff rule sets on reload
+        virtual std::string contentKey();
+        size_t              contentHash();
+
+        // bumped whenever any rule gains a matcher or an effect, see CRuleEngine::candidates
+        static uint64_t mutationSerial();
+
       protected:
         IRule(const std::string& name = "");
 
+        static void bumpMutationSerial();
+
         bool matches(eRuleProperty, const std::string& s);
         bool matches(eRuleProperty, bool b);
         bool has(eRuleProperty);
@@ -74,6 +84,7 @@ namespace Desktop::Rule {
         std::unordered_map<eRuleProperty, UP<IMatchEngine>> m_matchEngines;
 
       private:
+        std::map<eRuleProperty, std::string>  m_matchSources;
         std::underlying_type_t<eRuleProperty> m_mask    = 0;
         std::string                           m_name    = "";
         bool                                  m_enabled = true;
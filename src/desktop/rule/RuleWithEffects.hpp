@@ -3,6 +3,7 @@
 #include "Rule.hpp"
 
 #include <expected>
+#include <format>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -27,6 +28,7 @@ namespace Desktop::Rule {
 
             m_effects.emplace_back(TEffect{.key = e, .raw = result, .value = std::move(*parsed)});
             m_effectSet.emplace(e);
+            bumpMutationSerial();
 
             return {};
         }
@@ -39,6 +41,16 @@ namespace Desktop::Rule {
             return m_effectSet;
         }
 
+        std::string contentKey() override {
+            std::string key = IRule::contentKey();
+
+            for (const auto& e : m_effects) {
+                key += std::format("{}:{}:{}|", sc<uint64_t>(e.key), e.raw.size(), e.raw);
+            }
+
+            return key;
+        }
+
       protected:
         CRuleWithEffects(const std::string& name = "") : IRule(name) {}
 
@@ -47,6 +59,7 @@ namespace Desktop::Rule {
         std::expected<void, std::string>              addParsedEffect(storageType e, valueType value, std::string raw = {}) {
             m_effects.emplace_back(TEffect{.key = e, .raw = std::move(raw), .value = std::move(value)});
             m_effectSet.emplace(e);
+            bumpMutationSerial();
 
             return {};
         }
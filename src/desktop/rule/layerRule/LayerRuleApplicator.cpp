@@ -134,13 +134,7 @@ void CLayerRuleApplicator::propertiesChanged(std::underlying_type_t<eRulePropert
     // layers, due to effects overlapping on 0 prop intersection.
     // See WindowRule.cpp, and ::propertiesChanged there.
 
-    for (const auto& r : ruleEngine()->rules()) {
-        if (r->type() != RULE_TYPE_LAYER)
-            continue;
-
-        if (!(r->getPropertiesMask() & props))
-            continue;
-
+    for (const auto& r : ruleEngine()->candidates(RULE_TYPE_LAYER, props)) {
         auto wr = reinterpretPointerCast<CLayerRule>(r);
 
         if (!wr->matches(m_ls.lock()))
@@ -1,7 +1,28 @@
 #include "MatchEngine.hpp"
 
+#include <array>
+
 using namespace Desktop::Rule;
 
+static std::array<SMatchCacheStats, RULE_MATCH_ENGINE_COUNT> cacheStats;
+
+SMatchCacheStats& Desktop::Rule::matchCacheStats(eRuleMatchEngine engine) {
+    return cacheStats[engine];
+}
+
+const char* Desktop::Rule::matchEngineName(eRuleMatchEngine engine) {
+    switch (engine) {
+        case RULE_MATCH_ENGINE_REGEX: return "regex";
+        case RULE_MATCH_ENGINE_BOOL: return "bool";
+        case RULE_MATCH_ENGINE_INT: return "int";
+        case RULE_MATCH_ENGINE_WORKSPACE: return "workspace";
+        case RULE_MATCH_ENGINE_TAG: return "tag";
+        default: break;
+    }
+
+    return "unknown";
+}
+
 bool IMatchEngine::match(const std::string&) {
     return false;
 }
@@ -13,6 +13,18 @@ namespace Desktop::Rule {
         RULE_MATCH_ENGINE_TAG,
     };
 
+    constexpr size_t RULE_MATCH_ENGINE_COUNT = RULE_MATCH_ENGINE_TAG + 1;
+
+    struct SMatchCacheStats {
+        uint64_t hits     = 0;
+        uint64_t misses   = 0;
+        uint64_t uncached = 0;
+    };
+
+    // memoization counters of the caching engines, see hyprctl rulecache
+    SMatchCacheStats& matchCacheStats(eRuleMatchEngine engine);
+    const char*       matchEngineName(eRuleMatchEngine engine);
+
     class IMatchEngine {
       public:
         virtual ~IMatchEngine() = default;
@@ -3,6 +3,9 @@
 
 using namespace Desktop::Rule;
 
+// titles can change many times a second, don't let the cache grow unbounded
+constexpr size_t MAX_CACHED_VALUES = 64;
+
 CRegexMatchEngine::CRegexMatchEngine(const std::string& regex) {
     if (regex.starts_with("negative:")) {
         m_negative = true;
@@ -13,5 +16,19 @@ CRegexMatchEngine::CRegexMatchEngine(const std::string& regex) {
 }
 
 bool CRegexMatchEngine::match(const std::string& other) {
-    return re2::RE2::FullMatch(other, *m_regex) != m_negative;
-}
\ No newline at end of file
+    auto& stats = matchCacheStats(RULE_MATCH_ENGINE_REGEX);
+
+    if (const auto IT = m_cache.find(other); IT != m_cache.end()) {
+        stats.hits++;
+        return IT->second;
+    }
+
+    stats.misses++;
+
+    if (m_cache.size() >= MAX_CACHED_VALUES)
+        m_cache.clear();
+
+    const bool RESULT = re2::RE2::FullMatch(other, *m_regex) != m_negative;
+    m_cache.emplace(other, RESULT);
+    return RESULT;
+}
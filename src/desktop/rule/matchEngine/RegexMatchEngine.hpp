@@ -3,6 +3,8 @@
 #include "MatchEngine.hpp"
 #include "../../../helpers/memory/Memory.hpp"
 
+#include <unordered_map>
+
 //NOLINTNEXTLINE
 namespace re2 {
     class RE2;
@@ -17,7 +19,10 @@ namespace Desktop::Rule {
         virtual bool match(const std::string& other);
 
       private:
-        UP<re2::RE2> m_regex;
-        bool         m_negative = false;
+        UP<re2::RE2>                          m_regex;
+        bool                                  m_negative = false;
+
+        // results by matched value. Rules are re-evaluated far more often than titles and classes change.
+        std::unordered_map<std::string, bool> m_cache;
     };
-}
\ No newline at end of file
+}
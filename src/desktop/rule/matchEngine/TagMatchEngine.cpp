@@ -4,10 +4,26 @@
 
 using namespace Desktop::Rule;
 
+constexpr size_t MAX_CACHED_GENERATIONS = 64;
+
 CTagMatchEngine::CTagMatchEngine(const std::string& tag) : m_tag(tag) {
     ;
 }
 
 bool CTagMatchEngine::match(const CTagKeeper& keeper) {
-    return keeper.isTagged(m_tag);
+    auto& stats = matchCacheStats(RULE_MATCH_ENGINE_TAG);
+
+    if (const auto IT = m_cache.find(keeper.generation()); IT != m_cache.end()) {
+        stats.hits++;
+        return IT->second;
+    }
+
+    stats.misses++;
+
+    if (m_cache.size() >= MAX_CACHED_GENERATIONS)
+        m_cache.clear();
+
+    const bool RESULT = keeper.isTagged(m_tag);
+    m_cache.emplace(keeper.generation(), RESULT);
+    return RESULT;
 }
@@ -2,6 +2,7 @@
 
 #include "MatchEngine.hpp"
 #include <string>
+#include <unordered_map>
 
 namespace Desktop::Rule {
     class CTagMatchEngine : public IMatchEngine {
@@ -12,6 +13,9 @@ namespace Desktop::Rule {
         virtual bool match(const CTagKeeper& keeper);
 
       private:
-        std::string m_tag;
+        std::string                        m_tag;
+
+        // results by CTagKeeper::generation(), which identifies the tag set of a keeper
+        std::unordered_map<uint64_t, bool> m_cache;
     };
 }
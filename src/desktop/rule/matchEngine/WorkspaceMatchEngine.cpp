@@ -1,12 +1,39 @@
 #include "WorkspaceMatchEngine.hpp"
 #include "../../Workspace.hpp"
 
+#include <algorithm>
+#include <cctype>
+
 using namespace Desktop::Rule;
 
+constexpr size_t MAX_CACHED_WORKSPACES = 64;
+
 CWorkspaceMatchEngine::CWorkspaceMatchEngine(const std::string& s) : m_value(s) {
-    ;
+    m_cacheable = !m_value.empty() && (std::ranges::all_of(m_value, [](unsigned char c) { return std::isdigit(c); }) || m_value.starts_with("name:") || m_value.starts_with("special"));
 }
 
 bool CWorkspaceMatchEngine::match(PHLWORKSPACE ws) {
-    return ws && ws->matchesStaticSelector(m_value);
+    if (!ws)
+        return false;
+
+    auto& stats = matchCacheStats(RULE_MATCH_ENGINE_WORKSPACE);
+
+    if (!m_cacheable) {
+        stats.uncached++;
+        return ws->matchesStaticSelector(m_value);
+    }
+
+    if (const auto IT = m_cache.find(ws->m_id); IT != m_cache.end() && IT->second.name == ws->m_name) {
+        stats.hits++;
+        return IT->second.result;
+    }
+
+    stats.misses++;
+
+    if (m_cache.size() >= MAX_CACHED_WORKSPACES)
+        m_cache.clear();
+
+    const bool RESULT    = ws->matchesStaticSelector(m_value);
+    m_cache[ws->m_id]    = {.name = ws->m_name, .result = RESULT};
+    return RESULT;
 }
@@ -2,6 +2,7 @@
 
 #include "MatchEngine.hpp"
 #include <string>
+#include <unordered_map>
 
 namespace Desktop::Rule {
     class CWorkspaceMatchEngine : public IMatchEngine {
@@ -13,5 +14,15 @@ namespace Desktop::Rule {
 
       private:
         std::string m_value = "";
+
+        // Only selectors on the id or name are cached. Dynamic ones (w[], m[], f[]...)
+        // depend on state we can't cheaply track and are evaluated every time.
+        bool m_cacheable = false;
+
+        struct SCachedResult {
+            std::string name;
+            bool        result = false;
+        };
+        std::unordered_map<WORKSPACEID, SCachedResult> m_cache;
     };
 }
@@ -535,13 +535,7 @@ bool CWindowRuleApplicator::readStaticRules(bool preRead) {
 }
 
 void CWindowRuleApplicator::recheckStaticRules() {
-    for (const auto& r : ruleEngine()->rules()) {
-        if (r->type() != RULE_TYPE_WINDOW)
-            continue;
-
-        if (!(r->getPropertiesMask() & propsToRecheck))
-            continue;
-
+    for (const auto& r : ruleEngine()->candidates(RULE_TYPE_WINDOW, propsToRecheck)) {
         auto wr = reinterpretPointerCast<CWindowRule>(r);
 
         if (!wr->matches(m_window.lock(), true))
@@ -562,18 +556,12 @@ void CWindowRuleApplicator::propertiesChanged(std::underlying_type_t<eRuleProper
     bool                                                        needsRelayout         = false;
     std::unordered_set<CWindowRuleEffectContainer::storageType> effectsNeedingRecheck = resetProps(props);
 
-    for (const auto& r : ruleEngine()->rules()) {
-        if (r->type() != RULE_TYPE_WINDOW)
-            continue;
-
+    for (const auto& r : ruleEngine()->candidates(RULE_TYPE_WINDOW, props, effectsNeedingRecheck)) {
         const auto WR = reinterpretPointerCast<CWindowRule>(r);
 
         if (WR->isExecRule())
             continue;
 
-        if (!(WR->getPropertiesMask() & props) && !setsIntersect(WR->effectsSet(), effectsNeedingRecheck))
-            continue;
-
         if (!WR->matches(m_window.lock()))
             continue;
 
@@ -0,0 +1,74 @@
+#include "HitGrid.hpp"
+
+#include <hyprutils/memory/Casts.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+using namespace Desktop;
+using namespace Hyprutils::Memory;
+
+// boxes covering more cells than this aren't worth splitting up, e.g. dimaround windows
+constexpr int64_t MAX_CELLS_PER_ENTRY = 1024;
+
+CHitGrid::CHitGrid(double cellSize) : m_cellSize(cellSize) {
+    ;
+}
+
+void CHitGrid::clear() {
+    m_cells.clear();
+    m_unbounded.clear();
+    m_size = 0;
+}
+
+uint64_t CHitGrid::cellFor(int64_t x, int64_t y) const {
+    return (sc<uint64_t>(sc<uint32_t>(x)) << 32) | sc<uint32_t>(y);
+}
+
+void CHitGrid::insert(uint32_t id, const CBox& box) {
+    if (box.empty())
+        return;
+
+    const int64_t X1 = std::floor(box.x / m_cellSize), Y1 = std::floor(box.y / m_cellSize);
+    const int64_t X2 = std::floor((box.x + box.w) / m_cellSize), Y2 = std::floor((box.y + box.h) / m_cellSize);
+
+    m_size++;
+
+    if ((X2 - X1 + 1) * (Y2 - Y1 + 1) > MAX_CELLS_PER_ENTRY) {
+        m_unbounded.emplace_back(id);
+        return;
+    }
+
+    for (int64_t x = X1; x <= X2; ++x) {
+        for (int64_t y = Y1; y <= Y2; ++y) {
+            m_cells[cellFor(x, y)].emplace_back(id);
+        }
+    }
+}
+
+void CHitGrid::insertUnbounded(uint32_t id) {
+    m_unbounded.emplace_back(id);
+    m_size++;
+}
+
+const std::vector<uint32_t>& CHitGrid::at(const Vector2D& pos) const {
+    static const std::vector<uint32_t> EMPTY;
+
+    const auto                         IT   = m_cells.find(cellFor(std::floor(pos.x / m_cellSize), std::floor(pos.y / m_cellSize)));
+    const auto&                        CELL = IT == m_cells.end() ? EMPTY : IT->second;
+
+    if (m_unbounded.empty())
+        return CELL;
+
+    if (CELL.empty())
+        return m_unbounded;
+
+    m_result.clear();
+    std::ranges::merge(CELL, m_unbounded, std::back_inserter(m_result));
+    return m_result;
+}
+
+size_t CHitGrid::size() const {
+    return m_size;
+}
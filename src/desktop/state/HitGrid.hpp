@@ -0,0 +1,39 @@
+#pragma once
+
+#include "../../helpers/math/Math.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Desktop {
+    // Uniform grid over layout coordinates, used to narrow down point lookups before the exact checks.
+    // Ids have to be inserted in ascending order and come back in that order, so a caller can walk
+    // the result the same way it would walk the full stacking order.
+    class CHitGrid {
+      public:
+        CHitGrid(double cellSize = 256.0);
+        ~CHitGrid() = default;
+
+        void                         clear();
+        void                         insert(uint32_t id, const CBox& box);
+
+        // for entries without useful bounds, returned for every point
+        void                         insertUnbounded(uint32_t id);
+
+        // ids whose box may contain pos, ascending. Valid until the next call or modification.
+        const std::vector<uint32_t>& at(const Vector2D& pos) const;
+
+        size_t                       size() const;
+
+      private:
+        uint64_t                                            cellFor(int64_t x, int64_t y) const;
+
+        double                                              m_cellSize = 256.0;
+        std::unordered_map<uint64_t, std::vector<uint32_t>> m_cells;
+        std::vector<uint32_t>                               m_unbounded;
+        size_t                                              m_size = 0;
+
+        mutable std::vector<uint32_t>                       m_result;
+    };
+}
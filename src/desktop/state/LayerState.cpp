@@ -1,4 +1,5 @@
 #include "LayerState.hpp"
+#include "ViewState.hpp"
 #include "../../event/EventBus.hpp"
 #include "../view/LayerSurface.hpp"
 
@@ -22,10 +23,12 @@ const std::vector<PHLLS>& CLayerState::layers() const {
 
 void CLayerState::removeSafe(PHLLS ls) {
     std::erase_if(m_layers, [&ls](auto& el) { return !el || el == ls; });
+    viewState()->invalidateHitIndex();
 }
 
 void CLayerState::clear() {
     m_layers.clear();
+    viewState()->invalidateHitIndex();
 }
 
 UP<CLayerState>& Desktop::layerState() {
@@ -0,0 +1,80 @@
+#include "ViewHitIndex.hpp"
+#include "ViewStateTracker.hpp"
+#include "../view/LayerSurface.hpp"
+#include "../view/Popup.hpp"
+#include "../view/window/Window.hpp"
+#include "../../config/ConfigValue.hpp"
+#include "../../protocols/LayerShell.hpp"
+#include "../../protocols/core/Compositor.hpp"
+
+using namespace Desktop;
+using namespace Desktop::View;
+
+void CViewHitIndex::invalidate() {
+    m_dirty = true;
+}
+
+void CViewHitIndex::update(const IViewStateTracker& tracker) {
+    if (!m_dirty)
+        return;
+
+    static auto PBORDERSIZE       = CConfigValue<Config::INTEGER>("general:border_size");
+    static auto PBORDERGRABEXTEND = CConfigValue<Config::INTEGER>("general:extend_border_grab_area");
+
+    // covers the resize on border grab area and the tiled work area edge extension in windowAt
+    const auto  GRAB_AREA = *PBORDERSIZE + *PBORDERGRABEXTEND;
+
+    m_windows.clear();
+    m_layers.clear();
+
+    const auto& WINDOWS = tracker.windows();
+    for (uint32_t i = 0; i < WINDOWS.size(); ++i) {
+        const auto& w = WINDOWS[i];
+
+        // windowAt never returns these, mapping one invalidates us
+        if (!w->mapped() || !w->m_ruleApplicator)
+            continue;
+
+        // popups can go anywhere, and windows with open ones are few
+        if (w->popupMappedTreeSize() > 0) {
+            m_windows.insertUnbounded(i);
+            continue;
+        }
+
+        // extents only ever grow the box, so all of them together cover every set of properties windowAt can ask for
+        const auto BOX = CRegion{w->getWindowBoxUnified(RESERVED_EXTENTS | INPUT_EXTENTS | FULL_EXTENTS)}.add(w->layoutBox()).getExtents();
+
+        m_windows.insert(i, BOX.copy().expand(GRAB_AREA));
+    }
+
+    for (const auto& ls : tracker.layers()) {
+        if (!ls || !ls->m_layerSurface || !ls->m_layerSurface->m_surface)
+            continue;
+
+        m_layers[ls.get()] = {.extents = ls->m_layerSurface->m_surface->extends(), .popups = ls->popupMappedTreeSize() > 0};
+    }
+
+    m_dirty = false;
+    m_rebuilds++;
+}
+
+const std::vector<uint32_t>& CViewHitIndex::windowsAt(const Vector2D& pos) const {
+    return m_windows.at(pos);
+}
+
+bool CViewHitIndex::layerMayContain(const PHLLSREF& ls, const Vector2D& pos) const {
+    const auto IT = m_layers.find(ls.get());
+    if (IT == m_layers.end())
+        return true;
+
+    return IT->second.extents.copy().translate(ls->m_geometry.pos()).containsPoint(pos);
+}
+
+bool CViewHitIndex::layerHasPopups(const PHLLSREF& ls) const {
+    const auto IT = m_layers.find(ls.get());
+    return IT == m_layers.end() || IT->second.popups;
+}
+
+size_t CViewHitIndex::rebuilds() const {
+    return m_rebuilds;
+}
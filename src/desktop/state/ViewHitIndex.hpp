@@ -0,0 +1,42 @@
+#pragma once
+
+#include "HitGrid.hpp"
+#include "../DesktopTypes.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Desktop {
+    class IViewStateTracker;
+
+    // Broad phase for CViewHitTester. Holds conservative hit boxes of all windows and layers,
+    // the hit tester still does its exact checks on whatever comes out of here.
+    // Built lazily, anything that moves, resizes, restacks or adds / removes views has to invalidate it.
+    class CViewHitIndex {
+      public:
+        CViewHitIndex()  = default;
+        ~CViewHitIndex() = default;
+
+        void                         invalidate();
+        void                         update(const IViewStateTracker& tracker);
+
+        // indices into the tracker's windows(), bottom to top
+        const std::vector<uint32_t>& windowsAt(const Vector2D& pos) const;
+
+        bool                         layerMayContain(const PHLLSREF& ls, const Vector2D& pos) const;
+        bool                         layerHasPopups(const PHLLSREF& ls) const;
+
+        size_t                       rebuilds() const;
+
+      private:
+        struct SLayerEntry {
+            CBox extents; // surface tree, relative to the layer's geometry
+            bool popups = false;
+        };
+
+        CHitGrid                                                    m_windows;
+        std::unordered_map<const View::CLayerSurface*, SLayerEntry> m_layers;
+        bool                                                        m_dirty    = true;
+        size_t                                                      m_rebuilds = 0;
+    };
+}
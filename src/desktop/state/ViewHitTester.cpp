@@ -1,6 +1,7 @@
 #include "ViewHitTester.hpp"
 #include "FocusState.hpp"
 #include "ViewStateTracker.hpp"
+#include "ViewHitIndex.hpp"
 #include "../view/LayerSurface.hpp"
 #include "../view/WLSurface.hpp"
 #include "../view/window/Window.hpp"
@@ -14,8 +15,8 @@
 #include "../../managers/fullscreen/FullscreenController.hpp"
 
 #include <cmath>
+#include <optional>
 #include <ranges>
-#include <tuple>
 
 using namespace Desktop;
 using namespace Desktop::View;
@@ -41,12 +42,15 @@ PHLWINDOW CViewHitTester::windowAt(const Vector2D& pos, uint16_t properties, PHL
     const auto  HITBOX_SHRINK         = DO_FOLLOW_MOUSE_CHECK ? *PFOLLOWMOUSESHRINK : 0;
     const auto  LASTFOCUSED           = focusState()->window();
     const auto& WINDOWS               = m_tracker.windows();
+    const auto& CANDIDATES            = m_tracker.hitIndex().windowsAt(pos);
 
     const auto  isShadowedByModal = [](PHLWINDOW w) -> bool { return *PMODALPARENTBLOCKING && !w->backend().isX11() && w->backend().traits().hasModalChild; };
 
     // pinned windows on top of floating regardless
     if (properties & ALLOW_FLOATING) {
-        for (auto const& w : WINDOWS | std::views::reverse) {
+        for (const auto ID : CANDIDATES | std::views::reverse) {
+            const auto& w = WINDOWS[ID];
+
             if (ONLY_PRIORITY && !w->priorityFocus())
                 continue;
 
@@ -69,7 +73,9 @@ PHLWINDOW CViewHitTester::windowAt(const Vector2D& pos, uint16_t properties, PHL
 
     auto windowForWorkspace = [&](bool special) -> PHLWINDOW {
         auto floating = [&](bool aboveFullscreen) -> PHLWINDOW {
-            for (auto const& w : WINDOWS | std::views::reverse) {
+            for (const auto ID : CANDIDATES | std::views::reverse) {
+                const auto& w = WINDOWS[ID];
+
                 if (special && !w->onSpecialWorkspace()) // because special floating may creep up into regular
                     continue;
 
@@ -153,7 +159,9 @@ PHLWINDOW CViewHitTester::windowAt(const Vector2D& pos, uint16_t properties, PHL
             return found;
 
         // for windows, we need to check their extensions too, first.
-        for (auto const& w : WINDOWS) {
+        for (const auto ID : CANDIDATES) {
+            const auto& w = WINDOWS[ID];
+
             if (ONLY_PRIORITY && !w->priorityFocus())
                 continue;
 
@@ -170,7 +178,9 @@ PHLWINDOW CViewHitTester::windowAt(const Vector2D& pos, uint16_t properties, PHL
             }
         }
 
-        for (auto const& w : WINDOWS) {
+        for (const auto ID : CANDIDATES) {
+            const auto& w = WINDOWS[ID];
+
             if (ONLY_PRIORITY && !w->priorityFocus())
                 continue;
 
@@ -288,28 +298,26 @@ Vector2D CViewHitTester::surfaceLocalAt(const Vector2D& pos, PHLWINDOW window, S
     if (PPOPUP)
         return pos - PPOPUP->coordsGlobal();
 
-    std::tuple<SP<CWLSurfaceResource>, Vector2D> iterData = {surface, {-1337, -1337}};
-
-    window->wlSurface()->resource()->breadthfirst(
-        [](SP<CWLSurfaceResource> surf, const Vector2D& offset, void* data) {
-            const auto PDATA = sc<std::tuple<SP<CWLSurfaceResource>, Vector2D>*>(data);
-            if (surf == std::get<0>(*PDATA))
-                std::get<1>(*PDATA) = offset;
-        },
-        &iterData);
+    std::optional<Vector2D> surfaceOffset;
+    window->wlSurface()->resource()->breadthfirst([&surface, &surfaceOffset](const SP<CWLSurfaceResource>& surf, const Vector2D& offset) {
+        if (surf == surface)
+            surfaceOffset = offset;
+    });
 
     const CBox GEOMETRY = window->backend().geometry().box;
 
-    if (std::get<1>(iterData) == Vector2D{-1337, -1337})
+    if (!surfaceOffset)
         return pos - window->position(Desktop::View::IGeometric::GEOMETRIC_GOAL);
 
-    return pos - window->position(Desktop::View::IGeometric::GEOMETRIC_GOAL) - std::get<1>(iterData) + GEOMETRY.pos();
+    return pos - window->position(Desktop::View::IGeometric::GEOMETRIC_GOAL) - *surfaceOffset + GEOMETRY.pos();
 }
 
 SP<CWLSurfaceResource> CViewHitTester::layerPopupSurfaceAt(const Vector2D& pos, PHLMONITOR monitor, Vector2D* surfaceCoords, PHLLS* layerFound) const {
+    const auto& INDEX = m_tracker.hitIndex();
+
     for (auto const& lsl : monitor->m_layerSurfaceLayers | std::views::reverse) {
         for (auto const& ls : lsl | std::views::reverse) {
-            if (!ls->mapped() || !ls->acceptsInput())
+            if (!ls->mapped() || !ls->acceptsInput() || !INDEX.layerHasPopups(ls))
                 continue;
 
             auto SURFACEAT = ls->popupHead()->at(pos, true);
@@ -327,10 +335,15 @@ SP<CWLSurfaceResource> CViewHitTester::layerPopupSurfaceAt(const Vector2D& pos,
 
 SP<CWLSurfaceResource> CViewHitTester::layerSurfaceAt(const Vector2D& pos, std::vector<PHLLSREF>* layerSurfaces, Vector2D* surfaceCoords, PHLLS* layerFound,
                                                       bool aboveLockscreen) const {
+    const auto& INDEX = m_tracker.hitIndex();
+
     for (auto const& ls : *layerSurfaces | std::views::reverse) {
         if (!ls->mapped() || !ls->acceptsInput() || (aboveLockscreen && ls->m_ruleApplicator->aboveLock().valueOrDefault() != 2))
             continue;
 
+        if (!INDEX.layerMayContain(ls, pos))
+            continue;
+
         auto [surf, local] = ls->m_layerSurface->m_surface->at(pos - ls->m_geometry.pos(), true);
 
         if (surf) {
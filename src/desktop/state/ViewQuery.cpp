@@ -280,14 +280,12 @@ PHLLS CViewQuery::layerBySurface() const {
         if (ls->m_layerSurface->m_surface == *m_surface)
             return ls;
 
-        ls->m_layerSurface->m_surface->breadthfirst(
-            [&result](SP<CWLSurfaceResource> surf, const Vector2D& offset, void* data) {
-                if (surf == result.first) {
-                    result.second = true;
-                    return;
-                }
-            },
-            nullptr);
+        ls->m_layerSurface->m_surface->breadthfirst([&result](const SP<CWLSurfaceResource>& surf, const Vector2D& offset) {
+            if (surf == result.first) {
+                result.second = true;
+                return;
+            }
+        });
 
         if (result.second)
             return ls;
@@ -2,9 +2,28 @@
 #include "LayerState.hpp"
 #include "OtherViewState.hpp"
 #include "WindowState.hpp"
+#include "../../event/EventBus.hpp"
 
 using namespace Desktop;
 
+CViewState::CViewState() {
+    const auto INVALIDATE = [this](auto&&...) { invalidateHitIndex(); };
+
+    m_listeners.viewCreate            = Event::bus()->m_events.view.create.listen(INVALIDATE);
+    m_listeners.viewDestroy           = Event::bus()->m_events.view.destroy.listen(INVALIDATE);
+    m_listeners.windowOpen            = Event::bus()->m_events.window.open.listen(INVALIDATE);
+    m_listeners.windowClose           = Event::bus()->m_events.window.close.listen(INVALIDATE);
+    m_listeners.windowFloating        = Event::bus()->m_events.window.floating.listen(INVALIDATE);
+    m_listeners.windowFullscreen      = Event::bus()->m_events.window.fullscreen.listen(INVALIDATE);
+    m_listeners.windowPin             = Event::bus()->m_events.window.pin.listen(INVALIDATE);
+    m_listeners.windowMoveToWorkspace = Event::bus()->m_events.window.moveToWorkspace.listen(INVALIDATE);
+    m_listeners.windowUpdateRules     = Event::bus()->m_events.window.updateRules.listen(INVALIDATE);
+    m_listeners.layerOpened           = Event::bus()->m_events.layer.opened.listen(INVALIDATE);
+    m_listeners.layerClosed           = Event::bus()->m_events.layer.closed.listen(INVALIDATE);
+    m_listeners.monitorLayoutChanged  = Event::bus()->m_events.monitor.layoutChanged.listen(INVALIDATE);
+    m_listeners.configReloaded        = Event::bus()->m_events.config.reloaded.listen(INVALIDATE);
+}
+
 const std::vector<PHLWINDOW>& CViewState::windows() const {
     return windowState()->windows();
 }
@@ -17,6 +36,15 @@ const std::vector<PHLVIEWREF>& CViewState::otherViews() const {
     return otherViewState()->views();
 }
 
+const CViewHitIndex& CViewState::hitIndex() const {
+    m_hitIndex.update(*this);
+    return m_hitIndex;
+}
+
+void CViewState::invalidateHitIndex() {
+    m_hitIndex.invalidate();
+}
+
 UP<CViewState>& Desktop::viewState() {
     static UP<CViewState> state = makeUnique<CViewState>();
     return state;
@@ -1,17 +1,33 @@
 #pragma once
 
 #include "ViewStateTracker.hpp"
+#include "ViewHitIndex.hpp"
 #include "../../helpers/memory/Memory.hpp"
+#include "../../helpers/signal/Signal.hpp"
 
 namespace Desktop {
     class CViewState : public IViewStateTracker {
       public:
-        CViewState()                   = default;
+        CViewState();
         virtual ~CViewState() override = default;
 
         virtual const std::vector<PHLWINDOW>&  windows() const override;
         virtual const std::vector<PHLLS>&      layers() const override;
         virtual const std::vector<PHLVIEWREF>& otherViews() const override;
+        virtual const CViewHitIndex&           hitIndex() const override;
+
+        // call when a view's hit box, stacking or popups changed in a way the listeners below don't see
+        void                                   invalidateHitIndex();
+
+      private:
+        mutable CViewHitIndex m_hitIndex;
+
+        struct {
+            CHyprSignalListener viewCreate, viewDestroy;
+            CHyprSignalListener windowOpen, windowClose, windowFloating, windowFullscreen, windowPin, windowMoveToWorkspace, windowUpdateRules;
+            CHyprSignalListener layerOpened, layerClosed;
+            CHyprSignalListener monitorLayoutChanged, configReloaded;
+        } m_listeners;
     };
 
     UP<CViewState>& viewState();
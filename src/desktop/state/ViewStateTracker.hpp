@@ -7,6 +7,8 @@
 #include <vector>
 
 namespace Desktop {
+    class CViewHitIndex;
+
     class IViewStateTracker {
       public:
         virtual ~IViewStateTracker() = default;
@@ -14,6 +16,7 @@ namespace Desktop {
         virtual const std::vector<PHLWINDOW>&  windows() const    = 0;
         virtual const std::vector<PHLLS>&      layers() const     = 0;
         virtual const std::vector<PHLVIEWREF>& otherViews() const = 0;
+        virtual const CViewHitIndex&           hitIndex() const   = 0;
 
         virtual CViewQuery                     query() const;
         virtual CViewHitTester                 hitTest() const;
@@ -1,4 +1,5 @@
 #include "WindowState.hpp"
+#include "ViewState.hpp"
 #include "../../event/EventBus.hpp"
 #include "../../render/Renderer.hpp"
 #include "../view/window/Window.hpp"
@@ -22,6 +23,7 @@ CWindowState::CWindowState() {
 
 void CWindowState::removeSafe(PHLWINDOW w) {
     std::erase_if(m_windows, [&w](auto& el) { return !el || el == w; });
+    viewState()->invalidateHitIndex();
 }
 
 const std::vector<PHLWINDOW>& CWindowState::windows() const {
@@ -105,6 +107,7 @@ void CWindowState::moveToTop(PHLWINDOW w) {
             continue;
 
         std::rotate(it, it + 1, m_windows.end());
+        viewState()->invalidateHitIndex();
         return;
     }
 }
@@ -118,12 +121,14 @@ void CWindowState::moveToBottom(PHLWINDOW w) {
             continue;
 
         std::rotate(it, it + 1, m_windows.rend());
+        viewState()->invalidateHitIndex();
         return;
     }
 }
 
 void CWindowState::clear() {
     m_windows.clear();
+    viewState()->invalidateHitIndex();
 }
 
 UP<CWindowState>& Desktop::windowState() {
@@ -26,23 +26,21 @@ std::vector<SP<IView>> View::getViewsForWorkspace(PHLWORKSPACE ws) {
 
         views.emplace_back(w);
 
-        w->wlSurface()->resource()->breadthfirst(
-            [&views](SP<CWLSurfaceResource> s, const Vector2D& pos, void* data) {
-                auto surf = CWLSurface::fromResource(s);
-                if (!surf || !s->m_mapped)
-                    return;
+        w->wlSurface()->resource()->breadthfirst([&views](const SP<CWLSurfaceResource>& s, const Vector2D& pos) {
+            auto surf = CWLSurface::fromResource(s);
+            if (!surf || !s->m_mapped)
+                return;
 
-                const auto view = surf->view();
-                if (!view || !view->mapped() || !view->acceptsInput())
-                    return;
+            const auto view = surf->view();
+            if (!view || !view->mapped() || !view->acceptsInput())
+                return;
 
-                const auto alphaModifier = dynamicPointerCast<IAlphaModifiable>(view);
-                if (alphaModifier && !alphaModifier->alphaNonZero())
-                    return;
+            const auto alphaModifier = dynamicPointerCast<IAlphaModifiable>(view);
+            if (alphaModifier && !alphaModifier->alphaNonZero())
+                return;
 
-                views.emplace_back(view);
-            },
-            nullptr);
+            views.emplace_back(view);
+        });
 
         // xwl windows dont have this
         if (w->popupHead()) {
@@ -3,6 +3,7 @@
 #include "../state/FadingOutState.hpp"
 #include "../state/LayerState.hpp"
 #include "../state/LayerFadeout.hpp"
+#include "../state/ViewState.hpp"
 #include "../../Compositor.hpp"
 #include "../../protocols/LayerShell.hpp"
 #include "../../protocols/core/Compositor.hpp"
@@ -311,6 +312,9 @@ void CLayerSurface::onCommit() {
         return;
     }
 
+    // size or subsurfaces might've changed
+    Desktop::viewState()->invalidateHitIndex();
+
     const auto PMONITOR = m_monitor.lock();
 
     if (!PMONITOR)
@@ -383,8 +387,7 @@ void CLayerSurface::onCommit() {
     if (m_mapped && (m_layerSurface->m_current.committed & CLayerShellResource::eCommittedState::STATE_KEYBOARD_INTERACTIVITY)) {
         bool WASLASTFOCUS = false;
         m_layerSurface->m_surface->breadthfirst(
-            [&WASLASTFOCUS](SP<CWLSurfaceResource> surf, const Vector2D& offset, void* data) { WASLASTFOCUS = WASLASTFOCUS || g_pSeatManager->m_state.keyboardFocus == surf; },
-            nullptr);
+            [&WASLASTFOCUS](const SP<CWLSurfaceResource>& surf, const Vector2D& offset) { WASLASTFOCUS = WASLASTFOCUS || g_pSeatManager->m_state.keyboardFocus == surf; });
         if (!WASLASTFOCUS && popupHead()) {
             popupHead()->breadthfirst(
                 [&WASLASTFOCUS](WP<Desktop::View::CPopup> popup, void* data) {
@@ -453,17 +456,15 @@ void CLayerSurface::updateSurfaceScaleTransformDetails() {
     if (!surf)
         return;
 
-    surf->breadthfirst(
-        [PMONITOR](SP<CWLSurfaceResource> s, const Vector2D& offset, void* d) {
-            const auto PSURFACE = CWLSurface::fromResource(s);
+    surf->breadthfirst([PMONITOR](const SP<CWLSurfaceResource>& s, const Vector2D& offset) {
+        const auto PSURFACE = CWLSurface::fromResource(s);
 
-            if (!PSURFACE)
-                return;
+        if (!PSURFACE)
+            return;
 
-            PSURFACE->sendScale(PMONITOR->m_scale);
-            PSURFACE->sendTransform(PMONITOR->m_transform);
-        },
-        nullptr);
+        PSURFACE->sendScale(PMONITOR->m_scale);
+        PSURFACE->sendTransform(PMONITOR->m_transform);
+    });
 }
 
 Types::CMultiAVarContainer<float, uint8_t>& CLayerSurface::alpha() {
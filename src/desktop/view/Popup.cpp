@@ -5,6 +5,7 @@
 #include "../../Compositor.hpp"
 #include "../state/FadingOutState.hpp"
 #include "../state/PopupFadeout.hpp"
+#include "../state/ViewState.hpp"
 #include "../../../protocols/wlr-layer-shell-unstable-v1.hpp"
 #include "../../protocols/core/Compositor.hpp"
 #include "../../managers/SeatManager.hpp"
@@ -212,6 +213,7 @@ void CPopup::onMap() {
     m_lastPos = coordsRelativeToParent();
 
     invalidateTreeExtentsCache();
+    Desktop::viewState()->invalidateHitIndex();
 
     g_pInputManager->simulateMouseMovement();
 
@@ -219,7 +221,7 @@ void CPopup::onMap() {
 
     //unconstrain();
     sendScale();
-    m_wlSurface->resource()->breadthfirst([PMONITOR](SP<CWLSurfaceResource> s, const Vector2D& offset, void* d) { s->enter(PMONITOR->m_self.lock()); }, nullptr);
+    m_wlSurface->resource()->breadthfirst([PMONITOR](const SP<CWLSurfaceResource>& s, const Vector2D& offset) { s->enter(PMONITOR->m_self.lock()); });
 
     if (!m_layerOwner.expired() && m_layerOwner->m_layer < ZWLR_LAYER_SHELL_V1_LAYER_TOP) {
         if (m_layerOwner->m_monitor)
@@ -485,16 +487,14 @@ void CPopup::sendScale() {
     // those subsurfaces at the default 1.0 fractional scale, so under
     // fractional scaling the content renders at the wrong size and the input
     // geometry desyncs from the visible geometry. Mirrors CWindow::sendScale.
-    m_wlSurface->resource()->breadthfirst(
-        [PMONITOR](SP<CWLSurfaceResource> s, const Vector2D& offset, void* d) {
-            const auto PSURFACE = CWLSurface::fromResource(s);
+    m_wlSurface->resource()->breadthfirst([PMONITOR](const SP<CWLSurfaceResource>& s, const Vector2D& offset) {
+        const auto PSURFACE = CWLSurface::fromResource(s);
 
-            if (!PSURFACE)
-                return;
+        if (!PSURFACE)
+            return;
 
-            PSURFACE->sendScale(PMONITOR->m_scale);
-        },
-        nullptr);
+        PSURFACE->sendScale(PMONITOR->m_scale);
+    });
 }
 
 void CPopup::bfHelper(std::span<const SP<CPopup>> nodes, std::function<void(SP<CPopup>, void*)> fn, void* data) {
@@ -28,6 +28,7 @@
 #include "../../state/FocusState.hpp"
 #include "../../state/FloatState.hpp"
 #include "../../state/FadingOutState.hpp"
+#include "../../state/ViewState.hpp"
 #include "../../state/GlobalWindowController.hpp"
 #include "../../state/WindowFadeout.hpp"
 #include "../../state/WindowState.hpp"
@@ -398,24 +399,22 @@ void CWindow::updateSurfaceScaleTransformDetails(bool force) {
 
     if (PNEWMONITOR != PLASTMONITOR || force) {
         if (PLASTMONITOR && PLASTMONITOR->m_enabled && PNEWMONITOR != PLASTMONITOR)
-            m_wlSurface->resource()->breadthfirst([PLASTMONITOR](SP<CWLSurfaceResource> s, const Vector2D& offset, void* d) { s->leave(PLASTMONITOR->m_self.lock()); }, nullptr);
+            m_wlSurface->resource()->breadthfirst([PLASTMONITOR](const SP<CWLSurfaceResource>& s, const Vector2D& offset) { s->leave(PLASTMONITOR->m_self.lock()); });
 
-        m_wlSurface->resource()->breadthfirst([PNEWMONITOR](SP<CWLSurfaceResource> s, const Vector2D& offset, void* d) { s->enter(PNEWMONITOR->m_self.lock()); }, nullptr);
+        m_wlSurface->resource()->breadthfirst([PNEWMONITOR](const SP<CWLSurfaceResource>& s, const Vector2D& offset) { s->enter(PNEWMONITOR->m_self.lock()); });
     }
 
     const auto PMONITOR = m_monitor.lock();
 
-    m_wlSurface->resource()->breadthfirst(
-        [PMONITOR](SP<CWLSurfaceResource> s, const Vector2D& offset, void* d) {
-            const auto PSURFACE = CWLSurface::fromResource(s);
+    m_wlSurface->resource()->breadthfirst([PMONITOR](const SP<CWLSurfaceResource>& s, const Vector2D& offset) {
+        const auto PSURFACE = CWLSurface::fromResource(s);
 
-            if (!PSURFACE)
-                return;
+        if (!PSURFACE)
+            return;
 
-            PSURFACE->sendScale(PMONITOR->m_scale);
-            PSURFACE->sendTransform(PMONITOR->m_transform);
-        },
-        nullptr);
+        PSURFACE->sendScale(PMONITOR->m_scale);
+        PSURFACE->sendTransform(PMONITOR->m_transform);
+    });
 }
 
 void CWindow::moveToWorkspace(PHLWORKSPACE pWorkspace) {
@@ -559,6 +558,8 @@ void CWindow::onMap() {
         false);
 
     m_realSize->setUpdateCallback([this](auto) {
+        Desktop::viewState()->invalidateHitIndex();
+
         if (!m_isMapped)
             return;
 
@@ -568,6 +569,8 @@ void CWindow::onMap() {
     });
 
     m_realPosition->setUpdateCallback([this](auto) {
+        Desktop::viewState()->invalidateHitIndex();
+
         if (!m_isMapped)
             return;
 
@@ -57,15 +57,15 @@ static SBackendTraits traitsFrom(const SP<CXWaylandSurface>& surface) {
 
 #ifndef NO_XWAYLAND
     static const std::array FLOATING_ATOMS = {
-        HYPRATOMS["_NET_WM_WINDOW_TYPE_DIALOG"],       HYPRATOMS["_NET_WM_WINDOW_TYPE_SPLASH"],        HYPRATOMS["_NET_WM_WINDOW_TYPE_TOOLBAR"],
-        HYPRATOMS["_NET_WM_WINDOW_TYPE_UTILITY"],      HYPRATOMS["_NET_WM_WINDOW_TYPE_TOOLTIP"],       HYPRATOMS["_NET_WM_WINDOW_TYPE_POPUP_MENU"],
-        HYPRATOMS["_NET_WM_WINDOW_TYPE_DOCK"],         HYPRATOMS["_NET_WM_WINDOW_TYPE_DROPDOWN_MENU"], HYPRATOMS["_NET_WM_WINDOW_TYPE_MENU"],
-        HYPRATOMS["_KDE_NET_WM_WINDOW_TYPE_OVERRIDE"],
+        HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_DIALOG],       HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_SPLASH],        HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_TOOLBAR],
+        HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_UTILITY],      HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_TOOLTIP],       HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_POPUP_MENU],
+        HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_DOCK],         HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_DROPDOWN_MENU], HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_MENU],
+        HYPRATOMS[ATOM_KDE_NET_WM_WINDOW_TYPE_OVERRIDE],
     };
     static const std::array NO_BORDER_ATOMS = {
-        HYPRATOMS["_NET_WM_WINDOW_TYPE_POPUP_MENU"], HYPRATOMS["_NET_WM_WINDOW_TYPE_NOTIFICATION"], HYPRATOMS["_NET_WM_WINDOW_TYPE_DROPDOWN_MENU"],
-        HYPRATOMS["_NET_WM_WINDOW_TYPE_COMBO"],      HYPRATOMS["_NET_WM_WINDOW_TYPE_MENU"],         HYPRATOMS["_NET_WM_WINDOW_TYPE_SPLASH"],
-        HYPRATOMS["_NET_WM_WINDOW_TYPE_TOOLTIP"],
+        HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_POPUP_MENU], HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_NOTIFICATION], HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_DROPDOWN_MENU],
+        HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_COMBO],      HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_MENU],         HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_SPLASH],
+        HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_TOOLTIP],
     };
 
     for (const auto atom : surface->m_atoms) {
@@ -73,8 +73,8 @@ static SBackendTraits traitsFrom(const SP<CXWaylandSurface>& surface) {
             continue;
 
         FLOATING_ATOM         = true;
-        NO_INITIAL_FOCUS_ATOM = atom != HYPRATOMS["_NET_WM_WINDOW_TYPE_DIALOG"];
-        PREVENTS_FOCUS_ATOM   = atom == HYPRATOMS["_NET_WM_WINDOW_TYPE_DROPDOWN_MENU"] || atom == HYPRATOMS["_NET_WM_WINDOW_TYPE_MENU"];
+        NO_INITIAL_FOCUS_ATOM = atom != HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_DIALOG];
+        PREVENTS_FOCUS_ATOM   = atom == HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_DROPDOWN_MENU] || atom == HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_MENU];
         break;
     }
     NO_BORDER_ATOM = hasAnyAtom(surface, NO_BORDER_ATOMS);
@@ -2,6 +2,12 @@
 
 #include <format>
 
+static uint64_t lastGeneration = 0;
+
+void CTagKeeper::bumpGeneration() {
+    m_generation = ++lastGeneration;
+}
+
 bool CTagKeeper::isTagged(const std::string& tag, bool strict) const {
     const bool NEGATIVE = tag.starts_with("negative");
     const auto MATCH    = NEGATIVE ? tag.substr(9) : tag;
@@ -37,12 +43,15 @@ bool CTagKeeper::applyTag(const std::string& tag, bool dynamic) {
     else
         m_tags.erase(tagReal);
 
+    bumpGeneration();
+
     return true;
 }
 
 bool CTagKeeper::clearTags() {
     if (!m_tags.empty()) {
         m_tags.clear();
+        bumpGeneration();
         return true;
     }
 
@@ -50,5 +59,9 @@ bool CTagKeeper::clearTags() {
 }
 
 bool CTagKeeper::removeDynamicTag(const std::string& s) {
-    return std::erase_if(m_tags, [&s](const auto& tag) { return tag == std::format("{}*", s); });
+    if (!std::erase_if(m_tags, [&s](const auto& tag) { return tag == std::format("{}*", s); }))
+        return false;
+
+    bumpGeneration();
+    return true;
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <set>
 
@@ -14,6 +15,15 @@ class CTagKeeper {
         return m_tags;
     };
 
+    // changes on every tag mutation and is taken from a counter shared by all keepers, so equal values imply equal tag sets.
+    // Keepers that never had tags are all at 0. The same tags in two keepers still give different values.
+    uint64_t generation() const {
+        return m_generation;
+    }
+
   private:
+    void                  bumpGeneration();
+
     std::set<std::string> m_tags;
+    uint64_t              m_generation = 0;
 };
@@ -54,6 +54,36 @@ std::optional<std::string> NFsUtils::getDataHome() {
     return dataRoot;
 }
 
+std::optional<std::string> NFsUtils::getCacheHome() {
+    const auto  CACHE_HOME = getenv("XDG_CACHE_HOME");
+
+    std::string cacheRoot;
+
+    if (!CACHE_HOME) {
+        const auto HOME = getenv("HOME");
+
+        if (!HOME) {
+            Log::logger->log(Log::ERR, "FsUtils::getCacheHome: can't get cache home: no $HOME or $XDG_CACHE_HOME");
+            return std::nullopt;
+        }
+
+        cacheRoot = HOME + std::string{"/.cache/"};
+    } else
+        cacheRoot = CACHE_HOME + std::string{"/"};
+
+    cacheRoot += "hyprland/";
+
+    // unlike data home, a missing cache root is normal on a fresh system
+    std::error_code ec;
+    std::filesystem::create_directories(cacheRoot, ec);
+    if (ec || !std::filesystem::is_directory(cacheRoot, ec)) {
+        Log::logger->log(Log::ERR, "FsUtils::getCacheHome: can't create cache home for hyprland");
+        return std::nullopt;
+    }
+
+    return cacheRoot;
+}
+
 std::optional<std::string> NFsUtils::readFileAsString(const std::string& path) {
     std::error_code ec;
 
@@ -6,6 +6,9 @@ namespace NFsUtils {
     // Returns the path to the hyprland directory in data home.
     std::optional<std::string> getDataHome();
 
+    // Returns the path to the hyprland directory in cache home, creating it if needed.
+    std::optional<std::string> getCacheHome();
+
     std::optional<std::string> readFileAsString(const std::string& path);
 
     // overwrites the file if exists
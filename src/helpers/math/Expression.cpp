@@ -62,3 +62,52 @@ std::optional<double> CExpression::compute(const std::string& expr) {
 
     return std::nullopt;
 }
+
+CExpressionCache::CExpressionCache(std::vector<std::string> variables, size_t maxEntries) :
+    m_variables(std::move(variables)), m_slots(m_variables.size(), 0.0), m_maxEntries(maxEntries) {
+    ;
+}
+
+void CExpressionCache::setVariable(size_t slot, double val) {
+    m_slots[slot] = val;
+}
+
+std::optional<double> CExpressionCache::compute(const std::string& expr) {
+    auto it = m_parsers.find(expr);
+
+    if (it == m_parsers.end()) {
+        // expressions come from rules and dispatchers, but anything typed into hyprctl ends up here too
+        if (m_parsers.size() >= m_maxEntries)
+            m_parsers.clear();
+
+        auto parser = makeUnique<mu::Parser>();
+
+        try {
+            for (size_t i = 0; i < m_variables.size(); ++i) {
+                parser->DefineVar(m_variables[i], &m_slots[i]);
+            }
+
+            parser->SetExpr(expr);
+            // mu parses lazily, have errors show up now, not on some later evaluation
+            parser->Eval();
+        } catch (mu::Parser::exception_type& e) {
+            Log::logger->log(Log::ERR, "CExpressionCache::compute: mu threw: {}", e.GetMsg());
+            parser.reset();
+        }
+
+        it = m_parsers.emplace(expr, std::move(parser)).first;
+    }
+
+    if (!it->second)
+        return std::nullopt;
+
+    try {
+        return it->second->Eval();
+    } catch (mu::Parser::exception_type& e) { Log::logger->log(Log::ERR, "CExpressionCache::compute: mu threw: {}", e.GetMsg()); }
+
+    return std::nullopt;
+}
+
+size_t CExpressionCache::size() const {
+    return m_parsers.size();
+}
@@ -5,6 +5,8 @@
 #include <string>
 #include <optional>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace mu {
     class Parser;
@@ -37,4 +39,27 @@ namespace Math {
       private:
         UP<mu::Parser> m_parser;
     };
+
+    // Parses every expression once and keeps it. Variables are bound by slot, so changing
+    // one between evaluations doesn't reparse anything.
+    class CExpressionCache {
+      public:
+        CExpressionCache(std::vector<std::string> variables, size_t maxEntries = 256);
+        ~CExpressionCache() = default;
+
+        CExpressionCache(const CExpressionCache&) = delete;
+        CExpressionCache(CExpressionCache&&)      = delete;
+
+        void                  setVariable(size_t slot, double val);
+
+        std::optional<double> compute(const std::string& expr);
+
+        size_t                size() const;
+
+      private:
+        std::vector<std::string>                        m_variables;
+        std::vector<double>                             m_slots; // never resized, the parsers point into it
+        std::unordered_map<std::string, UP<mu::Parser>> m_parsers; // null for expressions that failed to parse
+        size_t                                          m_maxEntries = 0;
+    };
 };
@@ -1,9 +1,11 @@
 #include "Commands.hpp"
+#include "StructuredWriter.hpp"
 #include "../../desktop/view/window/WindowFullscreenPolicy.hpp"
 #include "../../desktop/view/window/WindowGroupMembership.hpp"
 #include "../../desktop/view/window/WindowPresentation.hpp"
 #include "../../desktop/view/window/WindowSwallowController.hpp"
 #include "../../output/Monitor.hpp"
+#include "../../output/MonitorFrameScheduler.hpp"
 
 #include <algorithm>
 #include <array>
@@ -29,6 +31,7 @@ using namespace Hyprutils::String;
 
 #include "../../config/shared/complex/ComplexDataTypes.hpp"
 #include "../../config/lua/ConfigManager.hpp"
+#include "../../config/lua/layout/LuaLayoutProvider.hpp"
 #include "../../config/ConfigValue.hpp"
 #include "../../config/shared/parserUtils/ParserUtils.hpp"
 #include "../../config/shared/inotify/ConfigWatcher.hpp"
@@ -52,6 +55,8 @@ using namespace Hyprutils::String;
 #include "../../desktop/view/LayerSurface.hpp"
 #include "../../desktop/view/Group.hpp"
 #include "../../desktop/rule/Engine.hpp"
+#include "../../desktop/rule/matchEngine/MatchEngine.hpp"
+#include "../s2/S2.hpp"
 #include "../../desktop/history/WindowHistoryTracker.hpp"
 #include "../../desktop/state/FocusState.hpp"
 #include "../../state/MonitorState.hpp"
@@ -64,6 +69,7 @@ using namespace Hyprutils::String;
 #include "../../managers/XWaylandManager.hpp"
 #include "../../managers/fullscreen/FullscreenController.hpp"
 #include "../../plugins/PluginSystem.hpp"
+#include "../../xwayland/XWayland.hpp"
 #include "../../animation/AnimationManager.hpp"
 #include "../../notification/NotificationOverlay.hpp"
 #include "../../render/Renderer.hpp"
@@ -204,6 +210,277 @@ std::string                                                       CCommandFormat
     return format == eHyprCtlOutputFormat::FORMAT_JSON ? std::format("[{}]", reasonStr) : reasonStr;
 }
 
+static int focusHistoryID(PHLWINDOW wnd) {
+    const auto& HISTORY = Desktop::History::windowTracker()->fullHistory();
+    for (size_t i = 0; i < HISTORY.size(); ++i) {
+        if (HISTORY[i].lock() == wnd)
+            return HISTORY.size() - i - 1; // reverse order for backwards compat
+    }
+    return -1;
+}
+
+// same names as in the json output, minus the quotes
+template <size_t N>
+static void writeReasons(IStructuredWriter& out, uint32_t reasons, const std::array<const char*, N>& names) {
+    if (!reasons) {
+        out.null();
+        return;
+    }
+
+    out.beginArray();
+    for (size_t i = 0; i < N; ++i) {
+        if (!(reasons & (1 << i)))
+            continue;
+
+        const std::string_view NAME = names[i];
+        out.string(NAME.substr(1, NAME.size() - 2));
+    }
+    out.endArray();
+}
+
+// Fields of the binary / field-selected outputs, written straight from state. Names match the json output.
+template <typename T>
+struct SStructuredField {
+    const char* name = nullptr;
+    void (*write)(const T&, IStructuredWriter&);
+};
+
+using GEO = Desktop::View::IGeometric;
+
+static const auto WINDOW_FIELDS = std::to_array<SStructuredField<PHLWINDOW>>({
+    {"address", [](const PHLWINDOW& w, IStructuredWriter& out) { out.hex(rc<uintptr_t>(w.get())); }},
+    {"mapped", [](const PHLWINDOW& w, IStructuredWriter& out) { out.boolean(w->mapped()); }},
+    {"hidden", [](const PHLWINDOW& w, IStructuredWriter& out) { out.boolean(w->isHidden()); }},
+    {"visible", [](const PHLWINDOW& w, IStructuredWriter& out) { out.boolean(w->mapped() && w->acceptsInput() && w->alphaNonZero()); }},
+    {"acceptsInput", [](const PHLWINDOW& w, IStructuredWriter& out) { out.boolean(w->acceptsInput()); }},
+    {"at",
+     [](const PHLWINDOW& w, IStructuredWriter& out) {
+         const auto POS = w->position(GEO::GEOMETRIC_GOAL);
+         out.beginArray();
+         out.integer(sc<int>(POS.x));
+         out.integer(sc<int>(POS.y));
+         out.endArray();
+     }},
+    {"size",
+     [](const PHLWINDOW& w, IStructuredWriter& out) {
+         const auto SIZE = w->size(GEO::GEOMETRIC_GOAL);
+         out.beginArray();
+         out.integer(sc<int>(SIZE.x));
+         out.integer(sc<int>(SIZE.y));
+         out.endArray();
+     }},
+    {"workspace",
+     [](const PHLWINDOW& w, IStructuredWriter& out) {
+         out.beginMap();
+         out.key("id");
+         out.integer(w->m_workspace ? w->workspaceID() : WORKSPACE_INVALID);
+         out.key("name");
+         out.string(w->m_workspace ? w->m_workspace->m_name : "");
+         out.endMap();
+     }},
+    {"floating", [](const PHLWINDOW& w, IStructuredWriter& out) { out.boolean(w->isFloating()); }},
+    {"monitor", [](const PHLWINDOW& w, IStructuredWriter& out) { out.integer(w->monitorID()); }},
+    {"class", [](const PHLWINDOW& w, IStructuredWriter& out) { out.string(w->metadata().appID()); }},
+    {"title", [](const PHLWINDOW& w, IStructuredWriter& out) { out.string(w->metadata().title()); }},
+    {"initialClass", [](const PHLWINDOW& w, IStructuredWriter& out) { out.string(w->metadata().initialAppID()); }},
+    {"initialTitle", [](const PHLWINDOW& w, IStructuredWriter& out) { out.string(w->metadata().initialTitle()); }},
+    {"pid", [](const PHLWINDOW& w, IStructuredWriter& out) { out.integer(w->backend().pid()); }},
+    {"xwayland", [](const PHLWINDOW& w, IStructuredWriter& out) { out.boolean(w->backend().isX11()); }},
+    {"pinned", [](const PHLWINDOW& w, IStructuredWriter& out) { out.boolean(w->m_state & Desktop::View::WINDOW_STATE_PINNED); }},
+    {"pinFullscreened", [](const PHLWINDOW& w, IStructuredWriter& out) { out.boolean(w->fullscreenPolicy().pinFullscreened()); }},
+    {"fullscreen", [](const PHLWINDOW& w, IStructuredWriter& out) { out.integer(sc<uint8_t>(Fullscreen::controller()->getFullscreenModes(w).internal)); }},
+    {"fullscreenClient", [](const PHLWINDOW& w, IStructuredWriter& out) { out.integer(sc<uint8_t>(Fullscreen::controller()->getFullscreenModes(w).client)); }},
+    {"fullscreenHandler", [](const PHLWINDOW& w, IStructuredWriter& out) { out.string(Fullscreen::controller()->getFullscreenHandlerNameAsString(w)); }},
+    {"allowedOverFullscreen", [](const PHLWINDOW& w, IStructuredWriter& out) { out.boolean(w->fullscreenPolicy().allowedOverFullscreen()); }},
+    {"grouped",
+     [](const PHLWINDOW& w, IStructuredWriter& out) {
+         out.beginArray();
+         if (w->grouping().group()) {
+             for (const auto& curr : w->grouping().group()->windows()) {
+                 out.hex(rc<uintptr_t>(curr.get()));
+             }
+         }
+         out.endArray();
+     }},
+    {"tags",
+     [](const PHLWINDOW& w, IStructuredWriter& out) {
+         out.beginArray();
+         for (const auto& t : w->m_ruleApplicator->m_tagKeeper.getTags()) {
+             out.string(t);
+         }
+         out.endArray();
+     }},
+    {"swallowing", [](const PHLWINDOW& w, IStructuredWriter& out) { out.hex(rc<uintptr_t>(w->swallowing().swallowee().get())); }},
+    {"focusHistoryID", [](const PHLWINDOW& w, IStructuredWriter& out) { out.integer(focusHistoryID(w)); }},
+    {"inhibitingIdle", [](const PHLWINDOW& w, IStructuredWriter& out) { out.boolean(g_pInputManager->isWindowInhibiting(w, false)); }},
+    {"xdgTag", [](const PHLWINDOW& w, IStructuredWriter& out) { out.string(w->backend().metadata().tag.value_or("")); }},
+    {"xdgDescription", [](const PHLWINDOW& w, IStructuredWriter& out) { out.string(w->backend().metadata().description.value_or("")); }},
+    {"contentType", [](const PHLWINDOW& w, IStructuredWriter& out) { out.string(NContentType::toString(w->getContentType())); }},
+    {"tearingHint", [](const PHLWINDOW& w, IStructuredWriter& out) { out.boolean(w->m_hints & Desktop::View::WINDOW_HINT_TEAR); }},
+    {"stableId", [](const PHLWINDOW& w, IStructuredWriter& out) { out.hex(w->metadata().stableID(), false); }},
+});
+
+static std::string tiledLayoutName(PHLWORKSPACE w) {
+    if (w->m_space && w->m_space->algorithm() && w->m_space->algorithm()->tiledAlgo()) {
+        const auto& TILED_ALGO = w->m_space->algorithm()->tiledAlgo();
+        return Layout::Supplementary::algoMatcher()->getNameForTiledAlgo(&typeid(*TILED_ALGO.get()));
+    }
+
+    return "unknown";
+}
+
+static const auto WORKSPACE_FIELDS = std::to_array<SStructuredField<PHLWORKSPACE>>({
+    {"id", [](const PHLWORKSPACE& w, IStructuredWriter& out) { out.integer(w->m_id); }},
+    {"name", [](const PHLWORKSPACE& w, IStructuredWriter& out) { out.string(w->m_name); }},
+    {"monitor",
+     [](const PHLWORKSPACE& w, IStructuredWriter& out) {
+         const auto PMONITOR = w->m_monitor.lock();
+         out.string(PMONITOR ? PMONITOR->m_name : "?");
+     }},
+    {"monitorID",
+     [](const PHLWORKSPACE& w, IStructuredWriter& out) {
+         const auto PMONITOR = w->m_monitor.lock();
+         if (PMONITOR)
+             out.integer(PMONITOR->m_id);
+         else
+             out.null();
+     }},
+    {"windows", [](const PHLWORKSPACE& w, IStructuredWriter& out) { out.integer(w->getWindowCount()); }},
+    {"hasfullscreen", [](const PHLWORKSPACE& w, IStructuredWriter& out) { out.boolean(Fullscreen::controller()->hasFullscreen(w)); }},
+    {"lastwindow", [](const PHLWORKSPACE& w, IStructuredWriter& out) { out.hex(rc<uintptr_t>(w->getLastFocusedWindow().get())); }},
+    {"lastwindowtitle",
+     [](const PHLWORKSPACE& w, IStructuredWriter& out) {
+         const auto PLASTW = w->getLastFocusedWindow();
+         out.string(PLASTW ? PLASTW->metadata().title() : "");
+     }},
+    {"ispersistent", [](const PHLWORKSPACE& w, IStructuredWriter& out) { out.boolean(w->isPersistent()); }},
+    {"tiledLayout", [](const PHLWORKSPACE& w, IStructuredWriter& out) { out.string(tiledLayoutName(w)); }},
+});
+
+static const auto MONITOR_FIELDS = std::to_array<SStructuredField<PHLMONITOR>>({
+    {"id", [](const PHLMONITOR& m, IStructuredWriter& out) { out.integer(m->m_id); }},
+    {"name", [](const PHLMONITOR& m, IStructuredWriter& out) { out.string(m->m_name); }},
+    {"description", [](const PHLMONITOR& m, IStructuredWriter& out) { out.string(m->m_shortDescription); }},
+    {"make", [](const PHLMONITOR& m, IStructuredWriter& out) { out.string(m->m_output->make); }},
+    {"model", [](const PHLMONITOR& m, IStructuredWriter& out) { out.string(m->m_output->model); }},
+    {"serial", [](const PHLMONITOR& m, IStructuredWriter& out) { out.string(m->m_output->serial); }},
+    {"width", [](const PHLMONITOR& m, IStructuredWriter& out) { out.integer(sc<int>(m->m_pixelSize.x)); }},
+    {"height", [](const PHLMONITOR& m, IStructuredWriter& out) { out.integer(sc<int>(m->m_pixelSize.y)); }},
+    {"physicalWidth", [](const PHLMONITOR& m, IStructuredWriter& out) { out.integer(sc<int>(m->m_output->physicalSize.x)); }},
+    {"physicalHeight", [](const PHLMONITOR& m, IStructuredWriter& out) { out.integer(sc<int>(m->m_output->physicalSize.y)); }},
+    {"refreshRate", [](const PHLMONITOR& m, IStructuredWriter& out) { out.number(m->m_refreshRate); }},
+    {"x", [](const PHLMONITOR& m, IStructuredWriter& out) { out.integer(sc<int>(m->m_position.x)); }},
+    {"y", [](const PHLMONITOR& m, IStructuredWriter& out) { out.integer(sc<int>(m->m_position.y)); }},
+    {"activeWorkspace",
+     [](const PHLMONITOR& m, IStructuredWriter& out) {
+         out.beginMap();
+         out.key("id");
+         out.integer(m->activeWorkspaceID());
+         out.key("name");
+         out.string(m->m_activeWorkspace ? m->m_activeWorkspace->m_name : "");
+         out.endMap();
+     }},
+    {"specialWorkspace",
+     [](const PHLMONITOR& m, IStructuredWriter& out) {
+         out.beginMap();
+         out.key("id");
+         out.integer(m->activeSpecialWorkspaceID());
+         out.key("name");
+         out.string(m->m_activeSpecialWorkspace ? m->m_activeSpecialWorkspace->m_name : "");
+         out.endMap();
+     }},
+    {"reserved",
+     [](const PHLMONITOR& m, IStructuredWriter& out) {
+         out.beginArray();
+         out.integer(sc<int>(m->m_reservedArea.left()));
+         out.integer(sc<int>(m->m_reservedArea.top()));
+         out.integer(sc<int>(m->m_reservedArea.right()));
+         out.integer(sc<int>(m->m_reservedArea.bottom()));
+         out.endArray();
+     }},
+    {"scale", [](const PHLMONITOR& m, IStructuredWriter& out) { out.number(m->m_scale); }},
+    {"transform", [](const PHLMONITOR& m, IStructuredWriter& out) { out.integer(sc<int>(m->m_transform)); }},
+    {"focused", [](const PHLMONITOR& m, IStructuredWriter& out) { out.boolean(m == Desktop::focusState()->monitor()); }},
+    {"dpmsStatus", [](const PHLMONITOR& m, IStructuredWriter& out) { out.boolean(m->m_dpmsStatus); }},
+    {"vrr", [](const PHLMONITOR& m, IStructuredWriter& out) { out.boolean(m->m_output->state->state().adaptiveSync); }},
+    {"solitary", [](const PHLMONITOR& m, IStructuredWriter& out) { out.hex(rc<uint64_t>(m->m_solitaryClient.get()), false); }},
+    {"solitaryBlockedBy", [](const PHLMONITOR& m, IStructuredWriter& out) { writeReasons(out, m->isSolitaryBlocked(true), SOLITARY_REASONS_JSON); }},
+    {"activelyTearing", [](const PHLMONITOR& m, IStructuredWriter& out) { out.boolean(m->m_tearingState.activelyTearing); }},
+    {"tearingBlockedBy",
+     [](const PHLMONITOR& m, IStructuredWriter& out) {
+         const auto REASONS = m->isTearingBlocked(true);
+         writeReasons(out, REASONS == Monitor::CMonitor::TC_NOT_TORN && m->m_tearingState.activelyTearing ? 0 : REASONS, TEARING_REASONS_JSON);
+     }},
+    {"directScanoutTo", [](const PHLMONITOR& m, IStructuredWriter& out) { out.hex(rc<uint64_t>(m->m_lastScanout.get()), false); }},
+    {"directScanoutBlockedBy", [](const PHLMONITOR& m, IStructuredWriter& out) { writeReasons(out, m->isDSBlocked(true), DS_REASONS_JSON); }},
+    {"disabled", [](const PHLMONITOR& m, IStructuredWriter& out) { out.boolean(!m->m_enabled); }},
+    {"currentFormat", [](const PHLMONITOR& m, IStructuredWriter& out) { out.string(formatToString(m->m_output->state->state().drmFormat)); }},
+    {"mirrorOf",
+     [](const PHLMONITOR& m, IStructuredWriter& out) {
+         if (m->m_mirrorOf)
+             out.integer(m->m_mirrorOf->m_id);
+         else
+             out.null();
+     }},
+    {"availableModes",
+     [](const PHLMONITOR& m, IStructuredWriter& out) {
+         out.beginArray();
+         for (auto const& mode : m->m_output->modes) {
+             out.string(std::format("{}x{}@{:.2f}Hz", mode->pixelSize.x, mode->pixelSize.y, mode->refreshRate / 1000.0));
+         }
+         out.endArray();
+     }},
+    {"colorManagementPreset", [](const PHLMONITOR& m, IStructuredWriter& out) { out.string(NCMType::toString(m->m_cmType)); }},
+    {"sdrBrightness", [](const PHLMONITOR& m, IStructuredWriter& out) { out.number(m->m_sdrBrightness); }},
+    {"sdrSaturation", [](const PHLMONITOR& m, IStructuredWriter& out) { out.number(m->m_sdrSaturation); }},
+    {"sdrMinLuminance", [](const PHLMONITOR& m, IStructuredWriter& out) { out.number(m->m_sdrMinLuminance); }},
+    {"sdrMaxLuminance", [](const PHLMONITOR& m, IStructuredWriter& out) { out.number(m->m_sdrMaxLuminance); }},
+    {"hardwareCursorsInUse", [](const PHLMONITOR& m, IStructuredWriter& out) { out.boolean(!m->shouldUseSoftwareCursors()); }},
+});
+
+static bool wantsStructured(const SRequest& request) {
+    return request.format == FORMAT_BINARY || !request.fields.empty();
+}
+
+// Serializes objects with the given fields, or all of them. Field selection without -b gives json.
+template <typename T, size_t N, typename R>
+static std::string structuredResponse(const SRequest& request, const std::array<SStructuredField<T>, N>& all, R&& objects) {
+    std::vector<const SStructuredField<T>*> fields;
+
+    if (request.fields.empty()) {
+        for (const auto& f : all) {
+            fields.emplace_back(&f);
+        }
+    } else {
+        for (const auto& name : request.fields) {
+            const auto IT = std::ranges::find_if(all, [&name](const auto& f) { return name == f.name; });
+            if (IT == all.end())
+                return std::format("unknown field: {}", name);
+
+            fields.emplace_back(&*IT);
+        }
+    }
+
+    UP<IStructuredWriter> out;
+    if (request.format == FORMAT_BINARY)
+        out = makeUnique<CMsgPackWriter>();
+    else
+        out = makeUnique<CJSONWriter>();
+
+    out->beginArray();
+    for (const auto& o : objects) {
+        out->beginMap();
+        for (const auto& f : fields) {
+            out->key(f->name);
+            f->write(o, *out);
+        }
+        out->endMap();
+    }
+    out->endArray();
+
+    return out->take();
+}
+
 std::string CCommandFormatter::getMonitorData(PHLMONITOR m, eHyprCtlOutputFormat format) {
     std::string result;
     if (!m->m_output || m->m_id == -1)
@@ -294,9 +571,10 @@ std::string CCommandFormatter::getMonitorData(PHLMONITOR m, eHyprCtlOutputFormat
     return result;
 }
 
-static std::string monitorsRequest(eHyprCtlOutputFormat format, std::string request) {
-    CVarList vars(request, 0, ' ');
-    auto     allMonitors = false;
+static std::string monitorsRequest(const SRequest& request) {
+    const auto format = request.format;
+    CVarList   vars(request.command, 0, ' ');
+    auto       allMonitors = false;
 
     if (vars.size() > 2)
         return "too many args";
@@ -304,6 +582,11 @@ static std::string monitorsRequest(eHyprCtlOutputFormat format, std::string requ
     if (vars.size() == 2 && vars[1] == "all")
         allMonitors = true;
 
+    if (wantsStructured(request))
+        return structuredResponse(request, MONITOR_FIELDS,
+                                  (allMonitors ? State::monitorState()->allMonitors() : State::monitorState()->monitors()) |
+                                      std::views::filter([](const auto& m) { return m->m_output && m->m_id != -1; }));
+
     std::string result = "";
     if (format == eHyprCtlOutputFormat::FORMAT_JSON) {
         result += "[";
@@ -358,15 +641,6 @@ static std::string getGroupedData(PHLWINDOW w, eHyprCtlOutputFormat format) {
 }
 
 std::string CCommandFormatter::getWindowData(PHLWINDOW w, eHyprCtlOutputFormat format) {
-    auto getFocusHistoryID = [](PHLWINDOW wnd) -> int {
-        const auto& HISTORY = Desktop::History::windowTracker()->fullHistory();
-        for (size_t i = 0; i < HISTORY.size(); ++i) {
-            if (HISTORY[i].lock() == wnd)
-                return HISTORY.size() - i - 1; // reverse order for backwards compat
-        }
-        return -1;
-    };
-
     const auto METADATA = w->backend().metadata();
     const bool VISIBLE  = w->mapped() && w->acceptsInput() && w->alphaNonZero();
 
@@ -418,7 +692,7 @@ std::string CCommandFormatter::getWindowData(PHLWINDOW w, eHyprCtlOutputFormat f
             ((w->m_state & Desktop::View::WINDOW_STATE_PINNED) ? "true" : "false"), (w->fullscreenPolicy().pinFullscreened() ? "true" : "false"),
             sc<uint8_t>(Fullscreen::controller()->getFullscreenModes(w).internal), sc<uint8_t>(Fullscreen::controller()->getFullscreenModes(w).client),
             escapeJSONStrings(Fullscreen::controller()->getFullscreenHandlerNameAsString(w)), (w->fullscreenPolicy().allowedOverFullscreen() ? "true" : "false"),
-            getGroupedData(w, format), getTagsData(w, format), rc<uintptr_t>(w->swallowing().swallowee().get()), getFocusHistoryID(w),
+            getGroupedData(w, format), getTagsData(w, format), rc<uintptr_t>(w->swallowing().swallowee().get()), focusHistoryID(w),
             (g_pInputManager->isWindowInhibiting(w, false) ? "true" : "false"), escapeJSONStrings(METADATA.tag.value_or("")), escapeJSONStrings(METADATA.description.value_or("")),
             escapeJSONStrings(NContentType::toString(w->getContentType())), ((w->m_hints & Desktop::View::WINDOW_HINT_TEAR) ? "true" : "false"), w->metadata().stableID());
     } else {
@@ -439,14 +713,18 @@ std::string CCommandFormatter::getWindowData(PHLWINDOW w, eHyprCtlOutputFormat f
             sc<int>(sc<bool>(w->m_state & Desktop::View::WINDOW_STATE_PINNED)), sc<int>(w->fullscreenPolicy().pinFullscreened()),
             sc<uint8_t>(Fullscreen::controller()->getFullscreenModes(w).internal), sc<uint8_t>(Fullscreen::controller()->getFullscreenModes(w).client),
             Fullscreen::controller()->getFullscreenHandlerNameAsString(w), sc<int>(w->fullscreenPolicy().allowedOverFullscreen()), getGroupedData(w, format),
-            getTagsData(w, format), rc<uintptr_t>(w->swallowing().swallowee().get()), getFocusHistoryID(w), sc<int>(g_pInputManager->isWindowInhibiting(w, false)),
+            getTagsData(w, format), rc<uintptr_t>(w->swallowing().swallowee().get()), focusHistoryID(w), sc<int>(g_pInputManager->isWindowInhibiting(w, false)),
             METADATA.tag.value_or(""), METADATA.description.value_or(""), NContentType::toString(w->getContentType()),
             sc<int>(sc<bool>(w->m_hints & Desktop::View::WINDOW_HINT_TEAR)), w->metadata().stableID());
     }
 }
 
 static std::string clientsRequest(const SRequest& request) {
-    const auto  format = request.format;
+    const auto format = request.format;
+
+    if (wantsStructured(request))
+        return structuredResponse(request, WINDOW_FIELDS, Desktop::windowState()->windows() | std::views::filter([&request](const auto& w) { return w->mapped() || request.all; }));
+
     std::string result = "";
     if (format == eHyprCtlOutputFormat::FORMAT_JSON) {
         result += "[";
@@ -476,14 +754,9 @@ static std::string clientsRequest(const SRequest& request) {
 }
 
 std::string CCommandFormatter::getWorkspaceData(PHLWORKSPACE w, eHyprCtlOutputFormat format) {
-    const auto  PLASTW   = w->getLastFocusedWindow();
-    const auto  PMONITOR = w->m_monitor.lock();
-
-    std::string layoutName = "unknown";
-    if (w->m_space && w->m_space->algorithm() && w->m_space->algorithm()->tiledAlgo()) {
-        const auto& TILED_ALGO = w->m_space->algorithm()->tiledAlgo();
-        layoutName             = Layout::Supplementary::algoMatcher()->getNameForTiledAlgo(&typeid(*TILED_ALGO.get()));
-    }
+    const auto PLASTW     = w->getLastFocusedWindow();
+    const auto PMONITOR   = w->m_monitor.lock();
+    const auto layoutName = tiledLayoutName(w);
 
     if (format == eHyprCtlOutputFormat::FORMAT_JSON) {
         return std::format(R"#({{
@@ -583,7 +856,12 @@ static std::string activeWorkspaceRequest(eHyprCtlOutputFormat format, std::stri
     return CCommandFormatter::getWorkspaceData(w, format);
 }
 
-static std::string workspacesRequest(eHyprCtlOutputFormat format, std::string request) {
+static std::string workspacesRequest(const SRequest& request) {
+    const auto format = request.format;
+
+    if (wantsStructured(request))
+        return structuredResponse(request, WORKSPACE_FIELDS, State::workspaceState()->workspaces() | std::views::transform([](const auto& w) { return w.lock(); }));
+
     std::string result = "";
 
     if (format == eHyprCtlOutputFormat::FORMAT_JSON) {
@@ -978,6 +1256,15 @@ static std::string animationsRequest(eHyprCtlOutputFormat format, std::string re
     return ret;
 }
 
+static std::string animationStatsRequest(eHyprCtlOutputFormat format, std::string request) {
+    const auto& STATS = Animation::mgr()->lastTickStats();
+
+    if (format == eHyprCtlOutputFormat::FORMAT_JSON)
+        return std::format(R"#({{"active": {}, "skipped": {}, "fastForwarded": {}}})#", STATS.active, STATS.skipped, STATS.fastForwarded);
+
+    return std::format("variables (last tick):\n\tactive: {}\n\tskipped: {}\n\tfast-forwarded: {}", STATS.active, STATS.skipped, STATS.fastForwarded);
+}
+
 static std::string rollinglogRequest(eHyprCtlOutputFormat format, std::string request) {
     std::string result = "";
 
@@ -1123,6 +1410,252 @@ static std::string statusRequest(eHyprCtlOutputFormat format, std::string reques
     return Helpers::SystemInfo::getStatus(format);
 }
 
+static std::string ruleCacheRequest(eHyprCtlOutputFormat format, std::string request) {
+    using namespace Desktop::Rule;
+
+    constexpr std::array CACHING_ENGINES = {RULE_MATCH_ENGINE_REGEX, RULE_MATCH_ENGINE_TAG, RULE_MATCH_ENGINE_WORKSPACE};
+
+    std::string          ret = format == FORMAT_JSON ? "[" : "";
+
+    for (const auto& e : CACHING_ENGINES) {
+        const auto& STATS = matchCacheStats(e);
+
+        if (format == FORMAT_JSON) {
+            ret += std::format(R"#(
+{{
+    "engine": "{}",
+    "hits": {},
+    "misses": {},
+    "uncached": {}
+}},)#",
+                               matchEngineName(e), STATS.hits, STATS.misses, STATS.uncached);
+        } else
+            ret += std::format("{}:\n\thits: {}\n\tmisses: {}\n\tuncached: {}\n\n", matchEngineName(e), STATS.hits, STATS.misses, STATS.uncached);
+    }
+
+    if (format == FORMAT_JSON) {
+        trimTrailingComma(ret);
+        ret += "]";
+    }
+
+    return ret;
+}
+
+static std::string shaderCacheRequest(eHyprCtlOutputFormat format, std::string request) {
+    if (!Render::g_pShaderCache)
+        return format == FORMAT_JSON ? "{}" : "shader cache not initialized";
+
+    const auto& STATS     = Render::g_pShaderCache->stats();
+    const auto& DIR       = Render::g_pShaderCache->directory();
+    const bool  BINARIES  = g_pHyprOpenGL && g_pHyprOpenGL->programBinariesSupported();
+    const auto  AVERAGEMS = STATS.compiled ? STATS.compileMs / STATS.compiled : 0.F;
+
+    if (format == FORMAT_JSON) {
+        return std::format(R"#({{
+    "directory": "{}",
+    "programBinaries": {},
+    "recorded": {},
+    "prewarmed": {},
+    "sourceHits": {},
+    "sourceMisses": {},
+    "binaryHits": {},
+    "binaryMisses": {},
+    "binaryRejected": {},
+    "compiled": {},
+    "compileMs": {:.2f},
+    "averageCompileMs": {:.2f},
+    "longestCompileMs": {:.2f}
+}})#",
+                           escapeJSONStrings(DIR), BINARIES ? "true" : "false", Render::g_pShaderCache->recorded().size(), STATS.prewarmed, STATS.sourceHits, STATS.sourceMisses,
+                           STATS.binaryHits, STATS.binaryMisses, STATS.binaryRejected, STATS.compiled, STATS.compileMs, AVERAGEMS, STATS.longestCompile);
+    }
+
+    return std::format("directory: {}\nprogram binaries: {}\nrecorded variants: {}\nprewarmed: {}\nsources:\n\thits: {}\n\tmisses: {}\nbinaries:\n\thits: {}\n\tmisses: {}\n\trejected: "
+                       "{}\ncompiled: {}\n\ttotal: {:.2f}ms\n\taverage: {:.2f}ms\n\tlongest: {:.2f}ms\n",
+                       DIR.empty() ? "none (in memory only)" : DIR, BINARIES, Render::g_pShaderCache->recorded().size(), STATS.prewarmed, STATS.sourceHits, STATS.sourceMisses,
+                       STATS.binaryHits, STATS.binaryMisses, STATS.binaryRejected, STATS.compiled, STATS.compileMs, AVERAGEMS, STATS.longestCompile);
+}
+
+static std::string shmUploadsRequest(eHyprCtlOutputFormat format, std::string request) {
+    const auto& STATS = Render::shmUploadStats();
+
+    auto        formatStats = [format](const std::string& name, pid_t pid, const Render::SShmUploadStats& s) -> std::string {
+        if (format == FORMAT_JSON)
+            return std::format(R"#({{"name": "{}", "pid": {}, "uploads": {}, "offloaded": {}, "damageRects": {}, "rects": {}, "bytes": {}, "ms": {:.2f}}},)#",
+                               escapeJSONStrings(name), pid, s.uploads, s.offloaded, s.damageRects, s.rects, s.bytes, s.ms);
+
+        return std::format("{} (pid {}):\n\tuploads: {} ({} offloaded)\n\trects: {} damaged, {} uploaded\n\tbytes: {}\n\ttime: {:.2f}ms\n\n", name, pid, s.uploads, s.offloaded,
+                           s.damageRects, s.rects, s.bytes, s.ms);
+    };
+
+    std::string ret = format == FORMAT_JSON ? "{\"clients\": [" : "";
+
+    for (const auto& [pid, s] : STATS.clients()) {
+        ret += formatStats(binaryNameForPid(pid).value_or("unknown"), pid, s);
+    }
+
+    if (format == FORMAT_JSON) {
+        trimTrailingComma(ret);
+        ret += "], \"total\": ";
+        ret += formatStats("total", 0, STATS.total());
+        trimTrailingComma(ret);
+        ret += "}";
+    } else
+        ret += formatStats("total", 0, STATS.total());
+
+    return ret;
+}
+
+static std::string luaLayoutsRequest(eHyprCtlOutputFormat format, std::string request) {
+    if (Config::mgr()->type() != Config::CONFIG_LUA)
+        return format == FORMAT_JSON ? "[]" : "lua layouts are only available with the lua config manager";
+
+    auto        luaMgr = dynamicPointerCast<Config::Lua::CConfigManager>(WP<Config::IConfigManager>(Config::mgr()));
+
+    std::string ret = format == FORMAT_JSON ? "[" : "";
+
+    for (const auto& provider : luaMgr->luaLayoutProviders()) {
+        const auto& S   = provider->stats;
+        const auto  AVG = S.calls ? S.ms / S.calls : 0.0;
+
+        if (format == FORMAT_JSON)
+            ret += std::format(R"#({{"name": "{}", "calls": {}, "cached": {}, "failed": {}, "overBudget": {}, "ms": {:.2f}, "avgMs": {:.3f}, "maxMs": {:.3f}}},)#",
+                               escapeJSONStrings(provider->name), S.calls, S.cached, S.failed, S.overBudget, S.ms, AVG, S.maxMs);
+        else
+            ret += std::format("{}:\n\tcalls: {} ({} failed, {} over budget)\n\treused: {}\n\ttime: {:.2f}ms total, {:.3f}ms avg, {:.3f}ms max\n\n", provider->name, S.calls,
+                               S.failed, S.overBudget, S.cached, S.ms, AVG, S.maxMs);
+    }
+
+    if (format == FORMAT_JSON) {
+        trimTrailingComma(ret);
+        ret += "]";
+    } else if (ret.empty())
+        ret = "no lua layouts registered";
+
+    return ret;
+}
+
+static std::string luaEventsRequest(eHyprCtlOutputFormat format, std::string request) {
+    if (Config::mgr()->type() != Config::CONFIG_LUA)
+        return format == FORMAT_JSON ? "[]" : "lua events are only available with the lua config manager";
+
+    auto luaMgr = dynamicPointerCast<Config::Lua::CConfigManager>(WP<Config::IConfigManager>(Config::mgr()));
+    if (!luaMgr->m_eventHandler)
+        return format == FORMAT_JSON ? "[]" : "no lua event handler";
+
+    std::vector<std::pair<uint64_t, const Config::Lua::CLuaEventHandler::SSubscription*>> subs;
+    for (const auto& [handle, sub] : luaMgr->m_eventHandler->subscriptions()) {
+        subs.emplace_back(handle, &sub);
+    }
+    std::ranges::sort(subs);
+
+    std::string ret = format == FORMAT_JSON ? "[" : "";
+
+    for (const auto& [handle, sub] : subs) {
+        if (format == FORMAT_JSON)
+            ret += std::format(R"#({{"id": {}, "event": "{}", "deferred": {}, "calls": {}, "coalesced": {}, "ms": {:.2f}}},)#", handle, escapeJSONStrings(sub->eventName),
+                               sub->deferred, sub->calls, sub->coalesced, sub->ms);
+        else
+            ret += std::format("{} (id {}{}):\n\tcalls: {} ({} coalesced)\n\ttime: {:.2f}ms\n\n", sub->eventName, handle, sub->deferred ? ", deferred" : "", sub->calls,
+                               sub->coalesced, sub->ms);
+    }
+
+    if (format == FORMAT_JSON) {
+        trimTrailingComma(ret);
+        ret += "]";
+    } else if (ret.empty())
+        ret = "no hl.on() subscriptions";
+
+    return ret;
+}
+
+static std::string frameTimesRequest(eHyprCtlOutputFormat format, std::string request) {
+    std::string ret = format == FORMAT_JSON ? "[" : "";
+
+    for (auto const& m : State::monitorState()->monitors()) {
+        if (!m->m_frameScheduler)
+            continue;
+
+        const auto STATS = m->m_frameScheduler->timings().stats(m->m_refreshRate);
+
+        if (format == FORMAT_JSON) {
+            const auto percentiles = [](const Monitor::SFramePercentiles& p) { return std::format(R"#({{"p50": {:.3f}, "p95": {:.3f}, "p99": {:.3f}}})#", p.p50, p.p95, p.p99); };
+
+            ret += std::format(R"#(
+{{
+    "monitor": "{}",
+    "frames": {},
+    "missed": {},
+    "render": {},
+    "gpu": {},
+    "presentLatency": {},
+    "frameLatency": {}
+}},)#",
+                               escapeJSONStrings(m->m_name), STATS.frames, STATS.missed, percentiles(STATS.render), percentiles(STATS.gpu), percentiles(STATS.presentLatency),
+                               percentiles(STATS.frameLatency));
+        } else {
+            const auto percentiles = [](const Monitor::SFramePercentiles& p) { return std::format("{:.2f}ms / {:.2f}ms / {:.2f}ms", p.p50, p.p95, p.p99); };
+
+            ret += std::format("Monitor {} (last {} frames, {} missed):\n\trender (p50/p95/p99): {}\n\tgpu: {}\n\tpresent latency: {}\n\tframe latency: {}\n\n", m->m_name,
+                               STATS.frames, STATS.missed, percentiles(STATS.render), percentiles(STATS.gpu), percentiles(STATS.presentLatency), percentiles(STATS.frameLatency));
+        }
+    }
+
+    if (format == FORMAT_JSON) {
+        trimTrailingComma(ret);
+        ret += "]";
+    }
+
+    return ret;
+}
+
+static std::string xwmStatsRequest(eHyprCtlOutputFormat format, std::string request) {
+#ifndef NO_XWAYLAND
+    if (!g_pXWayland || !g_pXWayland->m_wm)
+        return format == FORMAT_JSON ? "{}" : "xwayland is not running";
+
+    const auto STATS = g_pXWayland->m_wm->stats();
+
+    if (format == FORMAT_JSON)
+        return std::format(R"#({{"roundTrips": {}, "roundTripsPerSecond": {:.1f}, "blockedMs": {:.2f}, "pipelined": {}, "superseded": {}, "inFlight": {}}})#", STATS.roundTrips,
+                           STATS.roundTripsPerSecond, STATS.blockedMs, STATS.pipelined, STATS.superseded, STATS.inFlight);
+
+    return std::format("round-trips: {} ({:.1f}/s)\nblocked: {:.2f}ms\npipelined replies: {} ({} superseded)\nin flight: {}", STATS.roundTrips, STATS.roundTripsPerSecond,
+                       STATS.blockedMs, STATS.pipelined, STATS.superseded, STATS.inFlight);
+#else
+    return format == FORMAT_JSON ? "{}" : "built without xwayland";
+#endif
+}
+
+static std::string eventQueuesRequest(eHyprCtlOutputFormat format, std::string request) {
+    const auto  STATS = IPC::Socket2::sock()->clientStats();
+
+    std::string ret = format == FORMAT_JSON ? "[" : "";
+
+    for (const auto& s : STATS) {
+        if (format == FORMAT_JSON) {
+            ret += std::format(R"#(
+{{
+    "fd": {},
+    "queued": {},
+    "peak": {},
+    "dropped": {},
+    "coalesced": {}
+}},)#",
+                               s.id, s.queued, s.peak, s.dropped, s.coalesced);
+        } else
+            ret += std::format("socket2 client fd {}:\n\tqueued: {}\n\tpeak: {}\n\tdropped: {}\n\tcoalesced: {}\n\n", s.id, s.queued, s.peak, s.dropped, s.coalesced);
+    }
+
+    if (format == FORMAT_JSON) {
+        trimTrailingComma(ret);
+        ret += "]";
+    } else if (STATS.empty())
+        ret = "no socket2 clients\n";
+
+    return ret;
+}
+
 static std::string deprecatedConfigRequest(eHyprCtlOutputFormat format, std::string request) {
     const auto  OPTS = Config::mgr()->deprecationNotices();
 
@@ -1933,10 +2466,20 @@ static SCommand legacyCommand(std::string name, eCommandMatch match, F handler)
 }
 
 void IPC::Socket1::registerBuiltinCommands(CSocket1& socket) {
-    socket.registerCommand(legacyCommand("workspaces", COMMAND_MATCH_EXACT, workspacesRequest));
+    socket.registerCommand(SCommand{
+        .name       = "workspaces",
+        .match      = COMMAND_MATCH_EXACT,
+        .handler    = [](const SRequest& request) { return workspacesRequest(request); },
+        .structured = true,
+    });
     socket.registerCommand(legacyCommand("workspacerules", COMMAND_MATCH_EXACT, workspaceRulesRequest));
     socket.registerCommand(legacyCommand("activeworkspace", COMMAND_MATCH_EXACT, activeWorkspaceRequest));
-    socket.registerCommand(SCommand{.name = "clients", .match = COMMAND_MATCH_EXACT, .handler = [](const SRequest& request) { return clientsRequest(request); }});
+    socket.registerCommand(SCommand{
+        .name       = "clients",
+        .match      = COMMAND_MATCH_EXACT,
+        .handler    = [](const SRequest& request) { return clientsRequest(request); },
+        .structured = true,
+    });
     socket.registerCommand(legacyCommand("kill", COMMAND_MATCH_EXACT, killRequest));
     socket.registerCommand(legacyCommand("activewindow", COMMAND_MATCH_EXACT, activeWindowRequest));
     socket.registerCommand(legacyCommand("layers", COMMAND_MATCH_EXACT, layersRequest));
@@ -1948,6 +2491,7 @@ void IPC::Socket1::registerBuiltinCommands(CSocket1& socket) {
     socket.registerCommand(legacyCommand("globalshortcuts", COMMAND_MATCH_EXACT, globalShortcutsRequest));
     socket.registerCommand(SCommand{.name = "systeminfo", .match = COMMAND_MATCH_EXACT, .handler = [](const SRequest& request) { return systemInfoRequest(request); }});
     socket.registerCommand(legacyCommand("animations", COMMAND_MATCH_EXACT, animationsRequest));
+    socket.registerCommand(legacyCommand("animationstats", COMMAND_MATCH_EXACT, animationStatsRequest));
     socket.registerCommand(SCommand{
         .name    = "rollinglog",
         .match   = COMMAND_MATCH_EXACT,
@@ -1959,9 +2503,22 @@ void IPC::Socket1::registerBuiltinCommands(CSocket1& socket) {
     socket.registerCommand(legacyCommand("submap", COMMAND_MATCH_EXACT, submapRequest));
     socket.registerCommand(legacyCommand("status", COMMAND_MATCH_EXACT, statusRequest));
     socket.registerCommand(legacyCommand("deprecated-config", COMMAND_MATCH_EXACT, deprecatedConfigRequest));
+    socket.registerCommand(legacyCommand("rulecache", COMMAND_MATCH_EXACT, ruleCacheRequest));
+    socket.registerCommand(legacyCommand("shadercache", COMMAND_MATCH_EXACT, shaderCacheRequest));
+    socket.registerCommand(legacyCommand("shmuploads", COMMAND_MATCH_EXACT, shmUploadsRequest));
+    socket.registerCommand(legacyCommand("lualayouts", COMMAND_MATCH_EXACT, luaLayoutsRequest));
+    socket.registerCommand(legacyCommand("luaevents", COMMAND_MATCH_EXACT, luaEventsRequest));
+    socket.registerCommand(legacyCommand("frametimes", COMMAND_MATCH_EXACT, frameTimesRequest));
+    socket.registerCommand(legacyCommand("eventqueues", COMMAND_MATCH_EXACT, eventQueuesRequest));
+    socket.registerCommand(legacyCommand("xwmstats", COMMAND_MATCH_EXACT, xwmStatsRequest));
 
     socket.registerCommand(legacyCommand("reloadshaders", COMMAND_MATCH_PREFIX, reloadShaders));
-    socket.registerCommand(legacyCommand("monitors", COMMAND_MATCH_PREFIX, monitorsRequest));
+    socket.registerCommand(SCommand{
+        .name       = "monitors",
+        .match      = COMMAND_MATCH_PREFIX,
+        .handler    = [](const SRequest& request) { return monitorsRequest(request); },
+        .structured = true,
+    });
     socket.registerCommand(legacyCommand("reload", COMMAND_MATCH_PREFIX, reloadRequest));
     socket.registerCommand(SCommand{.name = "plugin", .match = COMMAND_MATCH_PREFIX, .handler = dispatchPlugin});
     socket.registerCommand(legacyCommand("notify", COMMAND_MATCH_PREFIX, dispatchNotify));
@@ -14,6 +14,7 @@ using namespace IPC::Socket1;
 
 static constexpr std::string_view BATCH_TOKEN     = "[[BATCH]]";
 static constexpr std::string_view BATCH_DELIMITER = "\n\n\n";
+static constexpr std::string_view FIELDS_TOKEN    = " --fields=";
 
 SResponse::SResponse() : result(std::string{}) {
     ;
@@ -66,6 +67,8 @@ SRequest CSocket1::parseRequest(std::string request, pid_t pid) const {
 
         if (character == 'j')
             parsed.format = FORMAT_JSON;
+        else if (character == 'b')
+            parsed.format = FORMAT_BINARY;
         else if (character == 'r')
             parsed.refresh = true;
         else if (character == 'a')
@@ -82,31 +85,51 @@ SRequest CSocket1::parseRequest(std::string request, pid_t pid) const {
     return parsed;
 }
 
-SResponse CSocket1::dispatchSingle(std::string request, pid_t pid) {
-    const auto   parsed = parseRequest(std::move(request), pid);
+// a trailing --fields=a,b,c picks the fields of structured output
+static void parseFields(SRequest& request) {
+    const auto POS = request.command.rfind(FIELDS_TOKEN);
+    if (POS == std::string::npos)
+        return;
 
-    SP<SCommand> matched;
+    for (const auto& f : std::views::split(std::string_view{request.command}.substr(POS + FIELDS_TOKEN.size()), ',')) {
+        if (!f.empty())
+            request.fields.emplace_back(f.begin(), f.end());
+    }
 
-    for (const auto& command : m_commands) {
-        if (command->match == COMMAND_MATCH_EXACT && command->name == parsed.command) {
-            matched = command;
-            break;
-        }
+    request.command.resize(POS);
+}
+
+SP<SCommand> CSocket1::findCommand(const std::string& command) const {
+    for (const auto& c : m_commands) {
+        if (c->match != COMMAND_MATCH_EXACT || !command.starts_with(c->name))
+            continue;
+
+        if (command.size() == c->name.size() || (c->structured && std::string_view{command}.substr(c->name.size()).starts_with(FIELDS_TOKEN)))
+            return c;
     }
 
-    if (!matched) {
-        for (const auto& command : m_commands) {
-            if (command->match == COMMAND_MATCH_PREFIX && parsed.command.starts_with(command->name)) {
-                matched = command;
-                break;
-            }
-        }
+    for (const auto& c : m_commands) {
+        if (c->match == COMMAND_MATCH_PREFIX && command.starts_with(c->name))
+            return c;
     }
 
-    if (!matched)
+    return nullptr;
+}
+
+SResponse CSocket1::dispatchSingle(std::string request, pid_t pid) {
+    auto       parsed  = parseRequest(std::move(request), pid);
+    const auto MATCHED = findCommand(parsed.command);
+
+    if (!MATCHED)
         return "unknown request";
 
-    auto response = matched->handler(parsed);
+    // legacy handlers only know normal and json
+    if (MATCHED->structured)
+        parseFields(parsed);
+    else if (parsed.format == FORMAT_BINARY)
+        parsed.format = FORMAT_NORMAL;
+
+    auto response = MATCHED->handler(parsed);
 
     if (parsed.refresh)
         refreshState();
@@ -14,6 +14,7 @@ namespace IPC::Socket1 {
     enum eOutputFormat : uint8_t {
         FORMAT_NORMAL = 0,
         FORMAT_JSON,
+        FORMAT_BINARY, // MessagePack, only for structured commands, others get FORMAT_NORMAL
     };
 
     enum eCommandMatch : uint8_t {
@@ -34,6 +35,9 @@ namespace IPC::Socket1 {
         bool          includeConfig = false;
         bool          follow        = false;
         pid_t         pid           = 0;
+
+        // only these fields of each object, for structured commands
+        std::vector<std::string> fields;
     };
 
     struct SResponse {
@@ -52,6 +56,7 @@ namespace IPC::Socket1 {
         std::string                               name;
         eCommandMatch                             match = COMMAND_MATCH_EXACT;
         std::function<SResponse(const SRequest&)> handler;
+        bool                                      structured = false; // understands FORMAT_BINARY and --fields
     };
 
     class IImplementation;
@@ -68,6 +73,7 @@ namespace IPC::Socket1 {
 
       private:
         SRequest                  parseRequest(std::string request, pid_t pid) const;
+        SP<SCommand>              findCommand(const std::string& command) const;
         SResponse                 dispatchSingle(std::string request, pid_t pid);
         SResponse                 dispatchBatch(std::string request, pid_t pid);
 
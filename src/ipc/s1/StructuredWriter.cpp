@@ -0,0 +1,215 @@
+#include "StructuredWriter.hpp"
+#include "../../helpers/memory/Memory.hpp"
+
+#include <bit>
+#include <cmath>
+#include <format>
+
+using namespace IPC::Socket1;
+
+void IStructuredWriter::hex(uint64_t x, bool prefix) {
+    char       buf[24];
+    const auto RESULT = prefix ? std::format_to_n(buf, sizeof(buf), "0x{:x}", x) : std::format_to_n(buf, sizeof(buf), "{:x}", x);
+    string({buf, sc<size_t>(RESULT.size)});
+}
+
+std::string IStructuredWriter::take() {
+    return std::move(m_buffer);
+}
+
+void CMsgPackWriter::put(uint64_t x, size_t bytes) {
+    for (size_t i = bytes; i > 0; --i) {
+        m_buffer += sc<char>((x >> ((i - 1) * 8)) & 0xFF);
+    }
+}
+
+void CMsgPackWriter::element() {
+    if (!m_stack.empty())
+        m_stack.back().count++;
+}
+
+void CMsgPackWriter::beginContainer(uint8_t tag) {
+    element();
+    m_buffer += sc<char>(tag);
+    m_stack.emplace_back(SContainer{.offset = m_buffer.size()});
+    put(0, 4);
+}
+
+void CMsgPackWriter::endContainer() {
+    const auto CONTAINER = m_stack.back();
+    m_stack.pop_back();
+
+    for (size_t i = 0; i < 4; ++i) {
+        m_buffer[CONTAINER.offset + i] = sc<char>((CONTAINER.count >> ((3 - i) * 8)) & 0xFF);
+    }
+}
+
+void CMsgPackWriter::beginArray() {
+    beginContainer(0xdd);
+}
+
+void CMsgPackWriter::endArray() {
+    endContainer();
+}
+
+void CMsgPackWriter::beginMap() {
+    beginContainer(0xdf);
+}
+
+void CMsgPackWriter::endMap() {
+    endContainer();
+}
+
+void CMsgPackWriter::key(std::string_view key) {
+    // a map counts pairs, so the key counts and its value doesn't
+    string(key);
+    m_stack.back().count--;
+}
+
+void CMsgPackWriter::string(std::string_view str) {
+    element();
+
+    if (str.size() < 32)
+        m_buffer += sc<char>(0xa0 | str.size());
+    else if (str.size() <= UINT8_MAX) {
+        m_buffer += sc<char>(0xd9);
+        put(str.size(), 1);
+    } else if (str.size() <= UINT16_MAX) {
+        m_buffer += sc<char>(0xda);
+        put(str.size(), 2);
+    } else {
+        m_buffer += sc<char>(0xdb);
+        put(str.size(), 4);
+    }
+
+    m_buffer += str;
+}
+
+void CMsgPackWriter::integer(int64_t x) {
+    element();
+
+    if (x >= 0 && x < 128)
+        m_buffer += sc<char>(x);
+    else if (x < 0 && x >= -32)
+        m_buffer += sc<char>(x);
+    else if (x >= INT32_MIN && x <= INT32_MAX) {
+        m_buffer += sc<char>(0xd2);
+        put(sc<uint32_t>(x), 4);
+    } else {
+        m_buffer += sc<char>(0xd3);
+        put(sc<uint64_t>(x), 8);
+    }
+}
+
+void CMsgPackWriter::number(double x) {
+    element();
+    m_buffer += sc<char>(0xcb);
+    put(std::bit_cast<uint64_t>(x), 8);
+}
+
+void CMsgPackWriter::boolean(bool x) {
+    element();
+    m_buffer += sc<char>(x ? 0xc3 : 0xc2);
+}
+
+void CMsgPackWriter::null() {
+    element();
+    m_buffer += sc<char>(0xc0);
+}
+
+void CJSONWriter::element() {
+    if (m_afterKey) {
+        m_afterKey = false;
+        return;
+    }
+
+    if (m_first.empty())
+        return;
+
+    if (!m_first.back())
+        m_buffer += ',';
+
+    m_first.back() = false;
+}
+
+void CJSONWriter::quoted(std::string_view str) {
+    m_buffer += '"';
+
+    for (const auto& c : str) {
+        switch (c) {
+            case '"': m_buffer += "\\\""; break;
+            case '\\': m_buffer += "\\\\"; break;
+            case '\b': m_buffer += "\\b"; break;
+            case '\f': m_buffer += "\\f"; break;
+            case '\n': m_buffer += "\\n"; break;
+            case '\r': m_buffer += "\\r"; break;
+            case '\t': m_buffer += "\\t"; break;
+            default:
+                if ('\x00' <= c && c <= '\x1f')
+                    std::format_to(std::back_inserter(m_buffer), "\\u{:04x}", sc<int>(c));
+                else
+                    m_buffer += c;
+        }
+    }
+
+    m_buffer += '"';
+}
+
+void CJSONWriter::beginArray() {
+    element();
+    m_buffer += '[';
+    m_first.emplace_back(true);
+}
+
+void CJSONWriter::endArray() {
+    m_buffer += ']';
+    m_first.pop_back();
+}
+
+void CJSONWriter::beginMap() {
+    element();
+    m_buffer += '{';
+    m_first.emplace_back(true);
+}
+
+void CJSONWriter::endMap() {
+    m_buffer += '}';
+    m_first.pop_back();
+}
+
+void CJSONWriter::key(std::string_view key) {
+    element();
+    quoted(key);
+    m_buffer += ':';
+    m_afterKey = true;
+}
+
+void CJSONWriter::string(std::string_view str) {
+    element();
+    quoted(str);
+}
+
+void CJSONWriter::integer(int64_t x) {
+    element();
+    std::format_to(std::back_inserter(m_buffer), "{}", x);
+}
+
+void CJSONWriter::number(double x) {
+    element();
+
+    // json has no inf or nan
+    if (!std::isfinite(x))
+        m_buffer += "null";
+    else
+        std::format_to(std::back_inserter(m_buffer), "{}", x);
+}
+
+void CJSONWriter::boolean(bool x) {
+    element();
+    m_buffer += x ? "true" : "false";
+}
+
+void CJSONWriter::null() {
+    element();
+    m_buffer += "null";
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace IPC::Socket1 {
+    // Streams nested arrays / maps straight into a buffer. Element counts are tracked by the writer,
+    // so callers don't need to know them up front.
+    class IStructuredWriter {
+      public:
+        virtual ~IStructuredWriter() = default;
+
+        virtual void beginArray()                 = 0;
+        virtual void endArray()                   = 0;
+        virtual void beginMap()                   = 0;
+        virtual void endMap()                     = 0;
+        virtual void key(std::string_view key)    = 0;
+
+        virtual void string(std::string_view str) = 0;
+        virtual void integer(int64_t x)           = 0;
+        virtual void number(double x)             = 0;
+        virtual void boolean(bool x)              = 0;
+        virtual void null()                       = 0;
+
+        // pointers and other ids are written as "0x..." strings, json can't hold 64-bit integers
+        void         hex(uint64_t x, bool prefix = true);
+
+        std::string  take();
+
+      protected:
+        IStructuredWriter() = default;
+
+        std::string m_buffer;
+    };
+
+    // MessagePack. Containers are always written in their 32-bit form and patched with the real count when closed.
+    class CMsgPackWriter : public IStructuredWriter {
+      public:
+        virtual void beginArray() override;
+        virtual void endArray() override;
+        virtual void beginMap() override;
+        virtual void endMap() override;
+        virtual void key(std::string_view key) override;
+
+        virtual void string(std::string_view str) override;
+        virtual void integer(int64_t x) override;
+        virtual void number(double x) override;
+        virtual void boolean(bool x) override;
+        virtual void null() override;
+
+      private:
+        struct SContainer {
+            size_t   offset = 0;
+            uint32_t count  = 0;
+        };
+
+        void                    beginContainer(uint8_t tag);
+        void                    endContainer();
+        void                    element();
+        void                    put(uint64_t x, size_t bytes);
+
+        std::vector<SContainer> m_stack;
+    };
+
+    class CJSONWriter : public IStructuredWriter {
+      public:
+        virtual void beginArray() override;
+        virtual void endArray() override;
+        virtual void beginMap() override;
+        virtual void endMap() override;
+        virtual void key(std::string_view key) override;
+
+        virtual void string(std::string_view str) override;
+        virtual void integer(int64_t x) override;
+        virtual void number(double x) override;
+        virtual void boolean(bool x) override;
+        virtual void null() override;
+
+      private:
+        void              element();
+        void              quoted(std::string_view str);
+
+        std::vector<bool> m_first;
+        bool              m_afterKey = false;
+    };
+}
@@ -1,14 +1,18 @@
 #pragma once
 
+#include "S2.hpp"
+
 #include <cstddef>
 #include <string>
+#include <vector>
 
 namespace IPC::Socket2 {
     class IClient {
       public:
         virtual ~IClient() = default;
 
-        virtual size_t id() const = 0;
+        virtual size_t       id() const    = 0;
+        virtual SClientStats stats() const = 0;
 
       protected:
         IClient() = default;
@@ -18,7 +22,10 @@ namespace IPC::Socket2 {
       public:
         virtual ~IImplementation() = default;
 
-        virtual bool send(std::string&& x) = 0;
+        // whether any client is interested in the event at all, lets us skip formatting it
+        virtual bool                      wants(const SEvent& event) const                   = 0;
+        virtual bool                      send(const SEvent& event, std::string&& formatted) = 0;
+        virtual std::vector<SClientStats> clientStats() const                                = 0;
 
       protected:
         IImplementation() = default;
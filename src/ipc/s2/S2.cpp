@@ -1,6 +1,7 @@
 #include "S2.hpp"
 
 #include "Unix.hpp"
+#include "Impl.hpp"
 
 using namespace IPC;
 using namespace IPC::Socket2;
@@ -14,15 +15,21 @@ CSocket2::CSocket2() : m_impl(makeUnique<CUnixImpl>()) {
     ;
 }
 
-static std::string formatEvent(SEvent&& event) {
+static std::string formatEvent(const SEvent& event) {
     std::string_view data        = event.data;
     const auto       LEN         = event.event.length();
-    auto             eventString = std::format("{}>>{}\n", std::move(event.event), data.substr(0, 1024));
+    auto             eventString = std::format("{}>>{}\n", event.event, data.substr(0, 1024));
     std::replace(eventString.begin() + LEN + 2, eventString.end() - 1, '\n', ' ');
     return eventString;
 }
 
 void CSocket2::postEvent(SEvent&& event) {
-    auto str = formatEvent(std::move(event));
-    m_impl->send(std::move(str));
+    if (!m_impl->wants(event))
+        return;
+
+    m_impl->send(event, formatEvent(event));
+}
+
+std::vector<SClientStats> CSocket2::clientStats() const {
+    return m_impl->clientStats();
 }
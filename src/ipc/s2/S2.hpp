@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "../../helpers/memory/Memory.hpp"
 
@@ -10,6 +11,14 @@ namespace IPC::Socket2 {
         std::string data;
     };
 
+    struct SClientStats {
+        size_t id        = 0;
+        size_t queued    = 0;
+        size_t peak      = 0; // deepest the queue has been
+        size_t dropped   = 0; // events thrown away by drop_oldest
+        size_t coalesced = 0; // events replaced by a newer one of the same name
+    };
+
     class IImplementation;
 
     class CSocket2 {
@@ -17,7 +26,8 @@ namespace IPC::Socket2 {
         CSocket2();
         ~CSocket2() = default;
 
-        void postEvent(SEvent&& event);
+        void                      postEvent(SEvent&& event);
+        std::vector<SClientStats> clientStats() const;
 
       private:
         UP<IImplementation> m_impl;
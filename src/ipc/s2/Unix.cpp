@@ -1,13 +1,17 @@
 #include "Unix.hpp"
 
 #include "../../Compositor.hpp"
+#include "../../config/ConfigValue.hpp"
 
 #include <algorithm>
+#include <array>
+#include <ranges>
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/un.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <cstring>
 using namespace Hyprutils::OS;
@@ -24,7 +28,7 @@ static int onServerEvent(int fd, uint32_t mask, void* data) {
 }
 
 CUnixPeer::CUnixPeer(Hyprutils::OS::CFileDescriptor&& fd, void* parent) :
-    m_fd(std::move(fd)), m_eventSource(wl_event_loop_add_fd(g_pCompositor->m_wlEventLoop, m_fd.get(), 0, onClientEvent, parent)) {
+    m_fd(std::move(fd)), m_eventSource(wl_event_loop_add_fd(g_pCompositor->m_wlEventLoop, m_fd.get(), WL_EVENT_READABLE, onClientEvent, parent)) {
     ;
 }
 
@@ -37,24 +41,197 @@ size_t CUnixPeer::id() const {
     return m_fd.isValid() ? sc<size_t>(m_fd.get()) : sc<size_t>(0);
 }
 
+SClientStats CUnixPeer::stats() const {
+    auto stats   = m_stats;
+    stats.id     = id();
+    stats.queued = m_count;
+    return stats;
+}
+
+SP<std::string>& CUnixPeer::at(size_t i) {
+    return m_ring[(m_head + i) % m_ring.size()];
+}
+
+void CUnixPeer::push(const SP<std::string>& x) {
+    at(m_count) = x;
+    m_count++;
+    m_stats.peak = std::max(m_stats.peak, m_count);
+}
+
+void CUnixPeer::pop() {
+    at(0).reset();
+    m_head = (m_head + 1) % m_ring.size();
+    m_count--;
+}
+
+void CUnixPeer::erase(size_t i) {
+    for (; i + 1 < m_count; ++i) {
+        at(i) = std::move(at(i + 1));
+    }
+
+    at(m_count - 1).reset();
+    m_count--;
+}
+
+void CUnixPeer::reserve(size_t capacity) {
+    if (m_ring.size() == capacity || m_count > capacity)
+        return;
+
+    std::vector<SP<std::string>> ring(capacity);
+    for (size_t i = 0; i < m_count; ++i) {
+        ring[i] = std::move(at(i));
+    }
+
+    m_ring = std::move(ring);
+    m_head = 0;
+}
+
+void CUnixPeer::setWritable(bool writable) {
+    if (m_writable == writable)
+        return;
+
+    m_writable = writable;
+    updateMask();
+}
+
+void CUnixPeer::updateMask() {
+    wl_event_source_fd_update(m_eventSource, (m_writable ? WL_EVENT_WRITABLE : 0) | (m_readable ? WL_EVENT_READABLE : 0));
+}
+
+bool CUnixPeer::onReadable() {
+    // requests are tiny, anything longer is a client talking nonsense
+    constexpr size_t       MAX_REQUEST_LENGTH = 4096;
+
+    std::array<char, 1024> buf;
+
+    // one read per wakeup, the fd is level-triggered so we'll be back if there's more
+    const auto READ = read(m_fd.get(), buf.data(), buf.size());
+
+    if (READ < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            return true;
+
+        Log::logger->log(Log::ERR, "[Socket2::UnixPeer] fd {} failed reading: {}", m_fd.get(), strerror(errno));
+        return false;
+    }
+
+    // EOF only means the client is done talking (e.g. nc with a closed stdin), it still wants events
+    if (READ == 0) {
+        m_readable = false;
+        updateMask();
+        return true;
+    }
+
+    m_readBuffer.append(buf.data(), READ);
+
+    size_t pos = 0;
+    for (size_t nl = m_readBuffer.find('\n'); nl != std::string::npos; nl = m_readBuffer.find('\n', pos)) {
+        parseRequest(std::string_view{m_readBuffer}.substr(pos, nl - pos));
+        pos = nl + 1;
+    }
+
+    m_readBuffer.erase(0, pos);
+
+    if (m_readBuffer.length() > MAX_REQUEST_LENGTH) {
+        Log::logger->log(Log::ERR, "[Socket2::UnixPeer] fd {} sent an overlong request, ignoring", m_fd.get());
+        m_readBuffer.clear();
+    }
+
+    return true;
+}
+
+// subscribe <event>[=<first data field>] ...
+// e.g. "subscribe workspacev2 activewindowv2 windowtitlev2=55d0c2e0b8a0"
+void CUnixPeer::parseRequest(std::string_view request) {
+    if (!request.empty() && request.back() == '\r')
+        request.remove_suffix(1);
+
+    if (request.empty())
+        return;
+
+    constexpr std::string_view SUBSCRIBE = "subscribe ";
+
+    if (!request.starts_with(SUBSCRIBE)) {
+        Log::logger->log(Log::WARN, "[Socket2::UnixPeer] fd {} sent an unknown request: {}", m_fd.get(), request);
+        return;
+    }
+
+    for (const auto& f : std::views::split(request.substr(SUBSCRIBE.length()), ' ')) {
+        const std::string_view FILTER{f.begin(), f.end()};
+        if (FILTER.empty())
+            continue;
+
+        const auto EQ             = FILTER.find('=');
+        const auto [IT, INSERTED] = m_subscriptions.try_emplace(std::string{FILTER.substr(0, EQ)});
+
+        // a plain name accepts everything, that wins over predicates
+        if (EQ == std::string_view::npos)
+            IT->second.clear();
+        else if (INSERTED || !IT->second.empty())
+            IT->second.emplace_back(FILTER.substr(EQ + 1));
+    }
+
+    m_subscribed = true;
+}
+
+bool CUnixPeer::wants(const SEvent& event) const {
+    if (!m_subscribed)
+        return true;
+
+    const auto IT = m_subscriptions.find(event.event);
+    if (IT == m_subscriptions.end())
+        return false;
+
+    if (IT->second.empty())
+        return true;
+
+    const auto FIRST = std::string_view{event.data}.substr(0, event.data.find(','));
+    return std::ranges::contains(IT->second, FIRST);
+}
+
 bool CUnixPeer::flush() {
-    while (!m_events.empty()) {
-        const auto& event     = m_events.front();
-        const auto  REMAINING = event->length() - m_writeOffset;
-        const auto  WRITTEN   = write(m_fd.get(), event->c_str() + m_writeOffset, REMAINING);
+    // one writev per iteration, the kernel takes as much as fits into the socket buffer
+    constexpr size_t            MAX_IOVS = 64;
+
+    std::array<iovec, MAX_IOVS> iovs;
+
+    while (m_count > 0) {
+        const size_t IOVS  = std::min(m_count, MAX_IOVS);
+        size_t       total = 0;
+
+        for (size_t i = 0; i < IOVS; ++i) {
+            const auto&  event  = at(i);
+            const size_t OFFSET = i == 0 ? m_writeOffset : 0;
+            iovs[i]             = {.iov_base = event->data() + OFFSET, .iov_len = event->length() - OFFSET};
+            total += iovs[i].iov_len;
+        }
+
+        const auto WRITTEN = writev(m_fd.get(), iovs.data(), sc<int>(IOVS));
 
         if (WRITTEN > 0) {
-            m_writeOffset += sc<size_t>(WRITTEN);
-            if (m_writeOffset < event->length())
-                return true;
+            size_t left = sc<size_t>(WRITTEN);
+
+            while (left > 0) {
+                const auto REMAINING = at(0)->length() - m_writeOffset;
+                if (left < REMAINING) {
+                    m_writeOffset += left;
+                    break;
+                }
+
+                left -= REMAINING;
+                m_writeOffset = 0;
+                pop();
+            }
+
+            // short write: the socket is full, wait for it to become writable
+            if (sc<size_t>(WRITTEN) < total)
+                break;
 
-            m_writeOffset = 0;
-            m_events.erase(m_events.begin());
             continue;
         }
 
         if (WRITTEN < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
-            return true;
+            break;
 
         if (WRITTEN < 0 && errno == EINTR)
             continue;
@@ -63,24 +240,58 @@ bool CUnixPeer::flush() {
         return false;
     }
 
-    wl_event_source_fd_update(m_eventSource, 0);
+    setWritable(m_count > 0);
     return true;
 }
 
 size_t CUnixPeer::queueSize() const {
-    return m_events.size();
+    return m_count;
 }
 
-bool CUnixPeer::addEvent(const SP<std::string>& x) {
-    m_events.emplace_back(x);
+static std::string_view eventName(const std::string& event) {
+    return std::string_view{event}.substr(0, event.find(">>"));
+}
 
-    if (!flush())
-        return false;
+bool CUnixPeer::makeRoom(const SP<std::string>& incoming, eOverflowPolicy policy) {
+    // a partially written event has to go out whole, or the stream breaks
+    const size_t FIRST_DROPPABLE = m_writeOffset > 0 ? 1 : 0;
+
+    switch (policy) {
+        case OVERFLOW_DISCONNECT: Log::logger->log(Log::ERR, "[Socket2::UnixPeer] fd {} overflowed event queue, removing", id()); return false;
+        case OVERFLOW_COALESCE: {
+            // the client will only care about the latest state of e.g. activewindow, drop the stale one
+            const auto NAME = eventName(*incoming);
+            for (size_t i = FIRST_DROPPABLE; i < m_count; ++i) {
+                if (eventName(*at(i)) != NAME)
+                    continue;
+
+                erase(i);
+                m_stats.coalesced++;
+                return true;
+            }
 
-    if (!m_events.empty() && queueSize() <= 1)
-        wl_event_source_fd_update(m_eventSource, WL_EVENT_WRITABLE);
+            // nothing to coalesce with, fall back to dropping
+            [[fallthrough]];
+        }
+        case OVERFLOW_DROP_OLDEST:
+            erase(FIRST_DROPPABLE);
+            m_stats.dropped++;
+            return true;
+    }
 
-    return true;
+    return false;
+}
+
+bool CUnixPeer::addEvent(const SP<std::string>& x, size_t limit, eOverflowPolicy policy) {
+    while (m_count >= limit) {
+        if (!makeRoom(x, policy))
+            return false;
+    }
+
+    reserve(limit);
+    push(x);
+
+    return flush();
 }
 
 CUnixImpl::CUnixImpl() : m_socket(socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0)) {
@@ -156,13 +367,18 @@ int CUnixImpl::onClientEvent(int fd, uint32_t mask) {
         return 0;
     }
 
-    if (mask & WL_EVENT_WRITABLE) {
-        const auto PCLIENT = findByFd(fd);
+    const auto PCLIENT = findByFd(fd);
+    if (!PCLIENT)
+        return 0;
 
-        if (PCLIENT && !PCLIENT->flush())
-            std::erase(m_peers, PCLIENT);
+    if (mask & WL_EVENT_READABLE && !PCLIENT->onReadable()) {
+        std::erase(m_peers, PCLIENT);
+        return 0;
     }
 
+    if (mask & WL_EVENT_WRITABLE && !PCLIENT->flush())
+        std::erase(m_peers, PCLIENT);
+
     return 0;
 }
 
@@ -183,21 +399,27 @@ SP<CUnixPeer> CUnixImpl::findByFd(int fd) const {
     return *it;
 }
 
-bool CUnixImpl::send(std::string&& x) {
-    constexpr const size_t MAX_QUEUED_EVENTS = 64;
+bool CUnixImpl::wants(const SEvent& event) const {
+    return std::ranges::any_of(m_peers, [&event](const auto& p) { return p->wants(event); });
+}
 
-    auto                   p = makeShared<std::string>(std::move(x));
+bool CUnixImpl::send(const SEvent& event, std::string&& formatted) {
+    static auto PLIMIT  = CConfigValue<Config::INTEGER>("misc:socket2_queue_limit");
+    static auto PPOLICY = CConfigValue<Config::INTEGER>("misc:socket2_overflow_policy");
 
-    for (auto it = m_peers.begin(); it != m_peers.end();) {
-        const auto& PEER = *it;
+    // at least 2, a partially written event can't be dropped
+    const auto  LIMIT  = sc<size_t>(std::max<Config::INTEGER>(*PLIMIT, 2));
+    const auto  POLICY = sc<CUnixPeer::eOverflowPolicy>(*PPOLICY);
 
-        if (PEER->queueSize() >= MAX_QUEUED_EVENTS) {
-            Log::logger->log(Log::ERR, "[Socket2::UnixImpl] fd {} overflowed event queue, removing", (*it)->id());
-            it = m_peers.erase(it);
+    auto        p = makeShared<std::string>(std::move(formatted));
+
+    for (auto it = m_peers.begin(); it != m_peers.end();) {
+        if (!(*it)->wants(event)) {
+            ++it;
             continue;
         }
 
-        if (!PEER->addEvent(p)) {
+        if (!(*it)->addEvent(p, LIMIT, POLICY)) {
             it = m_peers.erase(it);
             continue;
         }
@@ -206,4 +428,15 @@ bool CUnixImpl::send(std::string&& x) {
     }
 
     return true;
-}
\ No newline at end of file
+}
+
+std::vector<SClientStats> CUnixImpl::clientStats() const {
+    std::vector<SClientStats> result;
+    result.reserve(m_peers.size());
+
+    for (const auto& p : m_peers) {
+        result.emplace_back(p->stats());
+    }
+
+    return result;
+}
@@ -7,6 +7,8 @@
 #include <hyprutils/os/FileDescriptor.hpp>
 #include <wayland-server-core.h>
 
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace IPC::Socket2 {
@@ -15,17 +17,52 @@ namespace IPC::Socket2 {
         CUnixPeer(Hyprutils::OS::CFileDescriptor&& fd, void* parent);
         virtual ~CUnixPeer();
 
-        virtual size_t id() const override;
+        enum eOverflowPolicy : uint8_t {
+            OVERFLOW_DISCONNECT = 0,
+            OVERFLOW_DROP_OLDEST,
+            OVERFLOW_COALESCE,
+        };
 
-        bool           flush();
-        size_t         queueSize() const;
-        bool           addEvent(const SP<std::string>&);
+        virtual size_t       id() const override;
+        virtual SClientStats stats() const override;
+
+        bool                 flush();
+        size_t               queueSize() const;
+        // false if the peer has to go, either because writing failed or because it overflowed with OVERFLOW_DISCONNECT
+        bool addEvent(const SP<std::string>&, size_t limit, eOverflowPolicy policy);
+
+        // reads subscription requests, false if the peer has to go
+        bool onReadable();
+        bool wants(const SEvent& event) const;
 
       private:
+        // events are shared between all peers, the ring only holds refs. The front one may be partially written.
+        SP<std::string>&               at(size_t i);
+        void                           push(const SP<std::string>& x);
+        void                           pop();
+        void                           erase(size_t i);
+        void                           reserve(size_t capacity);
+        void                           setWritable(bool writable);
+        void                           updateMask();
+        bool                           makeRoom(const SP<std::string>& incoming, eOverflowPolicy policy);
+        void                           parseRequest(std::string_view request);
+
         Hyprutils::OS::CFileDescriptor m_fd;
-        std::vector<SP<std::string>>   m_events;
+        std::vector<SP<std::string>>   m_ring;
+        size_t                         m_head        = 0;
+        size_t                         m_count       = 0;
         wl_event_source*               m_eventSource = nullptr;
         size_t                         m_writeOffset = 0;
+        bool                           m_writable    = false;
+        bool                           m_readable    = true;
+        std::string                    m_readBuffer;
+
+        // event name -> accepted values of the first data field, empty accepts any.
+        // A peer that never subscribed gets everything.
+        std::unordered_map<std::string, std::vector<std::string>> m_subscriptions;
+        bool                                                      m_subscribed = false;
+
+        SClientStats                                              m_stats;
     };
 
     class CUnixImpl : public IImplementation {
@@ -33,10 +70,12 @@ namespace IPC::Socket2 {
         CUnixImpl();
         virtual ~CUnixImpl();
 
-        virtual bool send(std::string&& x) override;
+        virtual bool                      wants(const SEvent& event) const override;
+        virtual bool                      send(const SEvent& event, std::string&& formatted) override;
+        virtual std::vector<SClientStats> clientStats() const override;
 
-        int          onServerEvent(int fd, uint32_t mask);
-        int          onClientEvent(int fd, uint32_t mask);
+        int                               onServerEvent(int fd, uint32_t mask);
+        int                               onClientEvent(int fd, uint32_t mask);
 
       private:
         void                           removeByFd(int fd);
@@ -205,6 +205,10 @@ bool CBind::matchesContext(const SBindEventContext& ctx) const {
     if (!(m_flags & BIND_FLAG_SUBMAP_UNIVERSAL) && m_metadata.submap != ctx.submap)
         return false;
 
+    return (m_flags & BIND_FLAG_IGNORE_MODS) || effectiveModifiers(ctx) == m_modmask;
+}
+
+ModifierMask CBind::effectiveModifiers(const SBindEventContext& ctx) {
     auto effectiveMods = ctx.pressed ? ctx.modifiersNow : ctx.modifiersAtPress;
     if (ctx.pressed) {
         for (const auto& key : ctx.heldKeys) {
@@ -214,7 +218,7 @@ bool CBind::matchesContext(const SBindEventContext& ctx) const {
     } else if (ctx.trigger && ctx.trigger->modifier)
         effectiveMods |= *ctx.trigger->modifier;
 
-    return (m_flags & BIND_FLAG_IGNORE_MODS) || effectiveMods == m_modmask;
+    return effectiveMods;
 }
 
 SBindResult CBind::invoke() const {
@@ -83,6 +83,8 @@ namespace Keybinds {
     class CBind {
       public:
         static std::expected<CBind, std::string> make(std::vector<std::string>&& keys, BindFlags flags, BindCallback&& callback, SExtraBindArgs&& args = {});
+        // the modifiers a bind has to want to match in ctx, unless it ignores mods
+        static Input::ModifierMask effectiveModifiers(const SBindEventContext& ctx);
 
         CBind(CBind&&) noexcept                                        = default;
         CBind& operator=(CBind&&) noexcept                             = default;
@@ -464,7 +464,7 @@ SBindResult CKeybindManager::processEvent(const SBindEventContext& context, cons
         }
     }
 
-    for (const auto& bind : m_registry.binds()) {
+    for (const auto& bind : m_registry.candidates(context)) {
         if (!canInvokeNow(bind))
             continue;
         if (!context.pressed && pressedInput && pressedInput->capturedAtPress && !bind->hasFlag(BIND_FLAG_ALLOW_INPUT_CAPTURE))
@@ -2,36 +2,141 @@
 
 #include <algorithm>
 #include <cctype>
+#include <functional>
 
 using namespace Keybinds;
 
+namespace {
+    enum eKeyKind : uint8_t {
+        KEY_SYM = 0,
+        KEY_CODE,
+        KEY_MODIFIER,
+        KEY_EVENT,
+    };
+
+    // stands in for "any modifiers" / "any submap" in the index
+    constexpr uint64_t INDEX_WILDCARD = 1ULL << 40;
+}
+
+static void hashCombine(uint64_t& hash, uint64_t value) {
+    hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+}
+
+static uint64_t indexHash(eKeyKind kind, uint64_t value, std::optional<Input::ModifierMask> mods, const std::string* submap) {
+    uint64_t hash = kind;
+    hashCombine(hash, value);
+    hashCombine(hash, mods ? sc<uint64_t>(*mods) : INDEX_WILDCARD);
+    hashCombine(hash, submap ? std::hash<std::string>{}(*submap) : INDEX_WILDCARD);
+    return hash;
+}
+
+template <typename F>
+static void forEachKeyId(const CKey& key, F&& fn) {
+    if (const auto EV = key.event()) {
+        fn(KEY_EVENT, std::hash<std::string_view>{}(*EV));
+        return;
+    }
+
+    if (const auto MOD = key.modifier()) {
+        fn(KEY_MODIFIER, sc<uint64_t>(*MOD));
+        return;
+    }
+
+    if (const auto SYM = key.keysym())
+        fn(KEY_SYM, *SYM);
+    if (const auto CODE = key.keycode())
+        fn(KEY_CODE, *CODE);
+}
+
+// every id a bind key matching this resolved key could have been indexed under, see CKey::matches
+template <typename F>
+static void forEachKeyId(const SResolvedKey& key, F&& fn) {
+    if (key.event) {
+        fn(KEY_EVENT, std::hash<std::string_view>{}(*key.event));
+        return;
+    }
+
+    fn(KEY_SYM, key.sym);
+    fn(KEY_CODE, key.code);
+    if (key.modifier)
+        fn(KEY_MODIFIER, sc<uint64_t>(*key.modifier));
+}
+
+// the single non-modifier key of a bind, if it has exactly one
+static const CKey* singleTrigger(const CBind& bind) {
+    const CKey* trigger = nullptr;
+    for (const auto& key : bind.keys()) {
+        if (key.isMod())
+            continue;
+        if (trigger)
+            return nullptr;
+
+        trigger = &key;
+    }
+
+    return trigger;
+}
+
+static bool isShortcutConflict(const CBind& bind, xkb_keysym_t keysym, Input::ModifierMask modifiers, xkb_state* xkbState) {
+    if (!bind.enabled() || bind.hasFlag(BIND_FLAG_MOUSE) || !bind.metadata().submap.empty() || bind.modifierMask() != modifiers)
+        return false;
+
+    const auto TRIGGER = singleTrigger(bind);
+    if (!TRIGGER)
+        return false;
+
+    auto bindSym = TRIGGER->keysym().value_or(XKB_KEY_NoSymbol);
+    if (bindSym == XKB_KEY_NoSymbol && TRIGGER->keycode() && xkbState)
+        bindSym = xkb_state_key_get_one_sym(xkbState, *TRIGGER->keycode());
+
+    return bindSym == keysym;
+}
+
 PBind CRegistry::add(CBind&& bind) {
     auto result = makeShared<CBind>(std::move(bind));
     m_binds.emplace_back(result);
+    index({.seq = m_nextSeq++, .bind = result});
     return result;
 }
 
 bool CRegistry::remove(const PBind& bind) {
-    return std::erase(m_binds, bind) > 0;
+    if (std::erase(m_binds, bind) == 0)
+        return false;
+
+    unindex(bind);
+    return true;
 }
 
 size_t CRegistry::removeByDisplayKey(std::string_view displayKey) {
-    const auto NORMALIZED = normalizeDisplayKey(displayKey);
-    return std::erase_if(m_binds, [&NORMALIZED](const auto& bind) { return normalizeDisplayKey(bind->metadata().displayKey) == NORMALIZED; });
+    const auto IT = m_byDisplayKey.find(normalizeDisplayKey(displayKey));
+    if (IT == m_byDisplayKey.end())
+        return 0;
+
+    // unindex() erases from the display key bucket too
+    const auto REMOVED = IT->second;
+    for (const auto& bind : REMOVED) {
+        std::erase(m_binds, bind);
+        unindex(bind);
+    }
+
+    return REMOVED.size();
 }
 
 std::vector<PBind> CRegistry::findByDisplayKey(std::string_view displayKey) const {
-    const auto         NORMALIZED = normalizeDisplayKey(displayKey);
-    std::vector<PBind> result;
-    for (const auto& bind : m_binds) {
-        if (normalizeDisplayKey(bind->metadata().displayKey) == NORMALIZED)
-            result.emplace_back(bind);
-    }
-    return result;
+    const auto IT = m_byDisplayKey.find(normalizeDisplayKey(displayKey));
+    if (IT == m_byDisplayKey.end())
+        return {};
+
+    return IT->second;
 }
 
 void CRegistry::clear() {
     m_binds.clear();
+    m_byKey.clear();
+    m_catchAll.clear();
+    m_codeTriggered.clear();
+    m_byDisplayKey.clear();
+    m_submaps.clear();
 }
 
 std::span<const PBind> CRegistry::binds() const {
@@ -51,38 +156,137 @@ size_t CRegistry::size() const {
 }
 
 bool CRegistry::hasSubmap(std::string_view submap) const {
-    return std::ranges::any_of(m_binds, [submap](const auto& bind) { return bind->metadata().submap == submap; });
+    return m_submaps.contains(std::string{submap});
 }
 
-PBind CRegistry::findShortcutConflict(xkb_keysym_t keysym, Input::ModifierMask modifiers, xkb_state* xkbState) const {
-    for (const auto& bind : m_binds) {
-        if (!bind->enabled() || bind->hasFlag(BIND_FLAG_MOUSE) || !bind->metadata().submap.empty() || bind->modifierMask() != modifiers)
-            continue;
+void CRegistry::index(const SEntry& entry) {
+    const auto& BIND = *entry.bind;
 
-        const CKey* trigger = nullptr;
-        for (const auto& key : bind->keys()) {
-            if (key.isMod())
-                continue;
-            if (trigger) {
-                trigger = nullptr;
-                break;
-            }
+    m_byDisplayKey[normalizeDisplayKey(BIND.metadata().displayKey)].emplace_back(entry.bind);
+    m_submaps[BIND.metadata().submap]++;
 
-            trigger = &key;
+    if (BIND.hasFlag(BIND_FLAG_CATCH_ALL)) {
+        m_catchAll.emplace_back(entry);
+        return;
+    }
+
+    const auto  MODS   = BIND.hasFlag(BIND_FLAG_IGNORE_MODS) ? std::nullopt : std::optional{BIND.modifierMask()};
+    const auto* SUBMAP = BIND.hasFlag(BIND_FLAG_SUBMAP_UNIVERSAL) ? nullptr : &BIND.metadata().submap;
+
+    for (const auto& key : BIND.keys()) {
+        forEachKeyId(key, [&](eKeyKind kind, uint64_t value) {
+            auto& bucket = m_byKey[indexHash(kind, value, MODS, SUBMAP)];
+            // chords can repeat a key
+            if (bucket.empty() || bucket.back().bind != entry.bind)
+                bucket.emplace_back(entry);
+        });
+    }
+
+    if (const auto TRIGGER = singleTrigger(BIND); TRIGGER && TRIGGER->keycode() && !TRIGGER->keysym())
+        m_codeTriggered.emplace_back(entry);
+}
+
+void CRegistry::unindex(const PBind& bind) {
+    const auto isBind = [&bind](const auto& e) { return e.bind == bind; };
+
+    if (const auto IT = m_byDisplayKey.find(normalizeDisplayKey(bind->metadata().displayKey)); IT != m_byDisplayKey.end()) {
+        std::erase(IT->second, bind);
+        if (IT->second.empty())
+            m_byDisplayKey.erase(IT);
+    }
+
+    if (const auto IT = m_submaps.find(bind->metadata().submap); IT != m_submaps.end() && --IT->second == 0)
+        m_submaps.erase(IT);
+
+    std::erase_if(m_catchAll, isBind);
+    std::erase_if(m_codeTriggered, isBind);
+
+    const auto  MODS   = bind->hasFlag(BIND_FLAG_IGNORE_MODS) ? std::nullopt : std::optional{bind->modifierMask()};
+    const auto* SUBMAP = bind->hasFlag(BIND_FLAG_SUBMAP_UNIVERSAL) ? nullptr : &bind->metadata().submap;
+
+    for (const auto& key : bind->keys()) {
+        forEachKeyId(key, [&](eKeyKind kind, uint64_t value) {
+            const auto IT = m_byKey.find(indexHash(kind, value, MODS, SUBMAP));
+            if (IT == m_byKey.end())
+                return;
+
+            std::erase_if(IT->second, isBind);
+            if (IT->second.empty())
+                m_byKey.erase(IT);
+        });
+    }
+}
+
+std::vector<PBind> CRegistry::candidates(const SBindEventContext& ctx) const {
+    std::vector<const SEntry*> found;
+
+    const auto                 MODS = CBind::effectiveModifiers(ctx);
+
+    const auto                 probe = [&](eKeyKind kind, uint64_t value) {
+        for (const auto& mods : {std::optional{MODS}, std::optional<Input::ModifierMask>{}}) {
+            for (const auto* submap : {&ctx.submap, sc<const std::string*>(nullptr)}) {
+                const auto IT = m_byKey.find(indexHash(kind, value, mods, submap));
+                if (IT == m_byKey.end())
+                    continue;
+
+                for (const auto& e : IT->second) {
+                    found.emplace_back(&e);
+                }
+            }
         }
+    };
 
-        if (!trigger)
-            continue;
+    if (ctx.trigger)
+        forEachKeyId(*ctx.trigger, probe);
+
+    for (const auto& key : ctx.heldKeys) {
+        forEachKeyId(key, probe);
+    }
+
+    for (const auto& e : m_catchAll) {
+        found.emplace_back(&e);
+    }
+
+    std::ranges::sort(found, {}, &SEntry::seq);
+    const auto [FIRST, LAST] = std::ranges::unique(found, {}, &SEntry::seq);
+    found.erase(FIRST, LAST);
+
+    std::vector<PBind> result;
+    result.reserve(found.size());
+    for (const auto* e : found) {
+        result.emplace_back(e->bind);
+    }
+
+    return result;
+}
+
+PBind CRegistry::findShortcutConflict(xkb_keysym_t keysym, Input::ModifierMask modifiers, xkb_state* xkbState) const {
+    // the first conflicting bind in registration order wins
+    const SEntry*     best = nullptr;
+    const std::string NO_SUBMAP;
+
+    const auto        consider = [&](const SEntry& e) {
+        if ((!best || e.seq < best->seq) && isShortcutConflict(*e.bind, keysym, modifiers, xkbState))
+            best = &e;
+    };
 
-        auto bindSym = trigger->keysym().value_or(XKB_KEY_NoSymbol);
-        if (bindSym == XKB_KEY_NoSymbol && trigger->keycode() && xkbState)
-            bindSym = xkb_state_key_get_one_sym(xkbState, *trigger->keycode());
+    for (const auto& mods : {std::optional{modifiers}, std::optional<Input::ModifierMask>{}}) {
+        for (const auto* submap : {&NO_SUBMAP, sc<const std::string*>(nullptr)}) {
+            const auto IT = m_byKey.find(indexHash(KEY_SYM, keysym, mods, submap));
+            if (IT == m_byKey.end())
+                continue;
+
+            for (const auto& e : IT->second) {
+                consider(e);
+            }
+        }
+    }
 
-        if (bindSym == keysym)
-            return bind;
+    for (const auto& e : m_codeTriggered) {
+        consider(e);
     }
 
-    return nullptr;
+    return best ? best->bind : nullptr;
 }
 
 std::string CRegistry::normalizeDisplayKey(std::string_view displayKey) {
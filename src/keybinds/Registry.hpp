@@ -4,6 +4,7 @@
 
 #include <span>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace Keybinds {
@@ -25,9 +26,32 @@ namespace Keybinds {
         bool                   hasSubmap(std::string_view submap) const;
         PBind                  findShortcutConflict(xkb_keysym_t keysym, Input::ModifierMask modifiers, xkb_state* xkbState = nullptr) const;
 
+        // Binds that can match an event in ctx, in registration order: those with a key matching the trigger or a held key,
+        // under the context's modifiers and submap, plus catch-alls. A superset of what CBind::matches accepts.
+        std::vector<PBind> candidates(const SBindEventContext& ctx) const;
+
       private:
         static std::string normalizeDisplayKey(std::string_view displayKey);
 
+        struct SEntry {
+            uint64_t seq = 0;
+            PBind    bind;
+        };
+
+        void               index(const SEntry& entry);
+        void               unindex(const PBind& bind);
+
         std::vector<PBind> m_binds;
+        uint64_t           m_nextSeq = 0;
+
+        // hash of (key, modifiers, submap) -> binds with that key. Modifiers and submap are wildcards for binds that ignore them.
+        // Collisions only cost an extra matches() call.
+        std::unordered_map<uint64_t, std::vector<SEntry>>   m_byKey;
+        std::vector<SEntry>                                 m_catchAll;
+        std::unordered_map<std::string, std::vector<PBind>> m_byDisplayKey;
+        std::unordered_map<std::string, size_t>             m_submaps;
+
+        // keycode-only triggers, resolved to a keysym against the keymap in findShortcutConflict
+        std::vector<SEntry> m_codeTriggered;
     };
 }
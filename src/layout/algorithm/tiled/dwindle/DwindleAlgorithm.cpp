@@ -24,39 +24,43 @@ using namespace Layout::Tiled;
 
 using namespace Hyprutils::String;
 
-void SDwindleNodeData::recalcSizePosRecursive(bool force, bool horizontalOverride, bool verticalOverride) {
-    if (children[0]) {
+void CDwindleAlgorithm::recalcSizePosRecursive(DwindleNodeID id, bool force, bool horizontalOverride, bool verticalOverride) {
+    auto& node = m_nodes[id];
+
+    if (node.children[0] != DWINDLE_NONE) {
         static auto PSMARTSPLIT       = CConfigValue<Config::INTEGER>("dwindle:smart_split");
         static auto PPRESERVESPLIT    = CConfigValue<Config::INTEGER>("dwindle:preserve_split");
         static auto PFLMULT           = CConfigValue<Config::FLOAT>("dwindle:split_width_multiplier");
         static auto PPRECISEMOUSEMOVE = CConfigValue<Config::INTEGER>("dwindle:precise_mouse_move");
 
         if (*PPRESERVESPLIT == 0 && *PSMARTSPLIT == 0 && *PPRECISEMOUSEMOVE == 0)
-            splitTop = box.h * *PFLMULT > box.w;
+            node.splitTop = node.box.h * *PFLMULT > node.box.w;
 
         if (verticalOverride)
-            splitTop = true;
+            node.splitTop = true;
         else if (horizontalOverride)
-            splitTop = false;
+            node.splitTop = false;
 
-        const auto SPLITSIDE = !splitTop;
+        const auto SPLITSIDE = !node.splitTop;
+        const auto CHILDREN  = node.children;
+        const auto BOX       = node.box;
 
         if (SPLITSIDE) {
             // split left/right
-            const float FIRSTSIZE = box.w / 2.0 * splitRatio;
-            children[0]->box      = CBox{box.x, box.y, FIRSTSIZE, box.h}.noNegativeSize();
-            children[1]->box      = CBox{box.x + FIRSTSIZE, box.y, box.w - FIRSTSIZE, box.h}.noNegativeSize();
+            const float FIRSTSIZE    = BOX.w / 2.0 * node.splitRatio;
+            m_nodes[CHILDREN[0]].box = CBox{BOX.x, BOX.y, FIRSTSIZE, BOX.h}.noNegativeSize();
+            m_nodes[CHILDREN[1]].box = CBox{BOX.x + FIRSTSIZE, BOX.y, BOX.w - FIRSTSIZE, BOX.h}.noNegativeSize();
         } else {
             // split top/bottom
-            const float FIRSTSIZE = box.h / 2.0 * splitRatio;
-            children[0]->box      = CBox{box.x, box.y, box.w, FIRSTSIZE}.noNegativeSize();
-            children[1]->box      = CBox{box.x, box.y + FIRSTSIZE, box.w, box.h - FIRSTSIZE}.noNegativeSize();
+            const float FIRSTSIZE    = BOX.h / 2.0 * node.splitRatio;
+            m_nodes[CHILDREN[0]].box = CBox{BOX.x, BOX.y, BOX.w, FIRSTSIZE}.noNegativeSize();
+            m_nodes[CHILDREN[1]].box = CBox{BOX.x, BOX.y + FIRSTSIZE, BOX.w, BOX.h - FIRSTSIZE}.noNegativeSize();
         }
 
-        children[0]->recalcSizePosRecursive(force);
-        children[1]->recalcSizePosRecursive(force);
-    } else if (!pTarget.expired())
-        pTarget->setPositionGlobal(box);
+        recalcSizePosRecursive(CHILDREN[0], force);
+        recalcSizePosRecursive(CHILDREN[1], force);
+    } else if (const auto TARGET = node.pTarget.lock())
+        TARGET->setPositionGlobal(CBox{node.box});
 }
 
 void CDwindleAlgorithm::newTarget(SP<ITarget> target) {
@@ -64,10 +68,9 @@ void CDwindleAlgorithm::newTarget(SP<ITarget> target) {
 }
 
 void CDwindleAlgorithm::addTarget(SP<ITarget> target) {
-    const auto WORK_AREA = m_parent->space()->workArea();
+    const auto  WORK_AREA = m_parent->space()->workArea();
 
-    const auto PNODE = m_dwindleNodesData.emplace_back(makeShared<SDwindleNodeData>());
-    PNODE->self      = PNODE;
+    const auto  PNODE = m_nodes.create();
 
     const auto  PMONITOR   = m_parent->space()->workspace()->m_monitor;
     const auto  PWORKSPACE = m_parent->space()->workspace();
@@ -76,19 +79,19 @@ void CDwindleAlgorithm::addTarget(SP<ITarget> target) {
     static auto PDEFAULTSPLIT = CConfigValue<Config::FLOAT>("dwindle:default_split_ratio");
 
     // Populate the node with our window's data
-    PNODE->pTarget = target;
-    PNODE->isNode  = false;
+    m_nodes.setTarget(PNODE, target);
+    m_nodes[PNODE].isNode = false;
 
-    SP<SDwindleNodeData> OPENINGON;
+    DwindleNodeID OPENINGON = DWINDLE_NONE;
 
-    const auto           MOUSECOORDS = m_overrideFocalPoint.value_or(g_pInputManager->getMouseCoordsInternal());
-    const auto           ACTIVE_MON  = Desktop::focusState()->monitor();
+    const auto    MOUSECOORDS = m_overrideFocalPoint.value_or(g_pInputManager->getMouseCoordsInternal());
+    const auto    ACTIVE_MON  = Desktop::focusState()->monitor();
 
     if ((PWORKSPACE == ACTIVE_MON->m_activeWorkspace || (PWORKSPACE->m_isSpecialWorkspace && PMONITOR->m_activeSpecialWorkspace)) && !*PUSEACTIVE) {
         OPENINGON = getNodeFromWindow(
             Desktop::viewState()->hitTest().windowAt(MOUSECOORDS, Desktop::View::RESERVED_EXTENTS | Desktop::View::INPUT_EXTENTS | Desktop::View::SKIP_FULLSCREEN_PRIORITY));
 
-        if (!OPENINGON && State::monitorLayoutController()->isPointOnReservedArea(MOUSECOORDS, ACTIVE_MON))
+        if (OPENINGON == DWINDLE_NONE && State::monitorLayoutController()->isPointOnReservedArea(MOUSECOORDS, ACTIVE_MON))
             OPENINGON = getClosestNode(MOUSECOORDS);
 
     } else if (*PUSEACTIVE || m_overrideFocalPoint) {
@@ -100,53 +103,62 @@ void CDwindleAlgorithm::addTarget(SP<ITarget> target) {
                  ACTIVE_WINDOW->mapped())
             OPENINGON = getNodeFromWindow(ACTIVE_WINDOW);
 
-        if (!OPENINGON)
+        if (OPENINGON == DWINDLE_NONE)
             OPENINGON = getClosestNode(MOUSECOORDS, target);
     } else
         OPENINGON = getFirstNode();
 
     // first, check if OPENINGON isn't too big.
-    const auto PREDSIZEMAX = OPENINGON ? Vector2D(OPENINGON->box.w, OPENINGON->box.h) : PMONITOR->m_size;
+    const auto PREDSIZEMAX = OPENINGON != DWINDLE_NONE ? m_nodes[OPENINGON].box.size() : PMONITOR->m_size;
     if (const auto MAXSIZE = target->maxSize().value_or(Math::VECTOR2D_MAX); MAXSIZE.x < PREDSIZEMAX.x || MAXSIZE.y < PREDSIZEMAX.y) {
         // we can't continue. make it floating.
-        std::erase(m_dwindleNodesData, PNODE);
+        m_nodes.destroy(PNODE);
         m_parent->setFloating(target, true, true);
         return;
     }
 
     // last fail-safe to avoid duplicate fullscreens
-    if ((!OPENINGON || OPENINGON->pTarget.lock() == target) && getNodes() > 1) {
-        for (auto& node : m_dwindleNodesData) {
-            auto locked = node->pTarget.lock();
-            if (locked && locked != target) {
-                OPENINGON = node;
-                break;
-            }
-        }
+    if ((OPENINGON == DWINDLE_NONE || m_nodes[OPENINGON].pTarget.lock() == target) && getNodes() > 1) {
+        DwindleNodeID other = DWINDLE_NONE;
+        m_nodes.forEach([&other, &target, this](DwindleNodeID id, const SDwindleNodeData& node) {
+            const auto LOCKED = node.pTarget.lock();
+            if (LOCKED && LOCKED != target && (other == DWINDLE_NONE || node.seq < m_nodes[other].seq))
+                other = id;
+        });
+
+        if (other != DWINDLE_NONE)
+            OPENINGON = other;
     }
 
     // if it's the first, it's easy. Make it maximise-sized.
-    if (!OPENINGON || OPENINGON->pTarget.lock() == target) {
-        PNODE->box = WORK_AREA;
-        PNODE->pTarget->setPositionGlobal(PNODE->box);
+    if (OPENINGON == DWINDLE_NONE || m_nodes[OPENINGON].pTarget.lock() == target) {
+        m_nodes[PNODE].box = WORK_AREA;
+        if (m_nodes.root() == DWINDLE_NONE)
+            m_nodes.setRoot(PNODE);
+        target->setPositionGlobal(WORK_AREA);
         return;
     }
 
     // get the node under our cursor
 
-    const auto NEWPARENT = m_dwindleNodesData.emplace_back(makeShared<SDwindleNodeData>());
+    const auto NEWPARENTID = m_nodes.create();
+
+    // nothing gets created past this point, so these stay valid
+    auto& NEWPARENT = m_nodes[NEWPARENTID];
+    auto& NEWNODE   = m_nodes[PNODE];
+    auto& OPENED    = m_nodes[OPENINGON];
 
     // make the parent have the OPENINGON's stats
-    NEWPARENT->box        = OPENINGON->box;
-    NEWPARENT->pParent    = OPENINGON->pParent;
-    NEWPARENT->isNode     = true; // it is a node
-    NEWPARENT->splitRatio = std::clamp(*PDEFAULTSPLIT, 0.1F, 1.9F);
+    NEWPARENT.box        = OPENED.box;
+    NEWPARENT.pParent    = OPENED.pParent;
+    NEWPARENT.isNode     = true; // it is a node
+    NEWPARENT.splitRatio = std::clamp(*PDEFAULTSPLIT, 0.1F, 1.9F);
 
     static auto PWIDTHMULTIPLIER = CConfigValue<Config::FLOAT>("dwindle:split_width_multiplier");
 
     // if cursor over first child, make it first, etc
-    const auto SIDEBYSIDE = NEWPARENT->box.w > NEWPARENT->box.h * *PWIDTHMULTIPLIER;
-    NEWPARENT->splitTop   = !SIDEBYSIDE;
+    const auto SIDEBYSIDE = NEWPARENT.box.w > NEWPARENT.box.h * *PWIDTHMULTIPLIER;
+    NEWPARENT.splitTop    = !SIDEBYSIDE;
 
     static auto PFORCESPLIT                = CConfigValue<Config::INTEGER>("dwindle:force_split");
     static auto PERMANENTDIRECTIONOVERRIDE = CConfigValue<Config::INTEGER>("dwindle:permanent_direction_override");
@@ -167,95 +179,86 @@ void CDwindleAlgorithm::addTarget(SP<ITarget> target) {
             horizontalOverride = true;
 
         // 0 -> top and left | 1,2 -> right and bottom
-        if (m_overrideDirection % 3 == 0) {
-            NEWPARENT->children[1] = OPENINGON;
-            NEWPARENT->children[0] = PNODE;
-        } else {
-            NEWPARENT->children[0] = OPENINGON;
-            NEWPARENT->children[1] = PNODE;
-        }
+        if (m_overrideDirection % 3 == 0)
+            NEWPARENT.children = {PNODE, OPENINGON};
+        else
+            NEWPARENT.children = {OPENINGON, PNODE};
 
         // whether or not the override persists after opening one window
         if (*PERMANENTDIRECTIONOVERRIDE == 0)
             m_overrideDirection = Math::DIRECTION_DEFAULT;
     } else if (*PSMARTSPLIT == 1 || (*PPRECISEMOUSEMOVE == 1 && g_layoutManager->dragController()->wasDraggingWindow())) {
-        const auto PARENT_CENTER      = NEWPARENT->box.pos() + NEWPARENT->box.size() / 2;
-        const auto PARENT_PROPORTIONS = NEWPARENT->box.h / NEWPARENT->box.w;
+        const auto PARENT_CENTER      = NEWPARENT.box.pos() + NEWPARENT.box.size() / 2;
+        const auto PARENT_PROPORTIONS = NEWPARENT.box.h / NEWPARENT.box.w;
         const auto DELTA              = MOUSECOORDS - PARENT_CENTER;
         const auto DELTA_SLOPE        = DELTA.y / DELTA.x;
 
         if (abs(DELTA_SLOPE) < PARENT_PROPORTIONS) {
             if (DELTA.x > 0) {
                 // right
-                NEWPARENT->splitTop    = false;
-                NEWPARENT->children[0] = OPENINGON;
-                NEWPARENT->children[1] = PNODE;
+                NEWPARENT.splitTop = false;
+                NEWPARENT.children = {OPENINGON, PNODE};
             } else {
                 // left
-                NEWPARENT->splitTop    = false;
-                NEWPARENT->children[0] = PNODE;
-                NEWPARENT->children[1] = OPENINGON;
+                NEWPARENT.splitTop = false;
+                NEWPARENT.children = {PNODE, OPENINGON};
             }
         } else {
             if (DELTA.y > 0) {
                 // bottom
-                NEWPARENT->splitTop    = true;
-                NEWPARENT->children[0] = OPENINGON;
-                NEWPARENT->children[1] = PNODE;
+                NEWPARENT.splitTop = true;
+                NEWPARENT.children = {OPENINGON, PNODE};
             } else {
                 // top
-                NEWPARENT->splitTop    = true;
-                NEWPARENT->children[0] = PNODE;
-                NEWPARENT->children[1] = OPENINGON;
+                NEWPARENT.splitTop = true;
+                NEWPARENT.children = {PNODE, OPENINGON};
             }
         }
     } else if (*PFORCESPLIT == 0 || m_overrideFocalPoint || g_layoutManager->dragController()->wasDraggingWindow()) {
-        if ((SIDEBYSIDE && MOUSECOORDS.x < NEWPARENT->box.x + (NEWPARENT->box.w / 2.F)) || (!SIDEBYSIDE && MOUSECOORDS.y < NEWPARENT->box.y + (NEWPARENT->box.h / 2.F))) {
+        if ((SIDEBYSIDE && MOUSECOORDS.x < NEWPARENT.box.x + (NEWPARENT.box.w / 2.F)) || (!SIDEBYSIDE && MOUSECOORDS.y < NEWPARENT.box.y + (NEWPARENT.box.h / 2.F))) {
             // we are hovering over the first node, make PNODE first.
-            NEWPARENT->children[1] = OPENINGON;
-            NEWPARENT->children[0] = PNODE;
+            NEWPARENT.children = {PNODE, OPENINGON};
         } else {
             // we are hovering over the second node, make PNODE second.
-            NEWPARENT->children[0] = OPENINGON;
-            NEWPARENT->children[1] = PNODE;
+            NEWPARENT.children = {OPENINGON, PNODE};
         }
-    } else if (*PFORCESPLIT == 1) {
-        NEWPARENT->children[1] = OPENINGON;
-        NEWPARENT->children[0] = PNODE;
-    } else {
-        NEWPARENT->children[0] = OPENINGON;
-        NEWPARENT->children[1] = PNODE;
-    }
+    } else if (*PFORCESPLIT == 1)
+        NEWPARENT.children = {PNODE, OPENINGON};
+    else
+        NEWPARENT.children = {OPENINGON, PNODE};
 
     // split in favor of a specific window
-    if (*PSPLITBIAS && NEWPARENT->children[0] == PNODE)
-        NEWPARENT->splitRatio = 2.f - NEWPARENT->splitRatio;
+    if (*PSPLITBIAS && NEWPARENT.children[0] == PNODE)
+        NEWPARENT.splitRatio = 2.f - NEWPARENT.splitRatio;
 
     // and update the previous parent if it exists
-    if (OPENINGON->pParent) {
-        if (OPENINGON->pParent->children[0] == OPENINGON)
-            OPENINGON->pParent->children[0] = NEWPARENT;
+    if (OPENED.pParent != DWINDLE_NONE) {
+        auto& previous = m_nodes[OPENED.pParent];
+        if (previous.children[0] == OPENINGON)
+            previous.children[0] = NEWPARENTID;
         else
-            OPENINGON->pParent->children[1] = NEWPARENT;
-    }
+            previous.children[1] = NEWPARENTID;
+    } else
+        m_nodes.setRoot(NEWPARENTID);
 
     // Update the children
-    if (!verticalOverride && (NEWPARENT->box.w * *PWIDTHMULTIPLIER > NEWPARENT->box.h || horizontalOverride)) {
+    if (!verticalOverride && (NEWPARENT.box.w * *PWIDTHMULTIPLIER > NEWPARENT.box.h || horizontalOverride)) {
         // split left/right -> forced
-        OPENINGON->box = {NEWPARENT->box.pos(), Vector2D(NEWPARENT->box.w / 2.f, NEWPARENT->box.h)};
-        PNODE->box     = {Vector2D(NEWPARENT->box.x + NEWPARENT->box.w / 2.f, NEWPARENT->box.y), Vector2D(NEWPARENT->box.w / 2.f, NEWPARENT->box.h)};
+        OPENED.box  = {NEWPARENT.box.pos(), Vector2D(NEWPARENT.box.w / 2.f, NEWPARENT.box.h)};
+        NEWNODE.box = {Vector2D(NEWPARENT.box.x + NEWPARENT.box.w / 2.f, NEWPARENT.box.y), Vector2D(NEWPARENT.box.w / 2.f, NEWPARENT.box.h)};
     } else {
         // split top/bottom
-        OPENINGON->box = {NEWPARENT->box.pos(), Vector2D(NEWPARENT->box.w, NEWPARENT->box.h / 2.f)};
-        PNODE->box     = {Vector2D(NEWPARENT->box.x, NEWPARENT->box.y + NEWPARENT->box.h / 2.f), Vector2D(NEWPARENT->box.w, NEWPARENT->box.h / 2.f)};
+        OPENED.box  = {NEWPARENT.box.pos(), Vector2D(NEWPARENT.box.w, NEWPARENT.box.h / 2.f)};
+        NEWNODE.box = {Vector2D(NEWPARENT.box.x, NEWPARENT.box.y + NEWPARENT.box.h / 2.f), Vector2D(NEWPARENT.box.w, NEWPARENT.box.h / 2.f)};
     }
 
-    OPENINGON->pParent = NEWPARENT;
-    PNODE->pParent     = NEWPARENT;
+    OPENED.pParent  = NEWPARENTID;
+    NEWNODE.pParent = NEWPARENTID;
 
-    NEWPARENT->recalcSizePosRecursive(false, horizontalOverride, verticalOverride);
+    recalcSizePosRecursive(NEWPARENTID, false, horizontalOverride, verticalOverride);
 
-    calculateWorkspace();
+    // the new split took over OPENINGON's box, nothing outside of it moves
+    recalculateSubtree(NEWPARENTID);
 }
 
 void CDwindleAlgorithm::movedTarget(SP<ITarget> target, std::optional<Vector2D> focalPoint) {
@@ -270,7 +273,7 @@ void CDwindleAlgorithm::removeTarget(SP<ITarget> target) {
 
     const auto PNODE = getNodeFromTarget(target);
 
-    if (!PNODE) {
+    if (PNODE == DWINDLE_NONE) {
         Log::logger->log(Log::ERR, "onWindowRemovedTiling node null?");
         return;
     }
@@ -280,32 +283,38 @@ void CDwindleAlgorithm::removeTarget(SP<ITarget> target) {
         Fullscreen::controller()->setFullscreenMode(window, Fullscreen::FSMODE_NONE);
     }
 
-    const auto PPARENT = PNODE->pParent;
+    const auto PPARENT = m_nodes[PNODE].pParent;
 
-    if (!PPARENT) {
+    if (PPARENT == DWINDLE_NONE) {
         Log::logger->log(Log::DEBUG, "Removing last node (dwindle)");
-        std::erase(m_dwindleNodesData, PNODE);
+        m_nodes.destroy(PNODE);
         return;
     }
 
-    const auto PSIBLING = PPARENT->children[0] == PNODE ? PPARENT->children[1] : PPARENT->children[0];
+    auto&      parent      = m_nodes[PPARENT];
+    const auto PSIBLING    = parent.children[0] == PNODE ? parent.children[1] : parent.children[0];
+    const auto GRANDPARENT = parent.pParent;
 
-    PSIBLING->pParent = PPARENT->pParent;
+    // the sibling takes over its parent's place and box
+    m_nodes[PSIBLING].pParent = GRANDPARENT;
+    m_nodes[PSIBLING].box     = parent.box;
 
-    if (PPARENT->pParent != nullptr) {
-        if (PPARENT->pParent->children[0] == PPARENT)
-            PPARENT->pParent->children[0] = PSIBLING;
+    if (GRANDPARENT != DWINDLE_NONE) {
+        auto& grandparent = m_nodes[GRANDPARENT];
+        if (grandparent.children[0] == PPARENT)
+            grandparent.children[0] = PSIBLING;
         else
-            PPARENT->pParent->children[1] = PSIBLING;
-    }
-
-    PPARENT->valid = false;
-    PNODE->valid   = false;
+            grandparent.children[1] = PSIBLING;
+    } else
+        m_nodes.setRoot(PSIBLING);
 
-    std::erase(m_dwindleNodesData, PPARENT);
-    std::erase(m_dwindleNodesData, PNODE);
+    m_nodes.destroy(PPARENT);
+    m_nodes.destroy(PNODE);
 
-    recalculate();
+    if (Fullscreen::controller()->hasFullscreen(m_parent->space()->workspace(), true))
+        recalculate();
+    else
+        recalculateSubtree(PSIBLING);
 }
 
 void CDwindleAlgorithm::resizeTarget(const Vector2D& Δ, SP<ITarget> target, eRectCorner corner) {
@@ -314,7 +323,7 @@ void CDwindleAlgorithm::resizeTarget(const Vector2D& Δ, SP<ITarget> target, eRe
 
     const auto PNODE = getNodeFromTarget(target);
 
-    if (!PNODE)
+    if (PNODE == DWINDLE_NONE)
         return;
 
     static auto PANIMATE       = CConfigValue<Config::INTEGER>("misc:animate_manual_resizes");
@@ -337,118 +346,126 @@ void CDwindleAlgorithm::resizeTarget(const Vector2D& Δ, SP<ITarget> target, eRe
     if (DISPLAYBOTTOM && DISPLAYTOP)
         allowedMovement.y = 0;
 
+    // snap all windows, don't animate resizes if they are manual
+    auto snapIfDragged = [target, this] {
+        if (target != g_layoutManager->dragController()->target())
+            return;
+
+        m_nodes.forEach([](DwindleNodeID, SDwindleNodeData& node) {
+            if (node.isNode)
+                return;
+
+            if (const auto TARGET = node.pTarget.lock())
+                TARGET->warpPositionSize();
+        });
+    };
+
     if (*PSMARTRESIZING == 1) {
         // Identify inner and outer nodes for both directions
-        SP<SDwindleNodeData> PVOUTER = nullptr;
-        SP<SDwindleNodeData> PVINNER = nullptr;
-        SP<SDwindleNodeData> PHOUTER = nullptr;
-        SP<SDwindleNodeData> PHINNER = nullptr;
+        DwindleNodeID PVOUTER = DWINDLE_NONE;
+        DwindleNodeID PVINNER = DWINDLE_NONE;
+        DwindleNodeID PHOUTER = DWINDLE_NONE;
+        DwindleNodeID PHINNER = DWINDLE_NONE;
 
-        const auto           LEFT   = edgeLeft(corner) || DISPLAYRIGHT;
-        const auto           TOP    = edgeTop(corner) || DISPLAYBOTTOM;
-        const auto           RIGHT  = edgeRight(corner) || DISPLAYLEFT;
-        const auto           BOTTOM = edgeBottom(corner) || DISPLAYTOP;
-        const auto           NONE   = corner == CORNER_NONE;
+        const auto    LEFT   = edgeLeft(corner) || DISPLAYRIGHT;
+        const auto    TOP    = edgeTop(corner) || DISPLAYBOTTOM;
+        const auto    RIGHT  = edgeRight(corner) || DISPLAYLEFT;
+        const auto    BOTTOM = edgeBottom(corner) || DISPLAYTOP;
+        const auto    NONE   = corner == CORNER_NONE;
 
-        for (auto PCURRENT = PNODE; PCURRENT && PCURRENT->pParent; PCURRENT = PCURRENT->pParent.lock()) {
-            const auto PPARENT = PCURRENT->pParent;
+        for (auto PCURRENT = PNODE; m_nodes[PCURRENT].pParent != DWINDLE_NONE; PCURRENT = m_nodes[PCURRENT].pParent) {
+            const auto& PARENT = m_nodes[m_nodes[PCURRENT].pParent];
 
-            if (!PVOUTER && PPARENT->splitTop && (NONE || (TOP && PPARENT->children[1] == PCURRENT) || (BOTTOM && PPARENT->children[0] == PCURRENT)))
+            if (PVOUTER == DWINDLE_NONE && PARENT.splitTop && (NONE || (TOP && PARENT.children[1] == PCURRENT) || (BOTTOM && PARENT.children[0] == PCURRENT)))
                 PVOUTER = PCURRENT;
-            else if (!PVOUTER && !PVINNER && PPARENT->splitTop)
+            else if (PVOUTER == DWINDLE_NONE && PVINNER == DWINDLE_NONE && PARENT.splitTop)
                 PVINNER = PCURRENT;
-            else if (!PHOUTER && !PPARENT->splitTop && (NONE || (LEFT && PPARENT->children[1] == PCURRENT) || (RIGHT && PPARENT->children[0] == PCURRENT)))
+            else if (PHOUTER == DWINDLE_NONE && !PARENT.splitTop && (NONE || (LEFT && PARENT.children[1] == PCURRENT) || (RIGHT && PARENT.children[0] == PCURRENT)))
                 PHOUTER = PCURRENT;
-            else if (!PHOUTER && !PHINNER && !PPARENT->splitTop)
+            else if (PHOUTER == DWINDLE_NONE && PHINNER == DWINDLE_NONE && !PARENT.splitTop)
                 PHINNER = PCURRENT;
 
-            if (PVOUTER && PHOUTER)
+            if (PVOUTER != DWINDLE_NONE && PHOUTER != DWINDLE_NONE)
                 break;
         }
 
-        if (PHOUTER) {
-            PHOUTER->pParent->splitRatio = std::clamp(PHOUTER->pParent->splitRatio + allowedMovement.x * 2.f / PHOUTER->pParent->box.w, 0.1, 1.9);
+        if (PHOUTER != DWINDLE_NONE) {
+            const auto OUTERPARENT = m_nodes[PHOUTER].pParent;
+            m_nodes[OUTERPARENT].splitRatio = std::clamp(m_nodes[OUTERPARENT].splitRatio + allowedMovement.x * 2.f / m_nodes[OUTERPARENT].box.w, 0.1, 1.9);
 
-            if (PHINNER) {
-                const auto ORIGINAL = PHINNER->box.w;
-                PHOUTER->pParent->recalcSizePosRecursive(*PANIMATE == 0);
-                if (PHINNER->pParent->children[0] == PHINNER)
-                    PHINNER->pParent->splitRatio = std::clamp((ORIGINAL - allowedMovement.x) / PHINNER->pParent->box.w * 2.f, 0.1, 1.9);
+            if (PHINNER != DWINDLE_NONE) {
+                const auto INNERPARENT = m_nodes[PHINNER].pParent;
+                const auto ORIGINAL    = m_nodes[PHINNER].box.w;
+                recalcSizePosRecursive(OUTERPARENT, *PANIMATE == 0);
+                if (m_nodes[INNERPARENT].children[0] == PHINNER)
+                    m_nodes[INNERPARENT].splitRatio = std::clamp((ORIGINAL - allowedMovement.x) / m_nodes[INNERPARENT].box.w * 2.f, 0.1, 1.9);
                 else
-                    PHINNER->pParent->splitRatio = std::clamp(2 - (ORIGINAL + allowedMovement.x) / PHINNER->pParent->box.w * 2.f, 0.1, 1.9);
-                PHINNER->pParent->recalcSizePosRecursive(*PANIMATE == 0);
+                    m_nodes[INNERPARENT].splitRatio = std::clamp(2 - (ORIGINAL + allowedMovement.x) / m_nodes[INNERPARENT].box.w * 2.f, 0.1, 1.9);
+                recalcSizePosRecursive(INNERPARENT, *PANIMATE == 0);
             } else
-                PHOUTER->pParent->recalcSizePosRecursive(*PANIMATE == 0);
+                recalcSizePosRecursive(OUTERPARENT, *PANIMATE == 0);
         }
 
-        if (PVOUTER) {
-            PVOUTER->pParent->splitRatio = std::clamp(PVOUTER->pParent->splitRatio + allowedMovement.y * 2.f / PVOUTER->pParent->box.h, 0.1, 1.9);
+        if (PVOUTER != DWINDLE_NONE) {
+            const auto OUTERPARENT = m_nodes[PVOUTER].pParent;
+            m_nodes[OUTERPARENT].splitRatio = std::clamp(m_nodes[OUTERPARENT].splitRatio + allowedMovement.y * 2.f / m_nodes[OUTERPARENT].box.h, 0.1, 1.9);
 
-            if (PVINNER) {
-                const auto ORIGINAL = PVINNER->box.h;
-                PVOUTER->pParent->recalcSizePosRecursive(*PANIMATE == 0);
-                if (PVINNER->pParent->children[0] == PVINNER)
-                    PVINNER->pParent->splitRatio = std::clamp((ORIGINAL - allowedMovement.y) / PVINNER->pParent->box.h * 2.f, 0.1, 1.9);
+            if (PVINNER != DWINDLE_NONE) {
+                const auto INNERPARENT = m_nodes[PVINNER].pParent;
+                const auto ORIGINAL    = m_nodes[PVINNER].box.h;
+                recalcSizePosRecursive(OUTERPARENT, *PANIMATE == 0);
+                if (m_nodes[INNERPARENT].children[0] == PVINNER)
+                    m_nodes[INNERPARENT].splitRatio = std::clamp((ORIGINAL - allowedMovement.y) / m_nodes[INNERPARENT].box.h * 2.f, 0.1, 1.9);
                 else
-                    PVINNER->pParent->splitRatio = std::clamp(2 - (ORIGINAL + allowedMovement.y) / PVINNER->pParent->box.h * 2.f, 0.1, 1.9);
-                PVINNER->pParent->recalcSizePosRecursive(*PANIMATE == 0);
+                    m_nodes[INNERPARENT].splitRatio = std::clamp(2 - (ORIGINAL + allowedMovement.y) / m_nodes[INNERPARENT].box.h * 2.f, 0.1, 1.9);
+                recalcSizePosRecursive(INNERPARENT, *PANIMATE == 0);
             } else
-                PVOUTER->pParent->recalcSizePosRecursive(*PANIMATE == 0);
+                recalcSizePosRecursive(OUTERPARENT, *PANIMATE == 0);
         }
     } else {
         // get the correct containers to apply splitratio to
-        const auto PPARENT = PNODE->pParent;
+        const auto PPARENT = m_nodes[PNODE].pParent;
 
-        if (!PPARENT)
+        if (PPARENT == DWINDLE_NONE)
             return; // the only window on a workspace, ignore
 
-        const bool PARENTSIDEBYSIDE = !PPARENT->splitTop;
+        const bool PARENTSIDEBYSIDE = !m_nodes[PPARENT].splitTop;
 
         // Get the parent's parent
-        auto                          PPARENT2 = PPARENT->pParent;
+        auto                          PPARENT2 = m_nodes[PPARENT].pParent;
 
-        Hyprutils::Utils::CScopeGuard x([target, this] {
-            // snap all windows, don't animate resizes if they are manual
-            if (target == g_layoutManager->dragController()->target()) {
-                for (const auto& w : m_dwindleNodesData) {
-                    if (w->isNode)
-                        continue;
-
-                    w->pTarget->warpPositionSize();
-                }
-            }
-        });
+        Hyprutils::Utils::CScopeGuard x(snapIfDragged);
 
         // No parent means we have only 2 windows, and thus one axis of freedom
-        if (!PPARENT2) {
+        if (PPARENT2 == DWINDLE_NONE) {
+            auto& parent = m_nodes[PPARENT];
             if (PARENTSIDEBYSIDE) {
-                allowedMovement.x *= 2.f / PPARENT->box.w;
-                PPARENT->splitRatio = std::clamp(PPARENT->splitRatio + allowedMovement.x, 0.1, 1.9);
-                PPARENT->recalcSizePosRecursive(*PANIMATE == 0);
+                allowedMovement.x *= 2.f / parent.box.w;
+                parent.splitRatio = std::clamp(parent.splitRatio + allowedMovement.x, 0.1, 1.9);
             } else {
-                allowedMovement.y *= 2.f / PPARENT->box.h;
-                PPARENT->splitRatio = std::clamp(PPARENT->splitRatio + allowedMovement.y, 0.1, 1.9);
-                PPARENT->recalcSizePosRecursive(*PANIMATE == 0);
+                allowedMovement.y *= 2.f / parent.box.h;
+                parent.splitRatio = std::clamp(parent.splitRatio + allowedMovement.y, 0.1, 1.9);
             }
+            recalcSizePosRecursive(PPARENT, *PANIMATE == 0);
 
             return;
         }
 
         // Get first parent with other split
-        while (PPARENT2 && PPARENT2->splitTop == !PARENTSIDEBYSIDE)
-            PPARENT2 = PPARENT2->pParent;
+        while (PPARENT2 != DWINDLE_NONE && m_nodes[PPARENT2].splitTop == !PARENTSIDEBYSIDE)
+            PPARENT2 = m_nodes[PPARENT2].pParent;
 
         // no parent, one axis of freedom
-        if (!PPARENT2) {
+        if (PPARENT2 == DWINDLE_NONE) {
+            auto& parent = m_nodes[PPARENT];
             if (PARENTSIDEBYSIDE) {
-                allowedMovement.x *= 2.f / PPARENT->box.w;
-                PPARENT->splitRatio = std::clamp(PPARENT->splitRatio + allowedMovement.x, 0.1, 1.9);
-                PPARENT->recalcSizePosRecursive(*PANIMATE == 0);
+                allowedMovement.x *= 2.f / parent.box.w;
+                parent.splitRatio = std::clamp(parent.splitRatio + allowedMovement.x, 0.1, 1.9);
             } else {
-                allowedMovement.y *= 2.f / PPARENT->box.h;
-                PPARENT->splitRatio = std::clamp(PPARENT->splitRatio + allowedMovement.y, 0.1, 1.9);
-                PPARENT->recalcSizePosRecursive(*PANIMATE == 0);
+                allowedMovement.y *= 2.f / parent.box.h;
+                parent.splitRatio = std::clamp(parent.splitRatio + allowedMovement.y, 0.1, 1.9);
             }
+            recalcSizePosRecursive(PPARENT, *PANIMATE == 0);
 
             return;
         }
@@ -457,46 +474,38 @@ void CDwindleAlgorithm::resizeTarget(const Vector2D& Δ, SP<ITarget> target, eRe
         const auto SIDECONTAINER = PARENTSIDEBYSIDE ? PPARENT : PPARENT2;
         const auto TOPCONTAINER  = PARENTSIDEBYSIDE ? PPARENT2 : PPARENT;
 
-        allowedMovement.x *= 2.f / SIDECONTAINER->box.w;
-        allowedMovement.y *= 2.f / TOPCONTAINER->box.h;
+        allowedMovement.x *= 2.f / m_nodes[SIDECONTAINER].box.w;
+        allowedMovement.y *= 2.f / m_nodes[TOPCONTAINER].box.h;
 
-        SIDECONTAINER->splitRatio = std::clamp(SIDECONTAINER->splitRatio + allowedMovement.x, 0.1, 1.9);
-        TOPCONTAINER->splitRatio  = std::clamp(TOPCONTAINER->splitRatio + allowedMovement.y, 0.1, 1.9);
-        SIDECONTAINER->recalcSizePosRecursive(*PANIMATE == 0);
-        TOPCONTAINER->recalcSizePosRecursive(*PANIMATE == 0);
+        m_nodes[SIDECONTAINER].splitRatio = std::clamp(m_nodes[SIDECONTAINER].splitRatio + allowedMovement.x, 0.1, 1.9);
+        m_nodes[TOPCONTAINER].splitRatio  = std::clamp(m_nodes[TOPCONTAINER].splitRatio + allowedMovement.y, 0.1, 1.9);
+        recalcSizePosRecursive(SIDECONTAINER, *PANIMATE == 0);
+        recalcSizePosRecursive(TOPCONTAINER, *PANIMATE == 0);
     }
 
-    // snap all windows, don't animate resizes if they are manual
-    if (target == g_layoutManager->dragController()->target()) {
-        for (const auto& w : m_dwindleNodesData) {
-            if (w->isNode)
-                continue;
-
-            w->pTarget->warpPositionSize();
-        }
-    }
+    snapIfDragged();
 }
 
 SP<ITarget> CDwindleAlgorithm::getNextCandidate(SP<ITarget> old) {
     const auto MIDDLE = old->position().middle();
 
-    if (const auto NODE = getClosestNode(MIDDLE); NODE)
-        return NODE->pTarget.lock();
+    if (const auto NODE = getClosestNode(MIDDLE); NODE != DWINDLE_NONE)
+        return m_nodes[NODE].pTarget.lock();
 
-    if (const auto NODE = getFirstNode(); NODE)
-        return NODE->pTarget.lock();
+    if (const auto NODE = getFirstNode(); NODE != DWINDLE_NONE)
+        return m_nodes[NODE].pTarget.lock();
 
     return nullptr;
 }
 
 void CDwindleAlgorithm::swapTargets(SP<ITarget> a, SP<ITarget> b) {
-    auto nodeA = getNodeFromTarget(a);
-    auto nodeB = getNodeFromTarget(b);
+    const auto NODEA = getNodeFromTarget(a);
+    const auto NODEB = getNodeFromTarget(b);
 
-    if (nodeA)
-        nodeA->pTarget = b;
-    if (nodeB)
-        nodeB->pTarget = a;
+    if (NODEA != DWINDLE_NONE)
+        m_nodes.setTarget(NODEA, b);
+    if (NODEB != DWINDLE_NONE)
+        m_nodes.setTarget(NODEB, a);
 }
 
 void CDwindleAlgorithm::recalculate(eRecalculateReason reason) {
@@ -527,13 +536,13 @@ std::optional<Vector2D> CDwindleAlgorithm::predictSizeForNewTarget() {
     else {
         const auto PNODE = getNodeFromWindow(candidate);
 
-        if (!PNODE)
+        if (PNODE == DWINDLE_NONE)
             return {};
 
-        node = *PNODE;
+        node = m_nodes[PNODE];
         node.pTarget.reset();
 
-        CBox        box = PNODE->box;
+        CBox        box = node.box;
 
         static auto PFLMULT = CConfigValue<Config::FLOAT>("dwindle:split_width_multiplier");
 
@@ -560,7 +569,7 @@ void CDwindleAlgorithm::moveTargetInDirection(SP<ITarget> t, Math::eDirection di
     const auto     PNODE       = getNodeFromTarget(t);
     const Vector2D originalPos = t->position().middle();
 
-    if (!PNODE || !t->window())
+    if (PNODE == DWINDLE_NONE || !t->window())
         return;
 
     const auto FOCAL_POINT = focalPointForDir(t, dir);
@@ -573,13 +582,15 @@ void CDwindleAlgorithm::moveTargetInDirection(SP<ITarget> t, Math::eDirection di
     // if we're moving directly toward the most immediate split divider, and
     // our partner in the split is a single window, override the direction to
     // guarantee we spawn on the opposite side of that partner
-    const auto PARENT = PNODE->pParent;
-    if (PARENT) {
+    if (const auto PARENTID = m_nodes[PNODE].pParent; PARENTID != DWINDLE_NONE) {
+        const auto& PARENT = m_nodes[PARENTID];
+        const auto& FIRST  = m_nodes[PARENT.children[0]];
+        const auto& SECOND = m_nodes[PARENT.children[1]];
         // clang-format off
-        if (((dir == Math::DIRECTION_UP)    &&  PARENT->splitTop && (PARENT->children[1] == PNODE) && !PARENT->children[0]->isNode)  // moving up and we're on the bottom
-         || ((dir == Math::DIRECTION_DOWN)  &&  PARENT->splitTop && (PARENT->children[0] == PNODE) && !PARENT->children[1]->isNode)  // moving down and we're on the top
-         || ((dir == Math::DIRECTION_LEFT)  && !PARENT->splitTop && (PARENT->children[1] == PNODE) && !PARENT->children[0]->isNode)  // moving left and we're on the right
-         || ((dir == Math::DIRECTION_RIGHT) && !PARENT->splitTop && (PARENT->children[0] == PNODE) && !PARENT->children[1]->isNode)  // moving right and we're on the left
+        if (((dir == Math::DIRECTION_UP)    &&  PARENT.splitTop && (PARENT.children[1] == PNODE) && !FIRST.isNode)   // moving up and we're on the bottom
+         || ((dir == Math::DIRECTION_DOWN)  &&  PARENT.splitTop && (PARENT.children[0] == PNODE) && !SECOND.isNode)  // moving down and we're on the top
+         || ((dir == Math::DIRECTION_LEFT)  && !PARENT.splitTop && (PARENT.children[1] == PNODE) && !FIRST.isNode)   // moving left and we're on the right
+         || ((dir == Math::DIRECTION_RIGHT) && !PARENT.splitTop && (PARENT.children[0] == PNODE) && !SECOND.isNode)  // moving right and we're on the left
         ) {
             // clang-format on
             m_overrideDirection = dir;
@@ -603,8 +614,8 @@ void CDwindleAlgorithm::moveTargetInDirection(SP<ITarget> t, Math::eDirection di
     // restore focus to the previous position
     if (silent) {
         const auto PNODETOFOCUS = getClosestNode(originalPos);
-        if (PNODETOFOCUS && PNODETOFOCUS->pTarget)
-            Desktop::focusState()->fullWindowFocus(PNODETOFOCUS->pTarget->window(), Desktop::FOCUS_REASON_KEYBIND);
+        if (const auto TARGET = PNODETOFOCUS != DWINDLE_NONE ? m_nodes[PNODETOFOCUS].pTarget.lock() : nullptr)
+            Desktop::focusState()->fullWindowFocus(TARGET->window(), Desktop::FOCUS_REASON_KEYBIND);
     }
 }
 
@@ -619,57 +630,68 @@ void CDwindleAlgorithm::calculateWorkspace() {
 
     const auto TOPNODE = getMasterNode();
 
-    if (TOPNODE) {
-        TOPNODE->box = m_parent->space()->workArea();
-        TOPNODE->recalcSizePosRecursive();
+    if (TOPNODE != DWINDLE_NONE) {
+        m_nodes[TOPNODE].box = m_parent->space()->workArea();
+        recalcSizePosRecursive(TOPNODE);
     }
 }
 
-SP<SDwindleNodeData> CDwindleAlgorithm::getNodeFromTarget(SP<ITarget> t) {
-    for (const auto& n : m_dwindleNodesData) {
-        if (n->pTarget == t)
-            return n;
+void CDwindleAlgorithm::recalculateSubtree(DwindleNodeID id) {
+    if (!m_parent || !m_parent->space())
+        return;
+
+    const auto PWORKSPACE = m_parent->space()->workspace();
+    const auto TOPNODE    = getMasterNode();
+
+    if (!PWORKSPACE->m_monitor || Fullscreen::controller()->hasFullscreen(PWORKSPACE, true) || TOPNODE == DWINDLE_NONE)
+        return;
+
+    // boxes above id are only current if the work area didn't change since the last full pass
+    if (m_nodes[TOPNODE].box != m_parent->space()->workArea()) {
+        calculateWorkspace();
+        return;
     }
 
-    return nullptr;
+    recalcSizePosRecursive(id);
+}
+
+DwindleNodeID CDwindleAlgorithm::getNodeFromTarget(SP<ITarget> t) {
+    return m_nodes.find(t);
 }
 
-SP<SDwindleNodeData> CDwindleAlgorithm::getNodeFromWindow(PHLWINDOW w) {
-    return w ? getNodeFromTarget(w->layoutTarget()) : nullptr;
+DwindleNodeID CDwindleAlgorithm::getNodeFromWindow(PHLWINDOW w) {
+    return w ? getNodeFromTarget(w->layoutTarget()) : DWINDLE_NONE;
 }
 
 int CDwindleAlgorithm::getNodes() {
-    return m_dwindleNodesData.size();
+    return m_nodes.size();
 }
 
-SP<SDwindleNodeData> CDwindleAlgorithm::getFirstNode() {
-    return m_dwindleNodesData.empty() ? nullptr : m_dwindleNodesData.at(0);
+DwindleNodeID CDwindleAlgorithm::getFirstNode() {
+    return m_nodes.oldest();
 }
 
-SP<SDwindleNodeData> CDwindleAlgorithm::getClosestNode(const Vector2D& point, SP<ITarget> skip) {
-    SP<SDwindleNodeData> res         = nullptr;
-    double               distClosest = -1;
-    for (auto& n : m_dwindleNodesData) {
-        if (skip && n->pTarget == skip)
-            continue;
-
-        if (n->pTarget && Desktop::View::validMapped(n->pTarget->window())) {
-            auto distAnother = vecToRectDistanceSquared(point, n->box.pos(), n->box.pos() + n->box.size());
-            if (!res || distAnother < distClosest) {
-                res         = n;
+DwindleNodeID CDwindleAlgorithm::getClosestNode(const Vector2D& point, SP<ITarget> skip) {
+    DwindleNodeID res         = DWINDLE_NONE;
+    double        distClosest = -1;
+    m_nodes.forEach([&](DwindleNodeID id, const SDwindleNodeData& n) {
+        if (skip && n.pTarget == skip)
+            return;
+
+        if (n.pTarget && Desktop::View::validMapped(n.pTarget->window())) {
+            auto distAnother = vecToRectDistanceSquared(point, n.box.pos(), n.box.pos() + n.box.size());
+            // ties go to the older node
+            if (res == DWINDLE_NONE || distAnother < distClosest || (distAnother == distClosest && n.seq < m_nodes[res].seq)) {
+                res         = id;
                 distClosest = distAnother;
             }
         }
-    }
+    });
     return res;
 }
 
-SP<SDwindleNodeData> CDwindleAlgorithm::getMasterNode() {
-    for (auto& n : m_dwindleNodesData) {
-        if (!n->pParent)
-            return n;
-    }
-    return nullptr;
+DwindleNodeID CDwindleAlgorithm::getMasterNode() {
+    return m_nodes.root();
 }
 
 Config::ErrorResult CDwindleAlgorithm::layoutMsg(const std::string_view& sv) {
@@ -678,17 +700,17 @@ Config::ErrorResult CDwindleAlgorithm::layoutMsg(const std::string_view& sv) {
     const auto CURRENT_NODE = getNodeFromWindow(Desktop::focusState()->window());
 
     if (ARGS[0] == "togglesplit") {
-        if (CURRENT_NODE) {
+        if (CURRENT_NODE != DWINDLE_NONE) {
             if (!toggleSplit(CURRENT_NODE))
                 return Config::configError("can't togglesplit in the current workspace", Config::eConfigErrorLevel::WARNING, Config::eConfigErrorCode::INVALID_STATE);
         }
     } else if (ARGS[0] == "swapsplit") {
-        if (CURRENT_NODE) {
+        if (CURRENT_NODE != DWINDLE_NONE) {
             if (!swapSplit(CURRENT_NODE))
                 return Config::configError("can't swapsplit in the current workspace", Config::eConfigErrorLevel::WARNING, Config::eConfigErrorCode::INVALID_STATE);
         }
     } else if (ARGS[0] == "rotatesplit") {
-        if (CURRENT_NODE) {
+        if (CURRENT_NODE != DWINDLE_NONE) {
             int angle = 90;
             if (!ARGS[1].empty()) {
                 try {
@@ -754,114 +776,120 @@ Config::ErrorResult CDwindleAlgorithm::layoutMsg(const std::string_view& sv) {
 
         auto delta = getPlusMinusKeywordResult(std::string{ratio}, 0.F);
 
-        if (!CURRENT_NODE || !CURRENT_NODE->pParent)
+        if (CURRENT_NODE == DWINDLE_NONE || m_nodes[CURRENT_NODE].pParent == DWINDLE_NONE)
             return Config::configError("cannot alter split ratio on no / single node", Config::eConfigErrorLevel::WARNING, Config::eConfigErrorCode::INVALID_STATE);
 
         if (!delta)
             return Config::configError(std::format("failed to parse \"{}\" as a delta", ratio), Config::eConfigErrorLevel::ERROR, Config::eConfigErrorCode::INVALID_ARGUMENT);
 
-        const float newRatio              = exact ? *delta : CURRENT_NODE->pParent->splitRatio + *delta;
-        CURRENT_NODE->pParent->splitRatio = std::clamp(newRatio, 0.1F, 1.9F);
+        const auto  PARENT         = m_nodes[CURRENT_NODE].pParent;
+        const float newRatio       = exact ? *delta : m_nodes[PARENT].splitRatio + *delta;
+        m_nodes[PARENT].splitRatio = std::clamp(newRatio, 0.1F, 1.9F);
 
-        CURRENT_NODE->pParent->recalcSizePosRecursive();
+        recalcSizePosRecursive(PARENT);
     } else
         return Config::configError(std::format("Unknown dwindle layoutmsg: {}", sv), Config::eConfigErrorLevel::ERROR, Config::eConfigErrorCode::INVALID_ARGUMENT);
 
     return {};
 }
 
-bool CDwindleAlgorithm::toggleSplit(SP<SDwindleNodeData> x) {
-    if (!x || !x->pParent)
+bool CDwindleAlgorithm::toggleSplit(DwindleNodeID x) {
+    if (x == DWINDLE_NONE || m_nodes[x].pParent == DWINDLE_NONE)
         return false;
 
-    if (Fullscreen::controller()->isFullscreen(x->pTarget->window()))
+    if (Fullscreen::controller()->isFullscreen(m_nodes[x].pTarget->window()))
         return false;
 
-    x->pParent->splitTop = !x->pParent->splitTop;
+    const auto PARENT        = m_nodes[x].pParent;
+    m_nodes[PARENT].splitTop = !m_nodes[PARENT].splitTop;
 
-    x->pParent->recalcSizePosRecursive();
+    recalcSizePosRecursive(PARENT);
 
     return true;
 }
 
-bool CDwindleAlgorithm::swapSplit(SP<SDwindleNodeData> x) {
-    if (Fullscreen::controller()->isFullscreen(x->pTarget->window()) || !x->pParent)
+bool CDwindleAlgorithm::swapSplit(DwindleNodeID x) {
+    if (Fullscreen::controller()->isFullscreen(m_nodes[x].pTarget->window()) || m_nodes[x].pParent == DWINDLE_NONE)
         return false;
 
-    std::swap(x->pParent->children[0], x->pParent->children[1]);
+    const auto PARENT = m_nodes[x].pParent;
+    std::swap(m_nodes[PARENT].children[0], m_nodes[PARENT].children[1]);
 
-    x->pParent->recalcSizePosRecursive();
+    recalcSizePosRecursive(PARENT);
 
     return true;
 }
 
-void CDwindleAlgorithm::rotateSplit(SP<SDwindleNodeData> x, int angle) {
-    if (!x || !x->pParent)
+void CDwindleAlgorithm::rotateSplit(DwindleNodeID x, int angle) {
+    if (x == DWINDLE_NONE || m_nodes[x].pParent == DWINDLE_NONE)
         return;
 
-    if (Fullscreen::controller()->isFullscreen(x->pTarget->window()))
+    if (Fullscreen::controller()->isFullscreen(m_nodes[x].pTarget->window()))
         return;
 
     // normalize the angle to multiples of 90 degrees
-    int  normalizedAngle = ((sc<int>(angle / 90) % 4) + 4) % 4; // ensures positive modulo
+    int   normalizedAngle = ((sc<int>(angle / 90) % 4) + 4) % 4; // ensures positive modulo
 
-    auto pParent = x->pParent;
+    auto  pParent = m_nodes[x].pParent;
+    auto& parent  = m_nodes[pParent];
 
-    bool shouldSwap = false;
+    bool  shouldSwap = false;
 
     switch (normalizedAngle) {
         case 0: // 0 degrees - no change
             break;
         case 1:
-            if (pParent->splitTop)
+            if (parent.splitTop)
                 shouldSwap = true;
-            pParent->splitTop = !pParent->splitTop;
+            parent.splitTop = !parent.splitTop;
             break;
         case 2: shouldSwap = true; break;
         case 3:
-            if (!pParent->splitTop)
+            if (!parent.splitTop)
                 shouldSwap = true;
-            pParent->splitTop = !pParent->splitTop;
+            parent.splitTop = !parent.splitTop;
             break;
         default: break; // should never happen
     }
 
     if (shouldSwap)
-        std::swap(pParent->children[0], pParent->children[1]);
+        std::swap(parent.children[0], parent.children[1]);
 
-    pParent->recalcSizePosRecursive();
+    recalcSizePosRecursive(pParent);
 }
 
-bool CDwindleAlgorithm::moveToRoot(SP<SDwindleNodeData> x, bool stable) {
-    if (!x || !x->pParent)
+bool CDwindleAlgorithm::moveToRoot(DwindleNodeID x, bool stable) {
+    if (x == DWINDLE_NONE || m_nodes[x].pParent == DWINDLE_NONE)
         return false;
 
-    if (Fullscreen::controller()->isFullscreen(x->pTarget->window()))
+    if (Fullscreen::controller()->isFullscreen(m_nodes[x].pTarget->window()))
         return false;
 
     // already at root
-    if (!x->pParent->pParent)
+    if (m_nodes[m_nodes[x].pParent].pParent == DWINDLE_NONE)
         return false;
 
-    auto& pNode = x->pParent->children[0] == x ? x->pParent->children[0] : x->pParent->children[1];
+    auto& parent = m_nodes[m_nodes[x].pParent];
+    auto& pNode  = parent.children[0] == x ? parent.children[0] : parent.children[1];
 
     // instead of [getMasterNodeOnWorkspace], we walk back to root since we need
     // to know which children of root is our ancestor
-    auto pAncestor = x, pRoot = x->pParent.lock();
-    while (pRoot->pParent) {
+    auto pAncestor = x, pRoot = m_nodes[x].pParent;
+    while (m_nodes[pRoot].pParent != DWINDLE_NONE) {
         pAncestor = pRoot;
-        pRoot     = pRoot->pParent.lock();
+        pRoot     = m_nodes[pRoot].pParent;
     }
 
-    auto& pSwap = pRoot->children[0] == pAncestor ? pRoot->children[1] : pRoot->children[0];
+    auto& root  = m_nodes[pRoot];
+    auto& pSwap = root.children[0] == pAncestor ? root.children[1] : root.children[0];
     std::swap(pNode, pSwap);
-    std::swap(pNode->pParent, pSwap->pParent);
+    std::swap(m_nodes[pNode].pParent, m_nodes[pSwap].pParent);
 
     // [stable] in that the focused window occupies same side of screen
     if (stable)
-        std::swap(pRoot->children[0], pRoot->children[1]);
+        std::swap(root.children[0], root.children[1]);
 
-    pRoot->recalcSizePosRecursive();
+    recalcSizePosRecursive(pRoot);
 
     return true;
 }
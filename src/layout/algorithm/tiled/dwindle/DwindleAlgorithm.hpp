@@ -1,30 +1,11 @@
 #include "../../TiledAlgorithm.hpp"
+#include "DwindleNodeArena.hpp"
 
 namespace Layout {
     class CAlgorithm;
 }
 
 namespace Layout::Tiled {
-    struct SDwindleNodeData {
-        WP<SDwindleNodeData>                pParent;
-        bool                                isNode = false;
-        WP<ITarget>                         pTarget;
-        std::array<WP<SDwindleNodeData>, 2> children = {};
-        WP<SDwindleNodeData>                self;
-        bool                                splitTop               = false; // for preserve_split
-        CBox                                box                    = {0};
-        float                               splitRatio             = 1.f;
-        bool                                valid                  = true;
-        bool                                ignoreFullscreenChecks = false;
-
-        // For list lookup
-        bool operator==(const SDwindleNodeData& rhs) const {
-            return pTarget.lock() == rhs.pTarget.lock() && box == rhs.box && pParent == rhs.pParent && children[0] == rhs.children[0] && children[1] == rhs.children[1];
-        }
-
-        void recalcSizePosRecursive(bool force = false, bool horizontalOverride = false, bool verticalOverride = false);
-    };
-
     class CDwindleAlgorithm : public ITiledAlgorithm {
       public:
         CDwindleAlgorithm()          = default;
@@ -45,10 +26,10 @@ namespace Layout::Tiled {
         virtual void                    swapTargets(SP<ITarget> a, SP<ITarget> b);
         virtual void                    moveTargetInDirection(SP<ITarget> t, Math::eDirection dir, bool silent);
 
-        SP<SDwindleNodeData>            getNodeFromWindow(PHLWINDOW w);
+        DwindleNodeID                   getNodeFromWindow(PHLWINDOW w);
 
       private:
-        std::vector<SP<SDwindleNodeData>> m_dwindleNodesData;
+        CDwindleNodeArena m_nodes;
 
         struct {
             bool started = false;
@@ -61,16 +42,18 @@ namespace Layout::Tiled {
 
         void                    addTarget(SP<ITarget> target);
         void                    calculateWorkspace();
-        SP<SDwindleNodeData>    getNodeFromTarget(SP<ITarget>);
+        void                    recalculateSubtree(DwindleNodeID id);
+        void                    recalcSizePosRecursive(DwindleNodeID id, bool force = false, bool horizontalOverride = false, bool verticalOverride = false);
+        DwindleNodeID           getNodeFromTarget(SP<ITarget>);
         int                     getNodes();
-        SP<SDwindleNodeData>    getFirstNode();
-        SP<SDwindleNodeData>    getClosestNode(const Vector2D&, SP<ITarget> skip = nullptr);
-        SP<SDwindleNodeData>    getMasterNode();
-
-        bool                    toggleSplit(SP<SDwindleNodeData>);
-        bool                    swapSplit(SP<SDwindleNodeData>);
-        void                    rotateSplit(SP<SDwindleNodeData>, int angle = 90);
-        bool                    moveToRoot(SP<SDwindleNodeData>, bool stable = true);
+        DwindleNodeID           getFirstNode();
+        DwindleNodeID           getClosestNode(const Vector2D&, SP<ITarget> skip = nullptr);
+        DwindleNodeID           getMasterNode();
+
+        bool                    toggleSplit(DwindleNodeID);
+        bool                    swapSplit(DwindleNodeID);
+        void                    rotateSplit(DwindleNodeID, int angle = 90);
+        bool                    moveToRoot(DwindleNodeID, bool stable = true);
 
         Math::eDirection        m_overrideDirection = Math::DIRECTION_DEFAULT;
     };
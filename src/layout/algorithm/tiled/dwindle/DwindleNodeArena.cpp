@@ -0,0 +1,95 @@
+#include "DwindleNodeArena.hpp"
+
+using namespace Layout;
+using namespace Layout::Tiled;
+
+DwindleNodeID CDwindleNodeArena::create() {
+    DwindleNodeID id = DWINDLE_NONE;
+
+    if (!m_free.empty()) {
+        id = m_free.back();
+        m_free.pop_back();
+    } else {
+        id = m_nodes.size();
+        m_nodes.emplace_back();
+    }
+
+    m_nodes[id] = SDwindleNodeData{.valid = true, .seq = m_nextSeq++};
+    m_alive++;
+    return id;
+}
+
+void CDwindleNodeArena::destroy(DwindleNodeID id) {
+    if (id >= m_nodes.size() || !m_nodes[id].valid)
+        return;
+
+    setTarget(id, nullptr);
+
+    if (m_root == id)
+        m_root = DWINDLE_NONE;
+
+    m_nodes[id] = SDwindleNodeData{};
+    m_free.emplace_back(id);
+    m_alive--;
+}
+
+SDwindleNodeData& CDwindleNodeArena::operator[](DwindleNodeID id) {
+    return m_nodes[id];
+}
+
+const SDwindleNodeData& CDwindleNodeArena::operator[](DwindleNodeID id) const {
+    return m_nodes[id];
+}
+
+size_t CDwindleNodeArena::size() const {
+    return m_alive;
+}
+
+DwindleNodeID CDwindleNodeArena::root() const {
+    return m_root;
+}
+
+void CDwindleNodeArena::setRoot(DwindleNodeID id) {
+    m_root = id;
+}
+
+void CDwindleNodeArena::setTarget(DwindleNodeID id, SP<ITarget> target) {
+    auto& node = m_nodes[id];
+
+    if (const auto OLD = node.pTarget.lock()) {
+        if (const auto IT = m_targets.find(OLD.get()); IT != m_targets.end() && IT->second == id)
+            m_targets.erase(IT);
+    }
+
+    node.pTarget = target;
+
+    if (target)
+        m_targets[target.get()] = id;
+}
+
+DwindleNodeID CDwindleNodeArena::find(const SP<ITarget>& target) const {
+    if (!target)
+        return DWINDLE_NONE;
+
+    const auto IT = m_targets.find(target.get());
+    if (IT == m_targets.end())
+        return DWINDLE_NONE;
+
+    // a dead target's address may have been reused by a new one
+    const auto& NODE = m_nodes[IT->second];
+    return NODE.valid && NODE.pTarget.lock() == target ? IT->second : DWINDLE_NONE;
+}
+
+DwindleNodeID CDwindleNodeArena::oldest(bool withTarget) const {
+    DwindleNodeID result = DWINDLE_NONE;
+    for (DwindleNodeID id = 0; id < m_nodes.size(); ++id) {
+        const auto& NODE = m_nodes[id];
+        if (!NODE.valid || (withTarget && !NODE.pTarget))
+            continue;
+
+        if (result == DWINDLE_NONE || NODE.seq < m_nodes[result].seq)
+            result = id;
+    }
+
+    return result;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "../../../../helpers/math/Math.hpp"
+#include "../../../../helpers/memory/Memory.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace Layout {
+    class ITarget;
+}
+
+namespace Layout::Tiled {
+    using DwindleNodeID                         = uint32_t;
+    inline constexpr DwindleNodeID DWINDLE_NONE = std::numeric_limits<DwindleNodeID>::max();
+
+    struct SDwindleNodeData {
+        DwindleNodeID                pParent = DWINDLE_NONE;
+        bool                         isNode  = false;
+        WP<ITarget>                  pTarget;
+        std::array<DwindleNodeID, 2> children               = {DWINDLE_NONE, DWINDLE_NONE};
+        bool                         splitTop               = false; // for preserve_split
+        CBox                         box                    = {0};
+        float                        splitRatio             = 1.f;
+        bool                         valid                  = false; // false while the slot is free
+        bool                         ignoreFullscreenChecks = false;
+        uint64_t                     seq                    = 0; // creation order, for ties
+    };
+
+    // Dwindle nodes, stored in one vector and linked by index. Freed slots are reused, and targets
+    // map to their node directly. References to nodes are invalidated by create().
+    class CDwindleNodeArena {
+      public:
+        DwindleNodeID           create();
+        void                    destroy(DwindleNodeID id);
+
+        SDwindleNodeData&       operator[](DwindleNodeID id);
+        const SDwindleNodeData& operator[](DwindleNodeID id) const;
+        size_t                  size() const;
+
+        DwindleNodeID           root() const;
+        void                    setRoot(DwindleNodeID id);
+
+        void                    setTarget(DwindleNodeID id, SP<ITarget> target);
+        DwindleNodeID           find(const SP<ITarget>& target) const;
+
+        // the oldest node, optionally only among the ones with a target
+        DwindleNodeID           oldest(bool withTarget = false) const;
+
+        template <typename F>
+        void forEach(F&& fn) {
+            for (DwindleNodeID id = 0; id < m_nodes.size(); ++id) {
+                if (m_nodes[id].valid)
+                    fn(id, m_nodes[id]);
+            }
+        }
+
+      private:
+        std::vector<SDwindleNodeData>               m_nodes;
+        std::vector<DwindleNodeID>                  m_free;
+        std::unordered_map<ITarget*, DwindleNodeID> m_targets;
+        size_t                                      m_alive   = 0;
+        uint64_t                                    m_nextSeq = 0;
+        DwindleNodeID                               m_root    = DWINDLE_NONE;
+    };
+}
@@ -1,5 +1,6 @@
 #include "Target.hpp"
 #include "../space/Space.hpp"
+#include "../../desktop/state/ViewState.hpp"
 #include "../../debug/log/Logger.hpp"
 
 #include <hyprutils/utils/ScopeGuard.hpp>
@@ -11,6 +12,9 @@ void ITarget::setPositionGlobal(const STargetBox& box, uint8_t) {
     m_box = box;
     m_box.logicalBox.round();
     m_box.visualBox.round();
+
+    // tiled hit boxes come from here
+    Desktop::viewState()->invalidateHitIndex();
 }
 
 void ITarget::setPositionGlobal(const CBox& box, uint8_t flags) {
@@ -25,6 +25,23 @@
 using namespace Hyprutils::Utils;
 using namespace Layout;
 
+enum eExpressionVariable : uint8_t {
+    EXPR_VAR_WINDOW_W = 0,
+    EXPR_VAR_WINDOW_H,
+    EXPR_VAR_WINDOW_X,
+    EXPR_VAR_WINDOW_Y,
+    EXPR_VAR_MONITOR_W,
+    EXPR_VAR_MONITOR_H,
+    EXPR_VAR_CURSOR_X,
+    EXPR_VAR_CURSOR_Y,
+};
+
+// shared by all windows, the variables are rebound before every evaluation
+static Math::CExpressionCache& expressionCache() {
+    static Math::CExpressionCache cache({"window_w", "window_h", "window_x", "window_y", "monitor_w", "monitor_h", "cursor_x", "cursor_y"});
+    return cache;
+}
+
 SP<CWindowTarget> CWindowTarget::create(PHLWINDOW w) {
     auto target    = SP<CWindowTarget>(new CWindowTarget(w));
     target->m_self = target;
@@ -429,28 +446,28 @@ bool CWindowTarget::clampWindowSize(const std::optional<Vector2D> minSize, const
     return changed;
 }
 
-std::optional<double> CWindowTarget::calculateSingleExpr(const std::string& s) {
-    const auto        PMONITOR     = m_window->m_monitor ? m_window->m_monitor : Desktop::focusState()->monitor();
-    const auto        CURSOR_LOCAL = g_pInputManager->getMouseCoordsInternal() - (PMONITOR ? PMONITOR->m_position : Vector2D{});
+void CWindowTarget::bindExpressionVariables() {
+    const auto PMONITOR     = m_window->m_monitor ? m_window->m_monitor : Desktop::focusState()->monitor();
+    const auto CURSOR_LOCAL = g_pInputManager->getMouseCoordsInternal() - (PMONITOR ? PMONITOR->m_position : Vector2D{});
+    auto&      cache        = expressionCache();
 
-    Math::CExpression expr;
-    expr.addVariable("window_w", m_window->size(Desktop::View::IGeometric::GEOMETRIC_GOAL).x);
-    expr.addVariable("window_h", m_window->size(Desktop::View::IGeometric::GEOMETRIC_GOAL).y);
-    expr.addVariable("window_x", m_window->position(Desktop::View::IGeometric::GEOMETRIC_GOAL).x - (PMONITOR ? PMONITOR->m_position.x : 0));
-    expr.addVariable("window_y", m_window->position(Desktop::View::IGeometric::GEOMETRIC_GOAL).y - (PMONITOR ? PMONITOR->m_position.y : 0));
+    cache.setVariable(EXPR_VAR_WINDOW_W, m_window->size(Desktop::View::IGeometric::GEOMETRIC_GOAL).x);
+    cache.setVariable(EXPR_VAR_WINDOW_H, m_window->size(Desktop::View::IGeometric::GEOMETRIC_GOAL).y);
+    cache.setVariable(EXPR_VAR_WINDOW_X, m_window->position(Desktop::View::IGeometric::GEOMETRIC_GOAL).x - (PMONITOR ? PMONITOR->m_position.x : 0));
+    cache.setVariable(EXPR_VAR_WINDOW_Y, m_window->position(Desktop::View::IGeometric::GEOMETRIC_GOAL).y - (PMONITOR ? PMONITOR->m_position.y : 0));
 
-    expr.addVariable("monitor_w", PMONITOR ? PMONITOR->m_size.x : 1920);
-    expr.addVariable("monitor_h", PMONITOR ? PMONITOR->m_size.y : 1080);
+    cache.setVariable(EXPR_VAR_MONITOR_W, PMONITOR ? PMONITOR->m_size.x : 1920);
+    cache.setVariable(EXPR_VAR_MONITOR_H, PMONITOR ? PMONITOR->m_size.y : 1080);
 
-    expr.addVariable("cursor_x", CURSOR_LOCAL.x);
-    expr.addVariable("cursor_y", CURSOR_LOCAL.y);
-
-    return expr.compute(s);
+    cache.setVariable(EXPR_VAR_CURSOR_X, CURSOR_LOCAL.x);
+    cache.setVariable(EXPR_VAR_CURSOR_Y, CURSOR_LOCAL.y);
 }
 
 std::optional<Vector2D> CWindowTarget::calculateExpression(const Math::SExpressionVec2& expr) {
-    const auto LHS = calculateSingleExpr(expr.x);
-    const auto RHS = calculateSingleExpr(expr.y);
+    bindExpressionVariables();
+
+    const auto LHS = expressionCache().compute(expr.x);
+    const auto RHS = expressionCache().compute(expr.y);
 
     if (!LHS || !RHS)
         return std::nullopt;
@@ -41,7 +41,7 @@ namespace Layout {
       private:
         CWindowTarget(PHLWINDOW w);
 
-        std::optional<double> calculateSingleExpr(const std::string& s);
+        void                  bindExpressionVariables();
         Vector2D              clampSizeForDesired(const Vector2D& size);
 
         void                  updatePos(uint8_t flags = TARGET_UPDATE_NONE);
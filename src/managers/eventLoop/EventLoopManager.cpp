@@ -18,6 +18,10 @@ using namespace Hyprutils::OS;
 
 static uint64_t LAST_DO_LATER_SEQ = 1;
 
+// timers this close together fire in one wakeup
+constexpr auto TIMER_COALESCE_SLACK = std::chrono::microseconds(250);
+constexpr auto TIMER_SWEEP_INTERVAL = std::chrono::seconds(1);
+
 SEventLoopDoLaterLock::SEventLoopDoLaterLock(uint64_t seq_) : seq(seq_) {
     ;
 }
@@ -140,26 +144,44 @@ void CEventLoopManager::enterLoop() {
 }
 
 void CEventLoopManager::onTimerFire() {
-    const auto CPY = m_timers.timers;
-    for (auto const& t : CPY) {
-        if (t.strongRef() > 2 /* if it's 2, it was lost. Don't call it. */ && t->passed() && !t->cancelled())
-            t->call(t);
+    // anything due within the slack fires now too, instead of waking us up again right after
+    const auto DUE = m_timers.heap.popDue(Time::steadyNow() + TIMER_COALESCE_SLACK);
+
+    for (auto const& [t, stamp] : DUE) {
+        // an earlier callback could have removed, cancelled or rescheduled it
+        if (!m_timers.timers.contains(t.get()) || t->stamp() != stamp || t->cancelled())
+            continue;
+
+        // the manager and DUE hold the only refs, so it was lost. Don't call it.
+        if (t.strongRef() <= 2) {
+            m_timers.timers.erase(t.get());
+            continue;
+        }
+
+        t->call(t);
     }
 
     scheduleRecalc();
 }
 
 void CEventLoopManager::addTimer(SP<CEventLoopTimer> timer) {
-    if (std::ranges::contains(m_timers.timers, timer))
+    if (!m_timers.timers.emplace(timer.get(), timer).second)
         return;
-    m_timers.timers.emplace_back(timer);
+    m_timers.heap.push(timer);
     scheduleRecalc();
 }
 
 void CEventLoopManager::removeTimer(SP<CEventLoopTimer> timer) {
-    if (!std::ranges::contains(m_timers.timers, timer))
+    // its heap entry stays, but it won't fire without being registered
+    if (!m_timers.timers.erase(timer.get()))
         return;
-    std::erase_if(m_timers.timers, [timer](const auto& t) { return timer == t; });
+    scheduleRecalc();
+}
+
+void CEventLoopManager::rescheduleTimer(CEventLoopTimer* timer) {
+    if (const auto IT = m_timers.timers.find(timer); IT != m_timers.timers.end())
+        m_timers.heap.push(IT->second);
+
     scheduleRecalc();
 }
 
@@ -191,15 +213,18 @@ void CEventLoopManager::scheduleRecalc() {
 void CEventLoopManager::nudgeTimers() {
     m_timers.recalcScheduled = false;
 
-    // remove timers that have gone missing
-    std::erase_if(m_timers.timers, [](const auto& t) { return t.strongRef() <= 1; });
+    const auto NOW = Time::steadyNow();
+
+    // lost timers are dropped when they come due, disarmed ones only get found by a sweep now and then
+    if (NOW - m_timers.lastSweep >= TIMER_SWEEP_INTERVAL) {
+        std::erase_if(m_timers.timers, [](const auto& t) { return t.second.strongRef() <= 1; });
+        m_timers.lastSweep = NOW;
+    }
 
     long nextTimerUs = 10L * 1000 * 1000; // 10s
 
-    for (auto const& t : m_timers.timers) {
-        if (auto const& µs = t->leftUs(); µs < nextTimerUs)
-            nextTimerUs = µs;
-    }
+    if (const auto NEXT = m_timers.heap.next(); NEXT)
+        nextTimerUs = std::min<long>(nextTimerUs, std::chrono::duration_cast<std::chrono::microseconds>(*NEXT - NOW).count());
 
     nextTimerUs = std::clamp(nextTimerUs + 1, 1L, std::numeric_limits<long>::max());
 
@@ -4,11 +4,13 @@
 #include <map>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
 #include <wayland-server.h>
 #include "../../helpers/signal/Signal.hpp"
 #include <hyprutils/os/FileDescriptor.hpp>
 
 #include "EventLoopTimer.hpp"
+#include "EventLoopTimerHeap.hpp"
 
 namespace Aquamarine {
     struct SPollFD;
@@ -55,6 +57,9 @@ class CEventLoopManager {
     void addTimer(SP<CEventLoopTimer> timer);
     void removeTimer(SP<CEventLoopTimer> timer);
 
+    // called by timers when their deadline changes
+    void rescheduleTimer(CEventLoopTimer* timer);
+
     void onTimerFire();
 
     // schedules a recalc of the timers
@@ -94,9 +99,11 @@ class CEventLoopManager {
     } m_wayland;
 
     struct {
-        std::vector<SP<CEventLoopTimer>> timers;
-        Hyprutils::OS::CFileDescriptor   timerfd;
-        bool                             recalcScheduled = false;
+        std::unordered_map<CEventLoopTimer*, SP<CEventLoopTimer>> timers;
+        CEventLoopTimerHeap                                       heap;
+        Hyprutils::OS::CFileDescriptor                            timerfd;
+        bool                                                      recalcScheduled = false;
+        Time::steady_tp                                           lastSweep;
     } m_timers;
 
     SIdleData                        m_idle;
@@ -3,7 +3,11 @@
 #include "EventLoopManager.hpp"
 #include "../../helpers/time/Time.hpp"
 
+// shared by all timers, no two deadlines ever get the same stamp
+static uint64_t NEXT_STAMP = 1;
+
 CEventLoopTimer::CEventLoopTimer(std::optional<Time::steady_dur> timeout, std::function<void(SP<CEventLoopTimer> self, void* data)> cb_, void* data_) : m_cb(cb_), m_data(data_) {
+    bumpStamp();
 
     if (!timeout.has_value())
         m_expires.reset();
@@ -12,15 +16,15 @@ CEventLoopTimer::CEventLoopTimer(std::optional<Time::steady_dur> timeout, std::f
 }
 
 void CEventLoopTimer::updateTimeout(std::optional<Time::steady_dur> timeout) {
-    if (!timeout.has_value()) {
-        m_expires.reset();
-        g_pEventLoopManager->scheduleRecalc();
-        return;
-    }
+    bumpStamp();
 
-    m_expires = Time::steadyNow() + *timeout;
+    if (!timeout.has_value())
+        m_expires.reset();
+    else
+        m_expires = Time::steadyNow() + *timeout;
 
-    g_pEventLoopManager->scheduleRecalc();
+    if (g_pEventLoopManager)
+        g_pEventLoopManager->rescheduleTimer(this);
 }
 
 bool CEventLoopTimer::passed() {
@@ -32,6 +36,7 @@ bool CEventLoopTimer::passed() {
 void CEventLoopTimer::cancel() {
     m_wasCancelled = true;
     m_expires.reset();
+    bumpStamp();
 }
 
 bool CEventLoopTimer::cancelled() {
@@ -40,6 +45,7 @@ bool CEventLoopTimer::cancelled() {
 
 void CEventLoopTimer::call(SP<CEventLoopTimer> self) {
     m_expires.reset();
+    bumpStamp();
     m_cb(self, m_data);
 }
 
@@ -53,3 +59,15 @@ float CEventLoopTimer::leftUs() {
 bool CEventLoopTimer::armed() {
     return m_expires.has_value();
 }
+
+std::optional<Time::steady_tp> CEventLoopTimer::expires() const {
+    return m_expires;
+}
+
+uint64_t CEventLoopTimer::stamp() const {
+    return m_stamp;
+}
+
+void CEventLoopTimer::bumpStamp() {
+    m_stamp = NEXT_STAMP++;
+}
@@ -23,11 +23,17 @@ class CEventLoopTimer {
 
     bool  cancelled();
     // resets expires
-    void call(SP<CEventLoopTimer> self);
+    void                           call(SP<CEventLoopTimer> self);
+
+    std::optional<Time::steady_tp> expires() const;
+    uint64_t                       stamp() const; // changes whenever the deadline does
 
   private:
+    void                                                      bumpStamp();
+
     std::function<void(SP<CEventLoopTimer> self, void* data)> m_cb;
     void*                                                     m_data = nullptr;
     std::optional<Time::steady_tp>                            m_expires;
     bool                                                      m_wasCancelled = false;
+    uint64_t                                                  m_stamp        = 0;
 };
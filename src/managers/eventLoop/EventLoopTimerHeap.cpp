@@ -0,0 +1,75 @@
+#include "EventLoopTimerHeap.hpp"
+#include "EventLoopTimer.hpp"
+
+#include <algorithm>
+
+void CEventLoopTimerHeap::push(const SP<CEventLoopTimer>& timer) {
+    const auto EXPIRES = timer->expires();
+    if (!EXPIRES)
+        return;
+
+    // every reschedule leaves a stale entry, don't let them pile up
+    if (m_heap.size() >= m_compactAt)
+        compact();
+
+    m_heap.emplace_back(SEntry{.deadline = *EXPIRES, .stamp = timer->stamp(), .timer = timer});
+    std::ranges::push_heap(m_heap, later);
+}
+
+std::optional<Time::steady_tp> CEventLoopTimerHeap::next() {
+    while (!m_heap.empty() && stale(m_heap.front())) {
+        pop();
+    }
+
+    if (m_heap.empty())
+        return std::nullopt;
+
+    return m_heap.front().deadline;
+}
+
+std::vector<CEventLoopTimerHeap::SDueTimer> CEventLoopTimerHeap::popDue(Time::steady_tp until) {
+    std::vector<SDueTimer> due;
+
+    while (!m_heap.empty()) {
+        const auto& TOP = m_heap.front();
+
+        if (stale(TOP)) {
+            pop();
+            continue;
+        }
+
+        if (TOP.deadline > until)
+            break;
+
+        due.emplace_back(SDueTimer{.timer = TOP.timer.lock(), .stamp = TOP.stamp});
+        pop();
+    }
+
+    return due;
+}
+
+size_t CEventLoopTimerHeap::size() const {
+    return m_heap.size();
+}
+
+bool CEventLoopTimerHeap::stale(const SEntry& entry) const {
+    const auto TIMER = entry.timer.lock();
+    return !TIMER || TIMER->stamp() != entry.stamp;
+}
+
+void CEventLoopTimerHeap::pop() {
+    std::ranges::pop_heap(m_heap, later);
+    m_heap.pop_back();
+}
+
+void CEventLoopTimerHeap::compact() {
+    std::erase_if(m_heap, [this](const auto& e) { return stale(e); });
+    std::ranges::make_heap(m_heap, later);
+
+    m_compactAt = std::max(MIN_COMPACT_SIZE, m_heap.size() * 2);
+}
+
+bool CEventLoopTimerHeap::later(const SEntry& a, const SEntry& b) {
+    // std's heaps put the largest on top, so the later deadline has to compare as smaller
+    return a.deadline > b.deadline;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "../../helpers/memory/Memory.hpp"
+#include "../../helpers/time/Time.hpp"
+
+class CEventLoopTimer;
+
+// Armed timers by deadline, soonest first. Rescheduling a timer pushes a new entry and
+// leaves the old one behind; entries whose timer died or changed since are skipped once they reach the top.
+class CEventLoopTimerHeap {
+  public:
+    struct SDueTimer {
+        SP<CEventLoopTimer> timer;
+        uint64_t            stamp = 0; // the timer's stamp when it was pushed, it's stale if that changed since
+    };
+
+    // does nothing for disarmed timers
+    void                           push(const SP<CEventLoopTimer>& timer);
+
+    // the soonest deadline, if any
+    std::optional<Time::steady_tp> next();
+
+    // takes every timer due at or before until off the heap, soonest first
+    std::vector<SDueTimer>         popDue(Time::steady_tp until);
+
+    // entries, including stale ones
+    size_t                         size() const;
+
+  private:
+    struct SEntry {
+        Time::steady_tp     deadline;
+        uint64_t            stamp = 0;
+        WP<CEventLoopTimer> timer;
+    };
+
+    // below this many entries, stale ones aren't worth a sweep
+    static constexpr size_t MIN_COMPACT_SIZE = 1024;
+
+    static bool             later(const SEntry& a, const SEntry& b);
+    bool                    stale(const SEntry& entry) const;
+    void                    pop();
+    void                    compact();
+
+    std::vector<SEntry>     m_heap;
+    size_t                  m_compactAt = MIN_COMPACT_SIZE;
+};
@@ -84,22 +84,20 @@ bool CInputManager::isWindowInhibiting(const PHLWINDOW& w, bool onlyHl) {
             continue;
 
         bool isInhibiting = false;
-        w->wlSurface()->resource()->breadthfirst(
-            [&ii](SP<CWLSurfaceResource> surf, const Vector2D& pos, void* data) {
-                if (ii->inhibitor->m_surface != surf)
-                    return;
-
-                auto WLSurface = Desktop::View::CWLSurface::fromResource(surf);
-
-                if (!WLSurface || !WLSurface->view())
-                    return;
-
-                const auto VIEW          = WLSurface->view();
-                const auto ALPHAMODIFIER = dynamicPointerCast<Desktop::View::IAlphaModifiable>(VIEW);
-                if (VIEW->mapped() && VIEW->acceptsInput() && (!ALPHAMODIFIER || ALPHAMODIFIER->alphaNonZero()))
-                    *sc<bool*>(data) = true;
-            },
-            &isInhibiting);
+        w->wlSurface()->resource()->breadthfirst([&ii, &isInhibiting](const SP<CWLSurfaceResource>& surf, const Vector2D& pos) {
+            if (ii->inhibitor->m_surface != surf)
+                return;
+
+            auto WLSurface = Desktop::View::CWLSurface::fromResource(surf);
+
+            if (!WLSurface || !WLSurface->view())
+                return;
+
+            const auto VIEW          = WLSurface->view();
+            const auto ALPHAMODIFIER = dynamicPointerCast<Desktop::View::IAlphaModifiable>(VIEW);
+            if (VIEW->mapped() && VIEW->acceptsInput() && (!ALPHAMODIFIER || ALPHAMODIFIER->alphaNonZero()))
+                isInhibiting = true;
+        });
 
         if (isInhibiting)
             return true;
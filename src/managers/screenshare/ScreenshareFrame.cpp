@@ -1,6 +1,7 @@
 #include "ScreenshareManager.hpp"
 #include "../../pointer/PointerManager.hpp"
 #include "../input/InputManager.hpp"
+#include "../eventLoop/EventLoopManager.hpp"
 #include "../permissions/DynamicPermissionManager.hpp"
 #include "../../protocols/ColorManagement.hpp"
 #include "../../Compositor.hpp"
@@ -8,6 +9,7 @@
 #include "../../render/OpenGL.hpp"
 #include "../../output/Monitor.hpp"
 #include "../../state/MonitorState.hpp"
+#include "../../desktop/Workspace.hpp"
 #include "../../desktop/view/window/Window.hpp"
 #include "../../desktop/view/window/WindowPresentation.hpp"
 #include "../../desktop/state/FocusState.hpp"
@@ -69,7 +71,9 @@ bool CScreenshareFrame::done() const {
     return false;
 }
 
-eScreenshareError CScreenshareFrame::share(SP<IHLBuffer> buffer, const CRegion& clientDamage, FScreenshareCallback callback) {
+// bufferDamage is what the client needs refreshed in this buffer on top of what changed since the last frame.
+// Clients that don't track it get the whole buffer copied, damage() still only reports what changed.
+eScreenshareError CScreenshareFrame::share(SP<IHLBuffer> buffer, const std::optional<CRegion>& bufferDamage, FScreenshareCallback callback) {
     if UNLIKELY (done())
         return ERROR_STOPPED;
 
@@ -133,16 +137,14 @@ eScreenshareError CScreenshareFrame::share(SP<IHLBuffer> buffer, const CRegion&
         g_pHyprRenderer->damageMonitor(PMONITOR);
     }
 
-    // TODO: add a damage ring for output damage since last shared frame
-    CRegion frameDamage = CRegion(0, 0, m_bufferSize.x, m_bufferSize.y);
-
-    // copy everything on the first frame
-    if (m_isFirst)
-        m_damage = CRegion(0, 0, m_bufferSize.x, m_bufferSize.y);
-    else
-        m_damage = frameDamage.add(clientDamage);
+    // output damage since the last copied frame is collected by the session and added in copy()
+    if (m_isFirst) {
+        m_damage       = CRegion(0, 0, m_bufferSize.x, m_bufferSize.y);
+        m_bufferDamage = m_damage;
+    } else
+        m_bufferDamage = bufferDamage.value_or(CRegion(0, 0, m_bufferSize.x, m_bufferSize.y));
 
-    m_damage.intersect(0, 0, m_bufferSize.x, m_bufferSize.y);
+    m_bufferDamage.intersect(0, 0, m_bufferSize.x, m_bufferSize.y);
 
     return ERROR_NONE;
 }
@@ -151,6 +153,18 @@ void CScreenshareFrame::copy() {
     if (done() || m_copyInFlight)
         return;
 
+    // a window on a hidden workspace doesn't damage any monitor, so we can't know what changed
+    if (m_session->m_type == SHARE_WINDOW && (!m_session->m_window->m_workspace || !m_session->m_window->m_workspace->isVisible()))
+        m_session->m_damage = CRegion(0, 0, m_bufferSize.x, m_bufferSize.y);
+
+    m_damage.add(m_session->m_damage).intersect(0, 0, m_bufferSize.x, m_bufferSize.y);
+
+    if (m_damage.empty()) {
+        // nothing in the capture changed, hold the frame until something does. The client is still sharing though
+        m_session->m_shareStopTimer->updateTimeout(std::chrono::milliseconds(500));
+        return;
+    }
+
     // tell client to send presented timestamp
     // TODO: is this right? this is right after we commit to aq, not when page flip happens..
     m_callback(RESULT_TIMESTAMP);
@@ -165,17 +179,24 @@ void CScreenshareFrame::copy() {
         return;
     }
 
+    // anything damaged from here on belongs to the next frame
+    m_session->m_damage.clear();
+
+    const CRegion REGION = CRegion{m_damage}.add(m_bufferDamage);
+
     if (m_buffer->shm().success)
-        m_failed = !copyShm();
+        m_failed = !copyShm(REGION);
     else if (m_buffer->dmabuf().success)
-        m_failed = !copyDmabuf();
+        m_failed = !copyDmabuf(REGION);
 
     if (!m_failed) {
         // screensharing has started again
         m_session->screenshareEvents(true);
         m_session->m_shareStopTimer->updateTimeout(std::chrono::milliseconds(500)); // check in half second
-    } else
+    } else {
+        m_session->m_damage.add(m_damage);
         m_callback(RESULT_NOT_COPIED);
+    }
 }
 
 void CScreenshareFrame::renderMonitor() {
@@ -395,11 +416,11 @@ void CScreenshareFrame::render() {
     }
 }
 
-bool CScreenshareFrame::copyDmabuf() {
+bool CScreenshareFrame::copyDmabuf(CRegion region) {
     if (done())
         return false;
 
-    if (!g_pHyprRenderer->beginRender(m_session->monitor(), m_damage, Render::RENDER_MODE_TO_BUFFER, m_buffer, nullptr, true)) {
+    if (!g_pHyprRenderer->beginRender(m_session->monitor(), region, Render::RENDER_MODE_TO_BUFFER, m_buffer, nullptr, true)) {
         LOGM(Log::ERR, "Can't copy: failed to begin rendering to dma frame");
         return false;
     }
@@ -428,7 +449,7 @@ bool CScreenshareFrame::copyDmabuf() {
     return true;
 }
 
-bool CScreenshareFrame::copyShm() {
+bool CScreenshareFrame::copyShm(CRegion region) {
     if (done())
         return false;
 
@@ -442,12 +463,11 @@ bool CScreenshareFrame::copyShm() {
 
     const auto PMONITOR = m_session->monitor();
 
-    auto       outFB = g_pHyprRenderer->createFB();
-    outFB->alloc(m_bufferSize.x, m_bufferSize.y, shm.format);
-    outFB->setImageDescription(NColorManagement::DEFAULT_SRGB_IMAGE_DESCRIPTION);
+    auto       outFB = m_session->acquireFB(m_bufferSize, shm.format);
 
-    if (!g_pHyprRenderer->beginFullFakeRender(PMONITOR, m_damage, outFB)) {
+    if (!g_pHyprRenderer->beginFullFakeRender(PMONITOR, region, outFB)) {
         LOGM(Log::ERR, "Can't copy: failed to begin rendering");
+        m_session->releaseFB(outFB);
         return false;
     }
 
@@ -457,18 +477,44 @@ bool CScreenshareFrame::copyShm() {
 
     g_pHyprRenderer->endRender();
 
+    // queue the readback and finish it once the gpu signals, instead of stalling here until it's done rendering
+    const bool                 QUEUED = g_pHyprRenderer->explicitSyncSupported() && outFB->queueReadback(region, shm.format);
+    UP<Render::ISyncFDManager> sync;
+    if (QUEUED)
+        sync = g_pHyprRenderer->createSyncFDManager();
+
+    g_pHyprRenderer->m_renderData.pMonitor.reset();
+
+    if (sync && sync->isValid()) {
+        m_copyInFlight = true;
+
+        g_pEventLoopManager->doOnReadable(sync->fd().duplicate(), [self = m_self, session = m_session, outFB]() {
+            if (self && !self.expired())
+                self->finishShmCopy(outFB);
+
+            if (session && !session.expired())
+                session->releaseFB(outFB);
+        });
+
+        return true;
+    }
+
     bool readSucceeded = true;
-    m_damage.forEachRect([&](const auto& rect) {
-        if (!readSucceeded)
-            return;
+    if (QUEUED) // no fence to wait on, mapping the staging buffer stalls like readPixels would
+        readSucceeded = outFB->finishReadback(m_buffer);
+    else {
+        region.forEachRect([&](const auto& rect) {
+            if (!readSucceeded)
+                return;
 
-        int width  = rect.x2 - rect.x1;
-        int height = rect.y2 - rect.y1;
-        if (!outFB->readPixels(m_buffer, rect.x1, rect.y1, width, height))
-            readSucceeded = false;
-    });
+            int width  = rect.x2 - rect.x1;
+            int height = rect.y2 - rect.y1;
+            if (!outFB->readPixels(m_buffer, rect.x1, rect.y1, width, height))
+                readSucceeded = false;
+        });
+    }
 
-    g_pHyprRenderer->m_renderData.pMonitor.reset();
+    m_session->releaseFB(outFB);
 
     if (!readSucceeded) {
         LOGM(Log::ERR, "Can't copy: failed to read pixels to shm");
@@ -484,6 +530,25 @@ bool CScreenshareFrame::copyShm() {
     return true;
 }
 
+void CScreenshareFrame::finishShmCopy(const SP<Render::IFramebuffer>& fb) {
+    m_copyInFlight = false;
+
+    if (m_copied || done())
+        return;
+
+    if (!fb->finishReadback(m_buffer)) {
+        LOGM(Log::ERR, "Can't copy: failed to read back pixels to shm");
+        m_session->m_damage.add(m_damage);
+        m_failed = true;
+        m_callback(RESULT_NOT_COPIED);
+        return;
+    }
+
+    LOGM(Log::TRACE, "Copied frame via shm readback");
+    m_callback(RESULT_COPIED);
+    m_copied = true;
+}
+
 void CScreenshareFrame::storeTempFB() {
     if (!m_session->m_tempFB)
         m_session->m_tempFB = g_pHyprRenderer->createFB();
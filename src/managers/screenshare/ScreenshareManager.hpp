@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <vector>
 #include "../../helpers/memory/Memory.hpp"
 #include "../../protocols/types/Buffer.hpp"
@@ -7,8 +8,6 @@
 #include "../eventLoop/EventLoopTimer.hpp"
 #include "../../render/Renderer.hpp"
 
-// TODO: do screenshare damage
-
 class CWLPointerResource;
 
 namespace Screenshare {
@@ -62,6 +61,11 @@ namespace Screenshare {
         CScreenshareSession(PHLMONITOR monitor, CBox captureRegion, wl_client* client);
         CScreenshareSession(PHLWINDOW window, wl_client* client);
 
+        struct SPooledFB {
+            SP<Render::IFramebuffer> fb;
+            bool                     busy = false; // rendered into by a frame whose copy hasn't finished yet
+        };
+
         WP<CScreenshareSession>  m_self;
         bool                     m_stopped = false;
 
@@ -77,6 +81,9 @@ namespace Screenshare {
         Vector2D                 m_bufferSize = Vector2D(0, 0);
 
         SP<Render::IFramebuffer> m_tempFB;
+        std::vector<SPooledFB>   m_fbPool; // shm copies, one fb per frame in flight
+
+        CRegion                  m_damage; // buffer coords, what changed in the capture since the last copied frame
 
         SP<CEventLoopTimer>      m_shareStopTimer;
         bool                     m_sharing = false;
@@ -84,14 +91,19 @@ namespace Screenshare {
         struct {
             CHyprSignalListener monitorDestroyed;
             CHyprSignalListener monitorModeChanged;
+            CHyprSignalListener monitorDamaged;
             CHyprSignalListener windowDestroyed;
             CHyprSignalListener windowSizeChanged;
             CHyprSignalListener windowMonitorChanged;
         } m_listeners;
 
-        void screenshareEvents(bool started);
-        void calculateConstraints();
-        void init();
+        void                     screenshareEvents(bool started);
+        void                     calculateConstraints();
+        void                     init();
+        void                     listenToMonitor();
+        void                     onMonitorDamage(const CRegion& damage);
+        SP<Render::IFramebuffer> acquireFB(const Vector2D& size, DRMFormat format);
+        void                     releaseFB(const SP<Render::IFramebuffer>& fb);
 
         friend class CScreenshareFrame;
         friend class CScreenshareManager;
@@ -160,7 +172,7 @@ namespace Screenshare {
         ~CScreenshareFrame();
 
         bool                done() const;
-        eScreenshareError   share(SP<IHLBuffer> buffer, const CRegion& damage, FScreenshareCallback callback);
+        eScreenshareError   share(SP<IHLBuffer> buffer, const std::optional<CRegion>& bufferDamage, FScreenshareCallback callback);
 
         Vector2D            bufferSize() const;
         wl_output_transform transform() const; // returns the transform applied by compositor on the buffer
@@ -172,16 +184,18 @@ namespace Screenshare {
         FScreenshareCallback    m_callback;
         SP<IHLBuffer>           m_buffer;
         Vector2D                m_bufferSize = Vector2D(0, 0);
-        CRegion                 m_damage; // damage in buffer coords
+        CRegion                 m_damage;       // damage in buffer coords, what changed since the last copied frame
+        CRegion                 m_bufferDamage; // what has to be copied regardless
         bool                    m_shared = false, m_copied = false, m_failed = false;
-        bool                    m_copyInFlight  = false; // a dmabuf copy is issued and waiting on its fence
+        bool                    m_copyInFlight  = false; // a dmabuf copy or shm readback is issued and waiting on its fence
         bool                    m_overlayCursor = true;
         bool                    m_isFirst       = false;
 
         //
         void copy();
-        bool copyDmabuf();
-        bool copyShm();
+        bool copyDmabuf(CRegion region);
+        bool copyShm(CRegion region);
+        void finishShmCopy(const SP<Render::IFramebuffer>& fb);
 
         void render();
         void renderMonitor();
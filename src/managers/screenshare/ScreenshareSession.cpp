@@ -25,12 +25,7 @@ CScreenshareSession::CScreenshareSession(PHLWINDOW window, wl_client* client) :
         m_events.constraintsChanged.emit();
     });
     m_listeners.windowMonitorChanged = m_window->m_events.monitorChanged.listen([this]() {
-        m_listeners.monitorDestroyed   = monitor()->m_events.disconnect.listen([this]() { stop(); });
-        m_listeners.monitorModeChanged = monitor()->m_events.modeChanged.listen([this]() {
-            calculateConstraints();
-            m_events.constraintsChanged.emit();
-        });
-
+        listenToMonitor();
         calculateConstraints();
         m_events.constraintsChanged.emit();
     });
@@ -84,13 +79,44 @@ void CScreenshareSession::init() {
     // dims so m_bufferSize matches the int32 size we send to the client
     m_captureBox.scale(monitor()->m_scale).round();
 
+    listenToMonitor();
+    calculateConstraints();
+}
+
+void CScreenshareSession::listenToMonitor() {
     m_listeners.monitorDestroyed   = monitor()->m_events.disconnect.listen([this]() { stop(); });
     m_listeners.monitorModeChanged = monitor()->m_events.modeChanged.listen([this]() {
         calculateConstraints();
         m_events.constraintsChanged.emit();
     });
+    m_listeners.monitorDamaged     = monitor()->m_events.damaged.listen([this](const CRegion& damage) { onMonitorDamage(damage); });
+}
 
-    calculateConstraints();
+// monitor damage is in monitor local pixels, oriented like the layout. That's the space our buffers are in as well
+// (see renderMonitor / renderWindow), so only the capture's origin has to be taken out.
+void CScreenshareSession::onMonitorDamage(const CRegion& damage) {
+    const auto PMONITOR = monitor();
+    if (!PMONITOR || m_stopped)
+        return;
+
+    CRegion bufferDamage = damage;
+
+    switch (m_type) {
+        case SHARE_MONITOR: break;
+        case SHARE_REGION: bufferDamage.translate(-m_captureBox.pos()); break;
+        case SHARE_WINDOW: {
+            if (!m_window)
+                return;
+
+            bufferDamage.translate(-((m_window->position(Desktop::View::IGeometric::GEOMETRIC_CURRENT) - PMONITOR->m_position) * PMONITOR->m_scale));
+            break;
+        }
+        case SHARE_NONE:
+        default: return;
+    }
+
+    bufferDamage.intersect(0, 0, m_bufferSize.x, m_bufferSize.y);
+    m_damage.add(bufferDamage);
 }
 
 void CScreenshareSession::calculateConstraints() {
@@ -131,6 +157,9 @@ void CScreenshareSession::calculateConstraints() {
             return;
     }
 
+    // buffers get reallocated, nothing in them can be kept
+    m_damage = CRegion(0, 0, m_bufferSize.x, m_bufferSize.y);
+
     LOGM(Log::TRACE, "constraints changed for {}", m_name);
 }
 
@@ -167,6 +196,35 @@ PHLMONITOR CScreenshareSession::monitor() const {
     return mon.expired() ? nullptr : mon.lock();
 }
 
+SP<Render::IFramebuffer> CScreenshareSession::acquireFB(const Vector2D& size, DRMFormat format) {
+    const auto matches = [&](const SPooledFB& e) { return e.fb->m_size == size && e.fb->m_drmFormat == format; };
+
+    // leftovers from before a resize or format change, busy ones go once their copy is done
+    std::erase_if(m_fbPool, [&](const SPooledFB& e) { return !e.busy && !matches(e); });
+
+    for (auto& e : m_fbPool) {
+        if (e.busy || !matches(e))
+            continue;
+
+        e.busy = true;
+        return e.fb;
+    }
+
+    auto fb = g_pHyprRenderer->createFB(std::format("screenshare {}", m_name));
+    fb->alloc(size.x, size.y, format);
+    fb->setImageDescription(NColorManagement::DEFAULT_SRGB_IMAGE_DESCRIPTION);
+
+    m_fbPool.emplace_back(SPooledFB{.fb = fb, .busy = true});
+    return fb;
+}
+
+void CScreenshareSession::releaseFB(const SP<Render::IFramebuffer>& fb) {
+    for (auto& e : m_fbPool) {
+        if (e.fb == fb)
+            e.busy = false;
+    }
+}
+
 UP<CScreenshareFrame> CScreenshareSession::nextFrame(bool overlayCursor) {
     UP<CScreenshareFrame> frame = makeUnique<CScreenshareFrame>(m_self, overlayCursor, !m_sharing);
     frame->m_self               = frame;
@@ -100,7 +100,8 @@ void CNotificationOverlay::ensureNotificationCache(CNotification& notif, PHLMONI
     notif.m_cache.fontSizePx  = fontSizePx;
     notif.m_cache.iconBackend = iconBackend;
 
-    notif.m_cache.textTex = g_pHyprRenderer->renderText(notif.text(), CHyprColor{1.F, 1.F, 1.F, 1.F}, fontSizePx, false, fontFamily);
+    // needed right away for the layout, so no point going async. Notifications repeat a lot though, which the shared cache catches.
+    notif.m_cache.textTex = g_pHyprRenderer->m_textTextures.getNow({.text = notif.text(), .font = fontFamily, .size = fontSizePx, .color = CHyprColor{1.F, 1.F, 1.F, 1.F}});
     if (notif.m_cache.textTex)
         notif.m_cache.textSize = notif.m_cache.textTex->m_size;
 
@@ -108,7 +109,7 @@ void CNotificationOverlay::ensureNotificationCache(CNotification& notif, PHLMONI
         const auto iconGlyph  = ICONS_ARRAY[iconBackend][notif.icon()];
         const auto iconSizePx = std::max(8, sc<int>(std::round(fontSizePx * ICON_SCALE)));
 
-        notif.m_cache.iconTex = g_pHyprRenderer->renderText(iconGlyph, CHyprColor{1.F, 1.F, 1.F, 1.F}, iconSizePx, false, fontFamily);
+        notif.m_cache.iconTex = g_pHyprRenderer->m_textTextures.getNow({.text = iconGlyph, .font = fontFamily, .size = iconSizePx, .color = CHyprColor{1.F, 1.F, 1.F, 1.F}});
         if (notif.m_cache.iconTex)
             notif.m_cache.iconSize = notif.m_cache.iconTex->m_size;
     }
@@ -0,0 +1,143 @@
+#include "FrameTimings.hpp"
+#include "../helpers/memory/Memory.hpp"
+
+#include <algorithm>
+
+using namespace Monitor;
+
+bool SFrameTiming::has(eFrameStage stage) const {
+    return stages[stage] != Time::steady_tp{};
+}
+
+float SFrameTiming::msBetween(eFrameStage from, eFrameStage to) const {
+    return std::chrono::duration_cast<std::chrono::microseconds>(stages[to] - stages[from]).count() / 1000.F;
+}
+
+void CFrameTimings::mark(eFrameStage stage, const Time::steady_tp& when) {
+    switch (stage) {
+        case FRAME_STAGE_SCHEDULED:
+            // the pending frame can't pick up anything scheduled once it began rendering, that's for the next one
+            if (m_pending.has(FRAME_STAGE_RENDER_BEGIN)) {
+                if (m_nextScheduled == Time::steady_tp{})
+                    m_nextScheduled = when;
+                return;
+            }
+
+            // the first schedule is the one the frame is late to, later ones are merged into it
+            if (m_pending.has(FRAME_STAGE_SCHEDULED))
+                return;
+            break;
+        case FRAME_STAGE_SYNC_FIRED:
+            // syncs fire in the order the frames were rendered in
+            for (size_t i = 0; i < m_inFlightCount; ++i) {
+                if (!m_inFlight[i].has(FRAME_STAGE_SYNC_FIRED)) {
+                    m_inFlight[i].stages[stage] = when;
+                    return;
+                }
+            }
+            return;
+        default: break;
+    }
+
+    m_pending.stages[stage] = when;
+
+    if (stage != FRAME_STAGE_RENDER_END)
+        return;
+
+    // nothing is presenting what's queued, don't let it grow
+    if (m_inFlightCount == FRAME_MAX_IN_FLIGHT) {
+        std::shift_left(m_inFlight.begin(), m_inFlight.end(), 1);
+        m_inFlightCount--;
+    }
+
+    m_inFlight[m_inFlightCount++] = m_pending;
+    startNext();
+}
+
+void CFrameTimings::onPresented(const Time::steady_tp& when) {
+    // a frame that never said it finished rendering is the one that got presented
+    if (m_inFlightCount == 0) {
+        m_pending.stages[FRAME_STAGE_PRESENTED] = when;
+        commit(m_pending);
+        startNext();
+        return;
+    }
+
+    m_inFlight[0].stages[FRAME_STAGE_PRESENTED] = when;
+    commit(m_inFlight[0]);
+
+    std::shift_left(m_inFlight.begin(), m_inFlight.end(), 1);
+    m_inFlightCount--;
+}
+
+void CFrameTimings::onDropped() {
+    startNext();
+}
+
+void CFrameTimings::startNext() {
+    m_pending                               = {};
+    m_pending.stages[FRAME_STAGE_SCHEDULED] = m_nextScheduled;
+    m_nextScheduled                         = {};
+}
+
+void CFrameTimings::commit(const SFrameTiming& frame) {
+    m_frames[m_head] = frame;
+    m_head           = (m_head + 1) % FRAME_TIMINGS_HISTORY;
+    m_count          = std::min(m_count + 1, FRAME_TIMINGS_HISTORY);
+}
+
+size_t CFrameTimings::size() const {
+    return m_count;
+}
+
+static SFramePercentiles percentiles(std::array<float, FRAME_TIMINGS_HISTORY>& values, size_t count) {
+    if (count == 0)
+        return {};
+
+    const auto at = [&values, count](float p) {
+        const auto IT = values.begin() + std::min(sc<size_t>(p * count), count - 1);
+        std::ranges::nth_element(values.begin(), IT, values.begin() + count);
+        return *IT;
+    };
+
+    return {.p50 = at(0.5F), .p95 = at(0.95F), .p99 = at(0.99F)};
+}
+
+SFrameTimingStats CFrameTimings::stats(float refreshRate) const {
+    SFrameTimingStats                        result;
+    std::array<float, FRAME_TIMINGS_HISTORY> render, gpu, presentLatency, frameLatency;
+    size_t                                   renderN = 0, gpuN = 0, presentLatencyN = 0, frameLatencyN = 0;
+
+    const float                              DEADLINE_MS = refreshRate > 0.F ? 1500.F / refreshRate : 0.F;
+
+    for (size_t i = 0; i < m_count; ++i) {
+        const auto& f = m_frames[i];
+
+        result.frames++;
+
+        if (f.has(FRAME_STAGE_RENDER_BEGIN) && f.has(FRAME_STAGE_RENDER_END))
+            render[renderN++] = f.msBetween(FRAME_STAGE_RENDER_BEGIN, FRAME_STAGE_RENDER_END);
+
+        if (f.has(FRAME_STAGE_RENDER_END) && f.has(FRAME_STAGE_SYNC_FIRED))
+            gpu[gpuN++] = f.msBetween(FRAME_STAGE_RENDER_END, FRAME_STAGE_SYNC_FIRED);
+
+        if (f.has(FRAME_STAGE_SCHEDULED))
+            frameLatency[frameLatencyN++] = f.msBetween(FRAME_STAGE_SCHEDULED, FRAME_STAGE_PRESENTED);
+
+        if (!f.has(FRAME_STAGE_RENDER_BEGIN))
+            continue;
+
+        const auto LATENCY                = f.msBetween(FRAME_STAGE_RENDER_BEGIN, FRAME_STAGE_PRESENTED);
+        presentLatency[presentLatencyN++] = LATENCY;
+
+        if (DEADLINE_MS > 0.F && LATENCY > DEADLINE_MS)
+            result.missed++;
+    }
+
+    result.render         = percentiles(render, renderN);
+    result.gpu            = percentiles(gpu, gpuN);
+    result.presentLatency = percentiles(presentLatency, presentLatencyN);
+    result.frameLatency   = percentiles(frameLatency, frameLatencyN);
+
+    return result;
+}
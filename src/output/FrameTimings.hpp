@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../helpers/time/Time.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Monitor {
+    enum eFrameStage : uint8_t {
+        FRAME_STAGE_SCHEDULED = 0,
+        FRAME_STAGE_RENDER_BEGIN,
+        FRAME_STAGE_RENDER_END,
+        FRAME_STAGE_SYNC_FIRED,
+        FRAME_STAGE_PRESENTED,
+    };
+
+    constexpr static size_t FRAME_STAGE_COUNT     = FRAME_STAGE_PRESENTED + 1;
+    constexpr static size_t FRAME_TIMINGS_HISTORY = 512;
+    constexpr static size_t FRAME_MAX_IN_FLIGHT   = 3; // the one on screen, one queued and a pending third one
+
+    struct SFrameTiming {
+        // default-constructed (epoch) stages were not hit for this frame
+        std::array<Time::steady_tp, FRAME_STAGE_COUNT> stages;
+
+        bool                                           has(eFrameStage stage) const;
+        float                                          msBetween(eFrameStage from, eFrameStage to) const;
+    };
+
+    struct SFramePercentiles {
+        float p50 = 0.F, p95 = 0.F, p99 = 0.F;
+    };
+
+    struct SFrameTimingStats {
+        size_t            frames = 0;
+        size_t            missed = 0;
+        SFramePercentiles render;         // render begin -> render end
+        SFramePercentiles gpu;            // render end -> sync fired, only with new render scheduling
+        SFramePercentiles presentLatency; // render begin -> presented
+        SFramePercentiles frameLatency;   // first schedule -> presented
+    };
+
+    // Fixed-size history of the last frames of a monitor. Stages are marked as they happen on the
+    // frame being rendered. Once it's rendered it waits for its presentation, which is when it's
+    // committed to the ring. A new frame can be rendered before the last one got presented, so
+    // rendered frames queue up and each presentation finishes the oldest one. Never allocates.
+    class CFrameTimings {
+      public:
+        void              mark(eFrameStage stage, const Time::steady_tp& when = Time::steadyNow());
+        void              onPresented(const Time::steady_tp& when = Time::steadyNow());
+        // the frame being rendered was skipped or failed to commit, it won't be presented
+        void              onDropped();
+
+        // a frame misses its deadline if it got presented more than 1.5 refresh intervals after it began rendering
+        SFrameTimingStats stats(float refreshRate) const;
+        size_t            size() const;
+
+      private:
+        void                                            startNext();
+        void                                            commit(const SFrameTiming& frame);
+
+        std::array<SFrameTiming, FRAME_TIMINGS_HISTORY> m_frames;
+        size_t                                          m_head  = 0;
+        size_t                                          m_count = 0;
+        SFrameTiming                                    m_pending;       // being rendered
+        Time::steady_tp                                 m_nextScheduled; // scheduled after the pending frame began rendering
+
+        std::array<SFrameTiming, FRAME_MAX_IN_FLIGHT>   m_inFlight; // rendered, waiting to be presented. Oldest first
+        size_t                                          m_inFlightCount = 0;
+    };
+}
@@ -1142,14 +1142,27 @@ void CMonitor::scheduleFrame(Aquamarine::IOutput::scheduleFrameReason reason) {
     if (m_renderingActive)
         m_pendingFrame = true;
 
+    if (m_frameScheduler)
+        m_frameScheduler->onScheduled();
+
     m_output->scheduleFrame(reason);
 }
 
 void CMonitor::addDamage(const pixman_region32_t* rg) {
+    if (m_damageBatchDepth > 0) {
+        m_batchedDamage.add(CRegion{const_cast<pixman_region32_t*>(rg)});
+        return;
+    }
+
     if (m_cursorZoom->value() != 1.f && State::monitorState()->query().vec(Pointer::mgr()->position()).run() == m_self) {
-        m_damage.damageEntire();
+        damageEntire();
         scheduleFrame(Aquamarine::IOutput::AQ_SCHEDULE_DAMAGE);
-    } else if (m_damage.damage(rg))
+        return;
+    }
+
+    m_events.damaged.emit(CRegion{const_cast<pixman_region32_t*>(rg)});
+
+    if (m_damage.damage(rg))
         scheduleFrame(Aquamarine::IOutput::AQ_SCHEDULE_DAMAGE);
 }
 
@@ -1158,16 +1171,41 @@ void CMonitor::addDamage(const CRegion& rg) {
 }
 
 void CMonitor::addDamage(const CBox& box) {
+    if (m_damageBatchDepth > 0) {
+        m_batchedDamage.add(box);
+        return;
+    }
+
     if (m_cursorZoom->value() != 1.f && State::monitorState()->query().vec(Pointer::mgr()->position()).run() == m_self) {
-        m_damage.damageEntire();
+        damageEntire();
         scheduleFrame(Aquamarine::IOutput::AQ_SCHEDULE_DAMAGE);
         return;
     }
 
+    m_events.damaged.emit(CRegion{box});
+
     if (m_damage.damage(box))
         scheduleFrame(Aquamarine::IOutput::AQ_SCHEDULE_DAMAGE);
 }
 
+void CMonitor::damageEntire() {
+    m_damage.damageEntire();
+    m_events.damaged.emit(CRegion{0, 0, m_transformedSize.x, m_transformedSize.y});
+}
+
+void CMonitor::beginDamageBatch() {
+    ++m_damageBatchDepth;
+}
+
+void CMonitor::endDamageBatch() {
+    if (m_damageBatchDepth <= 0 || --m_damageBatchDepth > 0 || m_batchedDamage.empty())
+        return;
+
+    const CRegion DAMAGE = m_batchedDamage;
+    m_batchedDamage.clear();
+    addDamage(DAMAGE);
+}
+
 bool CMonitor::shouldSkipScheduleFrameOnMouseEvent() {
     static auto PNOBREAK = CConfigValue<Config::INTEGER>("cursor:no_break_fs_vrr");
     static auto PMINRR   = CConfigValue<Config::INTEGER>("cursor:min_refresh_rate");
@@ -1181,7 +1219,7 @@ bool CMonitor::shouldSkipScheduleFrameOnMouseEvent() {
     // keep requested minimum refresh rate
     if (shouldSkip && *PMINRR && m_lastPresentationTimer.getMillis() > 1000.0f / *PMINRR) {
         // damage whole screen because some previous cursor box damages were skipped
-        m_damage.damageEntire();
+        damageEntire();
         return false;
     }
 
@@ -2284,7 +2322,7 @@ void CMonitor::handleDSleave() {
 
     m_drmFormat   = m_prevDrmFormat;
     m_blurFBDirty = true;
-    m_damage.damageEntire();
+    damageEntire();
 }
 
 bool CMonitor::canAttemptDirectScanoutFast() const {
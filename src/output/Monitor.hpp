@@ -190,6 +190,7 @@ namespace Monitor {
             CSignalT<>                dpmsChanged;
             CSignalT<>                modeChanged;
             CSignalT<Time::steady_tp> presented;
+            CSignalT<const CRegion&>  damaged; // monitor local pixels, after batching
         } m_events;
 
         std::array<std::vector<PHLLSREF>, 4> m_layerSurfaceLayers;
@@ -264,6 +265,10 @@ namespace Monitor {
         void         addDamage(const pixman_region32_t* rg);
         void         addDamage(const CRegion& rg);
         void         addDamage(const CBox& box);
+        void         damageEntire(); // doesn't schedule a frame
+        // while a batch is open, damage is collected and handed to the damage ring as one region when the outermost batch ends
+        void         beginDamageBatch();
+        void         endDamageBatch();
         void         scheduleFrame(Aquamarine::IOutput::scheduleFrameReason reason = Aquamarine::IOutput::AQ_SCHEDULE_CLIENT_UNKNOWN);
         bool         shouldSkipScheduleFrameOnMouseEvent();
         void         setMirror(const std::string&);
@@ -405,6 +410,9 @@ namespace Monitor {
         int                     m_modeRetryCount = 0;
         SP<CEventLoopTimer>     m_modeRetryTimer;
 
+        int                     m_damageBatchDepth = 0;
+        CRegion                 m_batchedDamage;
+
         std::stack<WORKSPACEID> m_prevWorkSpaces;
 
         // Resources
@@ -3,6 +3,7 @@
 #include "../Compositor.hpp"
 #include "../render/Renderer.hpp"
 #include "../managers/eventLoop/EventLoopManager.hpp"
+#include "../ipc/s2/S2.hpp"
 
 using namespace Render::GL;
 using namespace Monitor;
@@ -11,6 +12,40 @@ CMonitorFrameScheduler::CMonitorFrameScheduler(PHLMONITOR m) : m_monitor(m) {
     ;
 }
 
+CMonitorFrameScheduler::~CMonitorFrameScheduler() {
+    if (m_timingsEventTimer && g_pEventLoopManager)
+        g_pEventLoopManager->removeTimer(m_timingsEventTimer);
+}
+
+const CFrameTimings& CMonitorFrameScheduler::timings() const {
+    return m_timings;
+}
+
+void CMonitorFrameScheduler::onScheduled() {
+    m_timings.mark(FRAME_STAGE_SCHEDULED);
+}
+
+bool CMonitorFrameScheduler::renderTimed(PHLMONITOR mon, bool commit) {
+    m_timings.mark(FRAME_STAGE_RENDER_BEGIN);
+
+    // get a ref to ourselves. renderMonitor can destroy this scheduler if it decides to perform a monitor reload
+    // FIXME: this is horrible. "renderMonitor" should not be able to do that.
+    auto self = m_self;
+
+    const bool RENDERED = g_pHyprRenderer->renderMonitor(mon, commit);
+
+    if (!self)
+        return false;
+
+    if (!RENDERED) {
+        m_timings.onDropped();
+        return true;
+    }
+
+    m_timings.mark(FRAME_STAGE_RENDER_END);
+    return true;
+}
+
 bool CMonitorFrameScheduler::newSchedulingEnabled() {
     static auto PENABLENEW = CConfigValue<Config::INTEGER>("render:new_render_scheduling");
 
@@ -22,6 +57,8 @@ void CMonitorFrameScheduler::onSyncFired() {
     if (!PMONITOR || !newSchedulingEnabled())
         return;
 
+    m_timings.mark(FRAME_STAGE_SYNC_FIRED);
+
     // Sync fired: reset submitted state, set as rendered. Check the last render time. If we are running
     // late, we will instantly render here.
 
@@ -40,13 +77,7 @@ void CMonitorFrameScheduler::onSyncFired() {
 
     m_lastRenderBegun = hrc::now();
 
-    // get a ref to ourselves. renderMonitor can destroy this scheduler if it decides to perform a monitor reload
-    // FIXME: this is horrible. "renderMonitor" should not be able to do that.
-    auto self = m_self;
-
-    g_pHyprRenderer->renderMonitor(PMONITOR, false);
-
-    if (!self)
+    if (!renderTimed(PMONITOR, false))
         return;
 
     onFinishRender();
@@ -54,7 +85,13 @@ void CMonitorFrameScheduler::onSyncFired() {
 
 void CMonitorFrameScheduler::onPresented() {
     const auto PMONITOR = m_monitor.lock();
-    if (!PMONITOR || !newSchedulingEnabled())
+    if (!PMONITOR)
+        return;
+
+    m_timings.onPresented();
+    updateTimingsEvent();
+
+    if (!newSchedulingEnabled())
         return;
 
     if (!m_pendingThird)
@@ -102,7 +139,7 @@ void CMonitorFrameScheduler::onFrame() {
     if (!newSchedulingEnabled()) {
         PMONITOR->m_lastPresentationTimer.reset();
 
-        g_pHyprRenderer->renderMonitor(PMONITOR);
+        renderTimed(PMONITOR);
         return;
     }
 
@@ -115,13 +152,7 @@ void CMonitorFrameScheduler::onFrame() {
 
     m_lastRenderBegun = hrc::now();
 
-    // get a ref to ourselves. renderMonitor can destroy this scheduler if it decides to perform a monitor reload
-    // FIXME: this is horrible. "renderMonitor" should not be able to do that.
-    auto self = m_self;
-
-    g_pHyprRenderer->renderMonitor(PMONITOR);
-
-    if (!self)
+    if (!renderTimed(PMONITOR))
         return;
 
     onFinishRender();
@@ -154,3 +185,29 @@ bool CMonitorFrameScheduler::canRender() {
 
     return true;
 }
+
+void CMonitorFrameScheduler::updateTimingsEvent() {
+    static auto PINTERVAL = CConfigValue<Config::INTEGER>("debug:frametimes_event_interval");
+
+    if (*PINTERVAL <= 0 || (m_timingsEventTimer && m_timingsEventTimer->armed()))
+        return;
+
+    // only armed by presentation, so an idle monitor doesn't keep waking us up
+    if (!m_timingsEventTimer) {
+        m_timingsEventTimer = makeShared<CEventLoopTimer>(std::nullopt, [this](SP<CEventLoopTimer> self, void* data) { postTimingsEvent(); }, nullptr);
+        g_pEventLoopManager->addTimer(m_timingsEventTimer);
+    }
+
+    m_timingsEventTimer->updateTimeout(std::chrono::milliseconds(*PINTERVAL));
+}
+
+void CMonitorFrameScheduler::postTimingsEvent() {
+    const auto PMONITOR = m_monitor.lock();
+    if (!PMONITOR)
+        return;
+
+    const auto STATS = m_timings.stats(PMONITOR->m_refreshRate);
+
+    IPC::Socket2::sock()->postEvent({"frametimes",
+                                     std::format("{},{:.2f},{:.2f},{:.2f},{},{}", PMONITOR->m_name, STATS.render.p50, STATS.render.p95, STATS.render.p99, STATS.missed, STATS.frames)});
+}
@@ -1,16 +1,20 @@
 #pragma once
 
 #include "Monitor.hpp"
+#include "FrameTimings.hpp"
 #include "../render/SyncFDManager.hpp"
 
 #include <chrono>
 
+class CEventLoopTimer;
+
 namespace Monitor {
     class CMonitorFrameScheduler {
       public:
         using hrc = std::chrono::high_resolution_clock;
 
         CMonitorFrameScheduler(PHLMONITOR m);
+        ~CMonitorFrameScheduler();
 
         CMonitorFrameScheduler(const CMonitorFrameScheduler&)            = delete;
         CMonitorFrameScheduler(CMonitorFrameScheduler&&)                 = delete;
@@ -20,11 +24,17 @@ namespace Monitor {
         void                    onSyncFired();
         void                    onPresented();
         void                    onFrame();
+        void                    onScheduled();
+
+        const CFrameTimings&    timings() const;
 
       private:
         bool                       canRender();
         void                       onFinishRender();
         bool                       newSchedulingEnabled();
+        bool                       renderTimed(PHLMONITOR mon, bool commit = true);
+        void                       updateTimingsEvent();
+        void                       postTimingsEvent();
 
         bool                       m_renderAtFrame = true;
         bool                       m_pendingThird  = false;
@@ -34,6 +44,9 @@ namespace Monitor {
 
         UP<Render::ISyncFDManager> m_sync;
 
+        CFrameTimings              m_timings;
+        SP<CEventLoopTimer>        m_timingsEventTimer;
+
         WP<CMonitorFrameScheduler> m_self;
 
         friend class CMonitor;
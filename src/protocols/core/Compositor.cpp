@@ -2,6 +2,7 @@
 #include "../../Compositor.hpp"
 #include "Output.hpp"
 #include "Seat.hpp"
+#include "Shm.hpp"
 #include "../types/WLBuffer.hpp"
 #include <algorithm>
 #include <array>
@@ -418,6 +419,7 @@ void CWLSurfaceResource::frame(const Time::steady_tp& now) {
 
 void CWLSurfaceResource::resetRole() {
     m_role = makeShared<CDefaultSurfaceRole>();
+    invalidateTrees();
 }
 
 void CWLSurfaceResource::bfHelper(std::span<const SP<CWLSurfaceResource>> nodes, std::function<void(SP<CWLSurfaceResource>, const Vector2D&, void*)> fn, void* data) {
@@ -490,8 +492,22 @@ void CWLSurfaceResource::bfHelper(std::span<const SP<CWLSurfaceResource>> nodes,
 }
 
 void CWLSurfaceResource::breadthfirst(std::function<void(SP<CWLSurfaceResource>, const Vector2D&, void*)> fn, void* data) {
+    breadthfirst([&fn, data](const SP<CWLSurfaceResource>& surf, const Vector2D& offset) { fn(surf, offset, data); });
+}
+
+void CWLSurfaceResource::rebuildTreeCache() {
+    m_treeCache.nodes.clear();
+
     const std::array surfs = {m_self.lock()};
-    bfHelper(surfs, fn, data);
+    bfHelper(
+        surfs, [this](SP<CWLSurfaceResource> surf, const Vector2D& offset, void* data) { m_treeCache.nodes.emplace_back(STreeNode{.surface = surf, .offset = offset}); },
+        nullptr);
+
+    m_treeCache.generation = m_treeGeneration;
+}
+
+void CWLSurfaceResource::invalidateTrees() {
+    m_treeGeneration++;
 }
 
 SP<CWLSurfaceResource> CWLSurfaceResource::findFirstPreorderHelper(SP<CWLSurfaceResource> root, std::function<bool(SP<CWLSurfaceResource>)> fn) {
@@ -525,22 +541,20 @@ SP<CWLSurfaceResource> CWLSurfaceResource::findWithCM() {
 }
 
 std::pair<SP<CWLSurfaceResource>, Vector2D> CWLSurfaceResource::at(const Vector2D& localCoords, bool allowsInput) {
-    std::vector<std::pair<SP<CWLSurfaceResource>, Vector2D>> surfs;
-    breadthfirst([&surfs](SP<CWLSurfaceResource> surf, const Vector2D& offset, void* data) { surfs.emplace_back(surf, offset); }, &surfs);
-
-    for (auto const& [surf, pos] : surfs | std::views::reverse) {
-        if (!allowsInput) {
-            const auto BOX = CBox{pos, surf->m_current.size};
-            if (BOX.containsPoint(localCoords))
-                return {surf, localCoords - pos};
-        } else {
-            const auto REGION = surf->m_current.effectiveInputRegion().translate(pos);
-            if (REGION.containsPoint(localCoords))
-                return {surf, localCoords - pos};
-        }
-    }
+    // topmost wins, which is the last one in breadthfirst order
+    std::pair<SP<CWLSurfaceResource>, Vector2D> found = {nullptr, {}};
+    breadthfirst([&found, &localCoords, allowsInput](const SP<CWLSurfaceResource>& surf, const Vector2D& offset) {
+        // the input region never goes past the surface, so this is enough to skip most of them
+        if (!CBox{offset, surf->m_current.size}.containsPoint(localCoords))
+            return;
+
+        if (allowsInput && !surf->m_current.effectiveInputRegion().translate(offset).containsPoint(localCoords))
+            return;
+
+        found = {surf, localCoords - offset};
+    });
 
-    return {nullptr, {}};
+    return found;
 }
 
 uint32_t CWLSurfaceResource::id() {
@@ -592,16 +606,24 @@ SP<CWlSurface> CWLSurfaceResource::getResource() {
 }
 
 CBox CWLSurfaceResource::extends() {
-    CRegion full = CBox{{}, m_current.size};
-    breadthfirst(
-        [](SP<CWLSurfaceResource> surf, const Vector2D& offset, void* d) {
-            if (surf->m_role->role() != SURFACE_ROLE_SUBSURFACE)
-                return;
+    // bounding box of the tree, no need to build a region for that
+    CBox result = {{}, m_current.size};
+    breadthfirst([&result](const SP<CWLSurfaceResource>& surf, const Vector2D& offset) {
+        const CBox BOX = {offset, surf->m_current.size};
+        if (surf->m_role->role() != SURFACE_ROLE_SUBSURFACE || BOX.empty())
+            return;
+
+        if (result.empty()) {
+            result = BOX;
+            return;
+        }
 
-            sc<CRegion*>(d)->add(CBox{offset, surf->m_current.size});
-        },
-        &full);
-    return full.getExtents();
+        const Vector2D TL = {std::min(result.x, BOX.x), std::min(result.y, BOX.y)};
+        const Vector2D BR = {std::max(result.x + result.w, BOX.x + BOX.w), std::max(result.y + result.h, BOX.y + BOX.h)};
+        result            = {TL, BR - TL};
+    });
+
+    return result.empty() ? CBox{} : result;
 }
 
 void CWLSurfaceResource::scheduleState(WP<SSurfaceState> state) {
@@ -622,7 +644,8 @@ void CWLSurfaceResource::scheduleState(WP<SSurfaceState> state) {
                 whenReadable(state);
         }
     } else if (state->buffer && state->buffer->isSynchronous()) {
-        // synchronous (shm) buffers can be read immediately
+        // synchronous (shm) buffers can be read immediately, possibly on the upload thread
+        uploadShmAsync(state);
         m_stateQueue.unlockFence(state);
     } else if (state->buffer && !state->buffer->m_syncFds.empty()) {
         // async buffer and is dmabuf, then we can wait on implicit fences
@@ -662,10 +685,11 @@ void CWLSurfaceResource::commitState(SSurfaceState& state) {
 
     auto lastTexture = m_current.texture;
     m_current.updateFrom(state);
+    m_stateGeneration = m_nextStateGeneration++;
 
     if (m_current.buffer) {
         if (m_current.buffer->isSynchronous())
-            m_current.updateSynchronousTexture(lastTexture);
+            updateShmTexture(lastTexture);
 
         // if the surface is a cursor, update the shm buffer
         // TODO: don't update the entire texture
@@ -684,16 +708,14 @@ void CWLSurfaceResource::commitState(SSurfaceState& state) {
         m_events.commit.emit();
     } else {
         // send commit to all synced surfaces in this tree.
-        breadthfirst(
-            [](SP<CWLSurfaceResource> surf, const Vector2D& offset, void* data) {
-                if (surf->m_role->role() == SURFACE_ROLE_SUBSURFACE) {
-                    auto subsurface = sc<CSubsurfaceRole*>(surf->m_role.get())->m_subsurface.lock();
-                    if (!subsurface->m_sync)
-                        return;
-                }
-                surf->m_events.commit.emit();
-            },
-            nullptr);
+        breadthfirst([](const SP<CWLSurfaceResource>& surf, const Vector2D& offset) {
+            if (surf->m_role->role() == SURFACE_ROLE_SUBSURFACE) {
+                auto subsurface = sc<CSubsurfaceRole*>(surf->m_role.get())->m_subsurface.lock();
+                if (!subsurface->m_sync)
+                    return;
+            }
+            surf->m_events.commit.emit();
+        });
     }
 
     // release the buffer if it's synchronous (SHM) as updateSynchronousTexture() has copied the buffer data to a GPU tex
@@ -724,6 +746,8 @@ PImageDescription CWLSurfaceResource::getPreferredImageDescription() {
 }
 
 void CWLSurfaceResource::sortSubsurfaces() {
+    invalidateTrees();
+
     std::erase_if(m_subsurfaces, [](const auto& subsurface) { return !subsurface; });
     std::ranges::sort(m_subsurfaces, [](const auto& a, const auto& b) { return a->m_zIndex < b->m_zIndex; });
 
@@ -827,6 +851,111 @@ void CWLSurfaceResource::updateCursorShm(CRegion damage) {
     }
 }
 
+static pid_t clientPid(wl_client* client) {
+    pid_t pid = 0;
+    if (client)
+        wl_client_get_credentials(client, &pid, nullptr, nullptr);
+    return pid;
+}
+
+void CWLSurfaceResource::updateShmTexture(SP<Render::ITexture> lastTexture) {
+    if (m_current.textureReady) {
+        // the upload thread already put this buffer into the back texture, the one shown until now becomes the new back
+        m_current.textureReady = false;
+        m_shmUpload.back       = lastTexture;
+        m_shmUpload.front      = m_current.texture;
+        return;
+    }
+
+    const auto STATS = m_current.updateSynchronousTexture(lastTexture);
+    if (STATS.uploads)
+        Render::shmUploadStats().record(clientPid(m_client), STATS);
+
+    if (!m_current.texture || !g_pHyprRenderer->canUploadShmAsync()) {
+        m_shmUpload.back.reset();
+        return;
+    }
+
+    if (m_shmUpload.back && m_current.texture == lastTexture && m_shmUpload.front == lastTexture) {
+        m_shmUpload.stale.add(m_current.accumulateBufferDamage().intersect(CBox{{}, m_current.bufferSize}));
+        return;
+    }
+
+    // a new texture, so the back one has to start over as a full copy. That one still happens here, once per size.
+    auto [dataPtr, fmt, size] = m_current.buffer->beginDataPtr(0);
+    if (dataPtr && m_current.bufferSize.y > 0) {
+        const auto DRMFORMAT = NFormatUtils::shmToDRM(fmt);
+
+        m_shmUpload.back      = g_pHyprRenderer->createTexture(DRMFORMAT, dataPtr, size / m_current.bufferSize.y, m_current.bufferSize);
+        m_shmUpload.front     = m_current.texture;
+        m_shmUpload.drmFormat = DRMFORMAT;
+        m_shmUpload.stale.clear();
+    } else
+        m_shmUpload.back.reset();
+    m_current.buffer->endDataPtr();
+}
+
+bool CWLSurfaceResource::uploadShmAsync(WP<SSurfaceState> state) {
+    static auto PMERGEWASTE = CConfigValue<Config::FLOAT>("render:shm_upload_merge_waste");
+
+    // only the next state to apply can go ahead. Anything queued before it would still change the shown texture.
+    if (m_shmUpload.pending || !m_shmUpload.back || m_stateQueue.size() != 1 || !g_pHyprRenderer->canUploadShmAsync())
+        return false;
+
+    const auto SHM = dc<CWLSHMBuffer*>(state->buffer.m_buffer.get());
+    if (!SHM || !SHM->m_pool)
+        return false;
+
+    const auto DRMFORMAT = NFormatUtils::shmToDRM(SHM->m_fmt);
+    if (m_shmUpload.front != m_current.texture || m_shmUpload.back->m_size != state->bufferSize || m_shmUpload.drmFormat != DRMFORMAT)
+        return false;
+
+    const auto DAMAGE = state->accumulateBufferDamage().intersect(CBox{{}, state->bufferSize});
+
+    auto       job = makeUnique<Render::SShmUploadJob>();
+    job->texture   = m_shmUpload.back;
+    job->pool      = SHM->m_pool;
+    job->offset    = SHM->m_offset;
+    job->stride    = SHM->m_stride;
+    job->drmFormat = DRMFORMAT;
+    job->rects     = Render::coalesceUploadRects(CRegion{DAMAGE}.add(m_shmUpload.stale).intersect(CBox{{}, state->bufferSize}), *PMERGEWASTE);
+
+    Render::SShmUploadStats stats = {.uploads = 1, .offloaded = 1, .rects = job->rects.size(), .bytes = Render::uploadBytes(job->rects, SHM->m_stride, state->bufferSize.x)};
+    DAMAGE.forEachRect([&stats](const auto&) { stats.damageRects++; });
+
+    job->onDone = [this, self = m_self, state, DAMAGE, stats](const Render::SShmUploadJob& job) mutable {
+        if (!self)
+            return;
+
+        m_shmUpload.pending = false;
+
+        if (!state) {
+            // dropped along with the queue, nothing tracks what the back texture holds now
+            m_shmUpload.back.reset();
+            return;
+        }
+
+        if (job.ok) {
+            state->texture      = job.texture;
+            state->textureReady = true;
+
+            // back now matches this buffer, the shown texture lags behind by its damage
+            m_shmUpload.stale = DAMAGE;
+
+            stats.ms = job.ms;
+            Render::shmUploadStats().record(clientPid(m_client), stats);
+        } else
+            m_shmUpload.back.reset();
+
+        m_stateQueue.unlock(state, LOCK_REASON_UPLOAD);
+    };
+
+    m_shmUpload.pending = true;
+    m_stateQueue.lock(state, LOCK_REASON_UPLOAD);
+    g_pHyprRenderer->uploadShmAsync(std::move(job));
+    return true;
+}
+
 void CWLSurfaceResource::presentFeedback(const Time::steady_tp& when, PHLMONITOR pMonitor, bool discarded) {
     frame(when);
 
@@ -893,6 +1022,10 @@ bool CWLCompositorResource::good() {
     return m_resource->resource();
 }
 
+wl_client* CWLCompositorResource::client() {
+    return m_resource->client();
+}
+
 CWLCompositorProtocol::CWLCompositorProtocol(const wl_interface* iface, const int& ver, const std::string& name) : IWaylandProtocol(iface, ver, name) {
     ;
 }
@@ -908,7 +1041,13 @@ void CWLCompositorProtocol::bindManager(wl_client* client, void* data, uint32_t
 }
 
 void CWLCompositorProtocol::destroyResource(CWLCompositorResource* resource) {
+    const auto PID = clientPid(resource->client());
+
     std::erase_if(m_managers, [&](const auto& other) { return other.get() == resource; });
+
+    // upload stats are per pid, drop them with its last client
+    if (std::ranges::none_of(m_managers, [PID](const auto& other) { return clientPid(other->client()) == PID; }))
+        Render::shmUploadStats().forget(PID);
 }
 
 void CWLCompositorProtocol::destroyResource(CWLSurfaceResource* resource) {
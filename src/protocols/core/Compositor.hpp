@@ -8,6 +8,7 @@
      - wl_callback
 */
 
+#include <array>
 #include <span>
 #include <vector>
 #include <queue>
@@ -106,6 +107,7 @@ class CWLSurfaceResource {
     SSurfaceState                          m_current;
     SSurfaceState                          m_pending;
     CSurfaceStateQueue                     m_stateQueue;
+    uint64_t                               m_stateGeneration = 0; // changes with every commit to m_current, unique across surfaces
 
     WP<CWLSurfaceResource>                 m_self;
     WP<Desktop::View::CWLSurface>          m_hlSurface;
@@ -135,6 +137,36 @@ class CWLSurfaceResource {
     // localCoords param is relative to 0,0 of this surface
     std::pair<SP<CWLSurfaceResource>, Vector2D> at(const Vector2D& localCoords, bool allowsInput = false);
 
+    // same order and offsets as the std::function version, without allocating or type erasure.
+    // visitor is called with (const SP<CWLSurfaceResource>&, const Vector2D& offset)
+    template <typename F>
+    void breadthfirst(F&& visitor) {
+        const auto SELF = m_self.lock();
+        if (!SELF)
+            return;
+
+        if (m_treeCache.generation != m_treeGeneration) {
+            if (m_treeCache.users > 0) {
+                // the tree changed under a running traversal of it, don't pull the cache from under the outer loop
+                const std::array surfs = {SELF};
+                bfHelper(surfs, [&visitor](SP<CWLSurfaceResource> surf, const Vector2D& offset, void*) { visitor(surf, offset); }, nullptr);
+                return;
+            }
+
+            rebuildTreeCache();
+        }
+
+        m_treeCache.users++;
+        for (const auto& node : m_treeCache.nodes) {
+            if (const auto SURF = node.surface.lock())
+                visitor(SURF, node.offset);
+        }
+        m_treeCache.users--;
+    }
+
+    // call on any change to subsurface trees: parents, stacking, positions or roles
+    static void invalidateTrees();
+
   private:
     SP<CWlSurface>                     m_resource;
     wl_client*                         m_client        = nullptr;
@@ -148,7 +180,34 @@ class CWLSurfaceResource {
     void                               discardPresentationFeedbacks();
     void                               bfHelper(std::span<const SP<CWLSurfaceResource>> nodes, std::function<void(SP<CWLSurfaceResource>, const Vector2D&, void*)> fn, void* data);
     SP<CWLSurfaceResource>             findFirstPreorderHelper(SP<CWLSurfaceResource> root, std::function<bool(SP<CWLSurfaceResource>)> fn);
+    void                               rebuildTreeCache();
     void                               updateCursorShm(CRegion damage = CBox{0, 0, INT16_MAX, INT16_MAX});
+    void                               updateShmTexture(SP<Render::ITexture> lastTexture);
+    bool                               uploadShmAsync(WP<SSurfaceState> state);
+
+    struct STreeNode {
+        WP<CWLSurfaceResource> surface;
+        Vector2D               offset;
+    };
+
+    // flattened breadthfirst order of this tree, rebuilt when m_treeGeneration moves
+    struct {
+        std::vector<STreeNode> nodes;
+        uint64_t               generation = 0;
+        int                    users      = 0;
+    } m_treeCache;
+
+    inline static uint64_t m_treeGeneration      = 1;
+    inline static uint64_t m_nextStateGeneration = 1;
+
+    // with the shm upload thread, buffers are uploaded to a second texture that takes over once their state is committed
+    struct {
+        SP<Render::ITexture> back;
+        WP<Render::ITexture> front; // the shown texture back was last in sync with
+        CRegion              stale; // where back may differ from front, buffer coords
+        uint32_t             drmFormat = 0;
+        bool                 pending   = false;
+    } m_shmUpload;
 
     friend class CWLPointerResource;
 };
@@ -157,7 +216,8 @@ class CWLCompositorResource {
   public:
     CWLCompositorResource(SP<CWlCompositor> resource_);
 
-    bool good();
+    bool       good();
+    wl_client* client();
 
   private:
     SP<CWlCompositor> m_resource;
@@ -90,6 +90,8 @@ CSHMPool::~CSHMPool() {
 void CSHMPool::resize(size_t size_) {
     LOGM(Log::DEBUG, "Resizing a SHM pool from {} to {}", m_size, size_);
 
+    std::lock_guard lk(m_mapMutex);
+
     if (m_data != MAP_FAILED)
         munmap(m_data, m_size);
 
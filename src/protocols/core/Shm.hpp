@@ -9,6 +9,7 @@
 
 #include <hyprutils/os/FileDescriptor.hpp>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <cstdint>
 #include "../WaylandProtocol.hpp"
@@ -27,6 +28,7 @@ class CSHMPool {
     Hyprutils::OS::CFileDescriptor m_fd;
     size_t                         m_size = 0;
     void*                          m_data = nullptr;
+    std::mutex                     m_mapMutex; // held by the shm upload thread while it reads m_data
 
     void                           resize(size_t size);
 };
@@ -10,7 +10,10 @@ CWLSubsurfaceResource::CWLSubsurfaceResource(SP<CWlSubsurface> resource_, SP<CWL
     m_resource->setOnDestroy([this](CWlSubsurface* r) { destroy(); });
     m_resource->setDestroy([this](CWlSubsurface* r) { destroy(); });
 
-    m_resource->setSetPosition([this](CWlSubsurface* r, int32_t x, int32_t y) { m_position = {x, y}; });
+    m_resource->setSetPosition([this](CWlSubsurface* r, int32_t x, int32_t y) {
+        m_position = {x, y};
+        CWLSurfaceResource::invalidateTrees();
+    });
 
     m_resource->setSetDesync([this](CWlSubsurface* r) { m_sync = false; });
     m_resource->setSetSync([this](CWlSubsurface* r) { m_sync = true; });
@@ -21,6 +24,8 @@ CWLSubsurfaceResource::CWLSubsurfaceResource(SP<CWlSubsurface> resource_, SP<CWL
         if (!m_parent)
             return;
 
+        CWLSurfaceResource::invalidateTrees();
+
         std::erase_if(m_parent->m_subsurfaces, [this](const auto& e) { return e == m_self || !e; });
 
         std::ranges::for_each(m_parent->m_subsurfaces, [](const auto& e) { e->m_zIndex *= 2; });
@@ -51,6 +56,8 @@ CWLSubsurfaceResource::CWLSubsurfaceResource(SP<CWlSubsurface> resource_, SP<CWL
         if (!m_parent)
             return;
 
+        CWLSurfaceResource::invalidateTrees();
+
         std::erase_if(m_parent->m_subsurfaces, [this](const auto& e) { return e == m_self || !e; });
 
         std::ranges::for_each(m_parent->m_subsurfaces, [](const auto& e) { e->m_zIndex *= 2; });
@@ -114,6 +121,7 @@ void CWLSubsurfaceResource::unlinkFromParent() {
         return;
 
     std::erase_if(PARENT->m_subsurfaces, [this](const auto& subsurface) { return !subsurface || subsurface.get() == this; });
+    CWLSurfaceResource::invalidateTrees();
 }
 
 Vector2D CWLSubsurfaceResource::posRelativeToParent() {
@@ -202,6 +210,7 @@ CWLSubcompositorResource::CWLSubcompositorResource(SP<CWlSubcompositor> resource
         RESOURCE->m_self = RESOURCE;
         SURF->m_role     = makeShared<CSubsurfaceRole>(RESOURCE);
         PARENT->m_subsurfaces.emplace_back(RESOURCE);
+        CWLSurfaceResource::invalidateTrees();
 
         LOGM(Log::DEBUG, "New wl_subsurface with id {} at {:x}", id, (uintptr_t)RESOURCE.get());
 
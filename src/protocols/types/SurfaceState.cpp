@@ -3,6 +3,7 @@
 #include "protocols/types/Buffer.hpp"
 #include "protocols/PresentationTime.hpp"
 #include "managers/eventLoop/EventLoopManager.hpp"
+#include "config/ConfigValue.hpp"
 #include "render/Renderer.hpp"
 #include "render/Texture.hpp"
 
@@ -55,18 +56,39 @@ CRegion SSurfaceState::effectiveInputRegion() const {
     return input.copy().intersect(CBox{{}, size});
 }
 
-void SSurfaceState::updateSynchronousTexture(SP<Render::ITexture> lastTexture) {
+Render::SShmUploadStats SSurfaceState::updateSynchronousTexture(SP<Render::ITexture> lastTexture) {
+    static auto             PMERGEWASTE = CConfigValue<Config::FLOAT>("render:shm_upload_merge_waste");
+
+    Render::SShmUploadStats stats;
+
     auto [dataPtr, fmt, size] = buffer->beginDataPtr(0);
     if (dataPtr) {
-        auto drmFmt = NFormatUtils::shmToDRM(fmt);
-        auto stride = bufferSize.y ? size / bufferSize.y : 0;
+        const auto BEGIN  = Time::steadyNow();
+        auto       drmFmt = NFormatUtils::shmToDRM(fmt);
+        auto       stride = bufferSize.y ? size / bufferSize.y : 0;
         if (lastTexture && lastTexture->m_isSynchronous && lastTexture->m_size == bufferSize) {
+            const auto DAMAGE = accumulateBufferDamage().intersect(CBox{{}, bufferSize});
+            const auto RECTS  = Render::coalesceUploadRects(DAMAGE, *PMERGEWASTE);
+
             texture = lastTexture;
-            texture->update(drmFmt, dataPtr, stride, accumulateBufferDamage());
-        } else
-            texture = g_pHyprRenderer->createTexture(drmFmt, dataPtr, stride, bufferSize);
+            texture->update(drmFmt, dataPtr, stride, RECTS);
+
+            DAMAGE.forEachRect([&stats](const auto&) { stats.damageRects++; });
+            stats.rects = RECTS.size();
+            stats.bytes = Render::uploadBytes(RECTS, stride, bufferSize.x);
+        } else {
+            texture           = g_pHyprRenderer->createTexture(drmFmt, dataPtr, stride, bufferSize);
+            stats.damageRects = 1;
+            stats.rects       = 1;
+            stats.bytes       = size;
+        }
+
+        stats.uploads = 1;
+        stats.ms      = std::chrono::duration<double, std::milli>(Time::steadyNow() - BEGIN).count();
     }
     buffer->endDataPtr();
+
+    return stats;
 }
 
 void SSurfaceState::reset() {
@@ -126,10 +148,11 @@ void SSurfaceState::mergeFrom(SSurfaceState& ref) {
         if (!presentationFeedbacks.empty())
             PROTO::presentation->discardFeedbacks(presentationFeedbacks);
 
-        buffer     = ref.buffer;
-        texture    = ref.texture;
-        size       = ref.size;
-        bufferSize = ref.bufferSize;
+        buffer       = ref.buffer;
+        texture      = ref.texture;
+        textureReady = ref.textureReady;
+        size         = ref.size;
+        bufferSize   = ref.bufferSize;
     }
 
     if (ref.updated.bits.damage) {
@@ -182,10 +205,11 @@ void SSurfaceState::updateFrom(SSurfaceState& ref) {
         if (!presentationFeedbacks.empty())
             PROTO::presentation->discardFeedbacks(presentationFeedbacks);
 
-        buffer     = ref.buffer;
-        texture    = ref.texture;
-        size       = ref.size;
-        bufferSize = ref.bufferSize;
+        buffer       = ref.buffer;
+        texture      = ref.texture;
+        textureReady = ref.textureReady;
+        size         = ref.size;
+        bufferSize   = ref.bufferSize;
     }
 
     if (ref.updated.bits.damage) {
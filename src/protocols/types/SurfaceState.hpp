@@ -3,6 +3,7 @@
 #include "../../helpers/math/Math.hpp"
 #include "../../helpers/time/Time.hpp"
 #include "../../managers/eventLoop/EventLoopTimer.hpp"
+#include "../../render/ShmUpload.hpp"
 #include "../WaylandProtocol.hpp"
 #include "./Buffer.hpp"
 
@@ -15,10 +16,11 @@ class CPresentationFeedback;
 struct SReadableWaiter;
 
 enum eLockReason : uint8_t {
-    LOCK_REASON_NONE  = 0,
-    LOCK_REASON_FENCE = 1 << 0,
-    LOCK_REASON_FIFO  = 1 << 1,
-    LOCK_REASON_TIMER = 1 << 2
+    LOCK_REASON_NONE   = 0,
+    LOCK_REASON_FENCE  = 1 << 0,
+    LOCK_REASON_FIFO   = 1 << 1,
+    LOCK_REASON_TIMER  = 1 << 2,
+    LOCK_REASON_UPLOAD = 1 << 3
 };
 
 inline eLockReason operator|(eLockReason a, eLockReason b) {
@@ -104,8 +106,9 @@ struct SSurfaceState {
     eLockReason         lockMask = LOCK_REASON_NONE;
 
     // texture of surface content, used for rendering
-    SP<Render::ITexture> texture;
-    void                 updateSynchronousTexture(SP<Render::ITexture> lastTexture);
+    SP<Render::ITexture>    texture;
+    bool                    textureReady = false; // texture already holds the shm buffer, uploaded off the main thread
+    Render::SShmUploadStats updateSynchronousTexture(SP<Render::ITexture> lastTexture);
 
     // fifo
     bool barrierSet            = false;
@@ -76,6 +76,10 @@ void CSurfaceStateQueue::unlockFirst(eLockReason reason) {
     tryProcess();
 }
 
+size_t CSurfaceStateQueue::size() const {
+    return m_queue.size();
+}
+
 auto CSurfaceStateQueue::find(const WP<SSurfaceState>& state) -> std::deque<UP<SSurfaceState>>::iterator {
     if (state.expired())
         return m_queue.end();
@@ -19,6 +19,7 @@ class CSurfaceStateQueue {
     void              unlockFence(const WP<SSurfaceState>& state);
     void              unlockFirst(eLockReason reason);
     void              tryProcess();
+    size_t            size() const;
 
   private:
     std::deque<UP<SSurfaceState>>                    m_queue;
@@ -1,6 +1,7 @@
 #include "Framebuffer.hpp"
 #include "helpers/Format.hpp"
 #include "helpers/cm/ColorManagement.hpp"
+#include "../protocols/types/Buffer.hpp"
 
 using namespace Render;
 
@@ -24,6 +25,14 @@ bool IFramebuffer::alloc(int w, int h, DRMFormat format) {
     return m_fbAllocated;
 }
 
+bool IFramebuffer::queueReadback(const CRegion& region, DRMFormat format) {
+    return false;
+}
+
+bool IFramebuffer::finishReadback(CHLBufferReference buffer) {
+    return false;
+}
+
 bool IFramebuffer::isAllocated() {
     return m_fbAllocated && m_tex;
 }
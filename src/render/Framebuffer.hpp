@@ -33,6 +33,11 @@ namespace Render {
 
         virtual void                        addStencil(SP<ITexture> tex) = 0;
 
+        // Asynchronous shm readback: queueReadback() copies the region into a staging buffer without waiting on the gpu,
+        // finishReadback() writes it into an shm buffer once the gpu is done. Returns false where unsupported, use readPixels() then.
+        virtual bool                        queueReadback(const CRegion& region, DRMFormat format);
+        virtual bool                        finishReadback(CHLBufferReference buffer);
+
         Vector2D                            m_size;
         DRMFormat                           m_drmFormat = DRM_FORMAT_INVALID;
 
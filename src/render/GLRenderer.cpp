@@ -274,6 +274,20 @@ SP<ITexture> CHyprGLRenderer::createTexture(std::span<const float> lut3D, size_t
     return makeShared<CGLTexture>(lut3D, N);
 }
 
+bool CHyprGLRenderer::canUploadShmAsync() {
+    return g_pHyprOpenGL->shmUploadWorker();
+}
+
+void CHyprGLRenderer::uploadShmAsync(UP<SShmUploadJob>&& job) {
+    const auto WORKER = g_pHyprOpenGL->shmUploadWorker();
+    if (!WORKER) {
+        IHyprRenderer::uploadShmAsync(std::move(job));
+        return;
+    }
+
+    WORKER->queue(std::move(job));
+}
+
 bool CHyprGLRenderer::explicitSyncSupported() {
     return g_pHyprOpenGL->explicitSyncSupported();
 }
@@ -21,6 +21,8 @@ namespace Render::GL {
         SP<ITexture>            createTexture(const int width, const int height, unsigned char* const data) override;
         SP<ITexture>            createTexture(cairo_surface_t* cairo) override;
         SP<ITexture>            createTexture(std::span<const float> lut3D, size_t N) override;
+        bool                    canUploadShmAsync() override;
+        void                    uploadShmAsync(UP<SShmUploadJob>&& job) override;
         bool                    explicitSyncSupported() override;
         bool                    fp16Supported() override;
         std::vector<SDRMFormat> getDRMFormats() override;
@@ -38,6 +38,7 @@
 #include "errorOverlay/Overlay.hpp"
 #include "helpers/Color.hpp"
 #include "macros.hpp"
+#include "../version.h"
 #include "pass/TexPassElement.hpp"
 #include "pass/RectPassElement.hpp"
 #include "pass/PreBlurElement.hpp"
@@ -228,6 +229,8 @@ void CHyprOpenGLImpl::initEGL(bool gbm) {
             RASSERT(false, "EGL: failed to create a context with either GLES3.2 or 3.0");
     }
 
+    m_eglContextAttrs = attrs;
+
     if (m_exts.IMG_context_priority) {
         EGLint priority = EGL_CONTEXT_PRIORITY_MEDIUM_IMG;
         eglQueryContext(m_eglDisplay, m_eglContext, EGL_CONTEXT_PRIORITY_LEVEL_IMG, &priority);
@@ -376,6 +379,17 @@ CHyprOpenGLImpl::CHyprOpenGLImpl() : m_drmFD(g_pCompositor->m_drmRenderNode.fd >
     Log::logger->log(Log::DEBUG, "Renderer: {}", rc<const char*>(glGetString(GL_RENDERER)));
     Log::logger->log(Log::DEBUG, "Supported extensions: ({}) {}", std::ranges::count(m_extensions, ' '), m_extensions);
 
+    GLint binaryFormats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+    m_programBinariesSupported = binaryFormats > 0;
+
+    // program binaries are only valid for the exact driver that produced them, and our shaders change between builds
+    const auto glString = [](GLenum name) {
+        const auto STR = rc<const char*>(glGetString(name));
+        return std::string{STR ? STR : ""};
+    };
+    m_driverID = std::format("{}|{}|{}|{}", glString(GL_VENDOR), glString(GL_RENDERER), glString(GL_VERSION), GIT_COMMIT_HASH);
+
     m_exts.EXT_read_format_bgra        = m_extensions.contains("GL_EXT_read_format_bgra");
     m_exts.EXT_color_buffer_half_float = m_extensions.contains("GL_EXT_color_buffer_half_float") || m_extensions.contains("GL_EXT_color_buffer_float");
 
@@ -458,6 +472,8 @@ CHyprOpenGLImpl::CHyprOpenGLImpl() : m_drmFD(g_pCompositor->m_drmRenderNode.fd >
 }
 
 CHyprOpenGLImpl::~CHyprOpenGLImpl() {
+    m_shmUploadWorker.reset();
+
     if (m_eglDisplay && m_eglContext != EGL_NO_CONTEXT)
         eglDestroyContext(m_eglDisplay, m_eglContext);
 
@@ -468,6 +484,9 @@ CHyprOpenGLImpl::~CHyprOpenGLImpl() {
 
     if (m_gbmDevice)
         gbm_device_destroy(m_gbmDevice);
+
+    if (m_prewarmTimer && g_pEventLoopManager)
+        g_pEventLoopManager->removeTimer(m_prewarmTimer);
 }
 
 std::optional<std::vector<uint64_t>> CHyprOpenGLImpl::getModsForFormat(EGLint format) {
@@ -981,6 +1000,10 @@ const std::array<std::string, SH_FRAG_LAST> FRAG_SHADERS = {
 bool CHyprOpenGLImpl::initShaders(const std::string& path) {
     auto              shaders = makeShared<SPreparedShaders>();
     static const auto PCM     = CConfigValue<Config::INTEGER>("render:cm_enabled");
+    static const auto PCACHE  = CConfigValue<Config::INTEGER>("render:shader_cache");
+
+    if (!g_pShaderCache)
+        g_pShaderCache = makeUnique<CShaderCache>(*PCACHE ? NFsUtils::getCacheHome().value_or("") : "", m_driverID);
 
     try {
         auto shaderLoader = makeUnique<CShaderLoader>(SHADER_INCLUDES, FRAG_SHADERS, path);
@@ -1004,9 +1027,51 @@ bool CHyprOpenGLImpl::initShaders(const std::string& path) {
     m_shadersInitialized = true;
 
     Log::logger->log(Log::DEBUG, "Shaders initialized successfully.");
+
+    prewarmShaders();
     return true;
 }
 
+void CHyprOpenGLImpl::prewarmShaders() {
+    if (!g_pShaderCache || g_pShaderCache->recorded().empty())
+        return;
+
+    // popped from the back, so reverse to compile in the order the variants were first needed
+    m_prewarmQueue.assign(g_pShaderCache->recorded().rbegin(), g_pShaderCache->recorded().rend());
+
+    Log::logger->log(Log::DEBUG, "Prewarming {} shader variants", m_prewarmQueue.size());
+
+    if (!m_prewarmTimer) {
+        m_prewarmTimer = makeShared<CEventLoopTimer>(std::nullopt, [this](SP<CEventLoopTimer> self, void* data) { prewarmNextShader(); }, nullptr);
+        g_pEventLoopManager->addTimer(m_prewarmTimer);
+    }
+
+    m_prewarmTimer->updateTimeout(std::chrono::milliseconds(1));
+}
+
+// one variant per event loop iteration, so a long compile never holds up more than a single frame
+void CHyprOpenGLImpl::prewarmNextShader() {
+    while (!m_prewarmQueue.empty()) {
+        const auto NEXT = m_prewarmQueue.back();
+        m_prewarmQueue.pop_back();
+
+        if (!m_shaders || m_shaders->fragVariants[NEXT.frag].contains(NEXT.variant))
+            continue;
+
+        makeEGLCurrent();
+        getShaderVariant(NEXT.frag, NEXT.variant);
+        g_pShaderCache->stats().prewarmed++;
+        break;
+    }
+
+    if (m_prewarmQueue.empty()) {
+        Log::logger->log(Log::DEBUG, "Shader prewarm done, {} variants compiled ahead of use", g_pShaderCache->stats().prewarmed);
+        return;
+    }
+
+    m_prewarmTimer->updateTimeout(std::chrono::milliseconds(1));
+}
+
 void CHyprOpenGLImpl::applyScreenShader(const std::string& path) {
 
     static auto PDT = CConfigValue<Config::INTEGER>("debug:damage_tracking");
@@ -2545,6 +2610,28 @@ bool CHyprOpenGLImpl::fp16Supported() {
     return m_fp16Supported;
 }
 
+bool CHyprOpenGLImpl::programBinariesSupported() {
+    return m_programBinariesSupported;
+}
+
+CShmUploadWorker* CHyprOpenGLImpl::shmUploadWorker() {
+    static auto PTHREAD = CConfigValue<Config::INTEGER>("render:shm_upload_thread");
+
+    if (!*PTHREAD)
+        return nullptr;
+
+    if (!m_shmUploadWorker) {
+        // textures are shared with the main context, everything else is the worker's own
+        const auto CONTEXT = eglCreateContext(m_eglDisplay, EGL_NO_CONFIG_KHR, m_eglContext, m_eglContextAttrs.data());
+        if (CONTEXT == EGL_NO_CONTEXT)
+            Log::logger->log(Log::ERR, "EGL: failed to create a shared context for shm uploads, uploading on the main thread");
+
+        m_shmUploadWorker = makeUnique<CShmUploadWorker>(m_eglDisplay, CONTEXT);
+    }
+
+    return m_shmUploadWorker->ok() ? m_shmUploadWorker.get() : nullptr;
+}
+
 WP<CShader> CHyprOpenGLImpl::getShaderVariant(ePreparedFragmentShader frag, ShaderFeatureFlags features, eTransferFunction sourceTF, eTransferFunction targetTF) {
     return getShaderVariant(frag, SShaderVariant{.features = features, .sourceTF = sourceTF, .targetTF = targetTF});
 }
@@ -2554,14 +2641,21 @@ WP<CShader> CHyprOpenGLImpl::getShaderVariant(ePreparedFragmentShader frag, cons
     auto  it       = variants.find(variant);
 
     if (it == variants.end()) {
-        auto shader = makeShared<CShader>();
+        auto   shader = makeShared<CShader>();
+
+        CTimer timer;
+        timer.reset();
 
         Log::logger->log(Log::INFO, "compiling feature set {} (TFs {} -> {}) for {}", variant.features, sc<int>(variant.sourceTF), sc<int>(variant.targetTF), FRAG_SHADERS[frag]);
 
         const auto fragSrc = g_pShaderLoader->getVariantSource(frag, variant);
 
-        if (!shader->createProgram(m_shaders->TEXVERTSRC, fragSrc, true, true))
-            Log::logger->log(Log::ERR, "shader features {} failed for {}", variant.features, FRAG_SHADERS[frag]);
+        createVariantProgram(shader, frag, variant, fragSrc);
+
+        if (g_pShaderCache) {
+            g_pShaderCache->addCompileTime(timer.getMillis());
+            g_pShaderCache->record(frag, variant);
+        }
 
         it = variants.emplace(variant, std::move(shader)).first;
         return it->second;
@@ -2571,6 +2665,29 @@ WP<CShader> CHyprOpenGLImpl::getShaderVariant(ePreparedFragmentShader frag, cons
     return it->second;
 }
 
+void CHyprOpenGLImpl::createVariantProgram(SP<CShader> shader, ePreparedFragmentShader frag, const SShaderVariant& variant, const std::string& fragSrc) {
+    const bool     USE_BINARY  = g_pShaderCache && m_programBinariesSupported;
+    const uint64_t SOURCE_HASH = CShaderCache::hash(fragSrc, CShaderCache::hash(m_shaders->TEXVERTSRC));
+
+    if (USE_BINARY) {
+        if (const auto BINARY = g_pShaderCache->binary(frag, variant, SOURCE_HASH); BINARY) {
+            if (shader->createProgramFromBinary(*BINARY))
+                return;
+
+            g_pShaderCache->stats().binaryRejected++;
+        }
+    }
+
+    if (!shader->createProgram(m_shaders->TEXVERTSRC, fragSrc, true, true)) {
+        Log::logger->log(Log::ERR, "shader features {} failed for {}", variant.features, FRAG_SHADERS[frag]);
+        return;
+    }
+
+    SProgramBinary binary;
+    if (USE_BINARY && shader->getProgramBinary(binary))
+        g_pShaderCache->storeBinary(frag, variant, SOURCE_HASH, binary);
+}
+
 std::vector<SDRMFormat> CHyprOpenGLImpl::getDRMFormats() {
     return m_drmFormats;
 }
@@ -38,11 +38,13 @@
 #include "ShaderLoader.hpp"
 #include "gl/GLFramebuffer.hpp"
 #include "gl/GLRenderbuffer.hpp"
+#include "gl/ShmUploadWorker.hpp"
 #include "pass/TexPassElement.hpp"
 
 #define GLFB(ifb) dc<CGLFramebuffer*>(ifb.get())
 
 struct gbm_device;
+class CEventLoopTimer;
 namespace Render {
     class IHyprRenderer;
 }
@@ -251,11 +253,14 @@ namespace Render::GL {
         EGLImageKHR                               createEGLImage(const Aquamarine::SDMABUFAttrs& attrs);
 
         bool                                      initShaders(const std::string& path = "");
+        void                                      prewarmShaders();
 
         WP<CShader>                               useShader(WP<CShader> prog);
 
         bool                                      explicitSyncSupported();
         bool                                      fp16Supported();
+        bool                                      programBinariesSupported();
+        CShmUploadWorker*                         shmUploadWorker(); // nullptr unless render:shm_upload_thread is on
         WP<CShader>                               getShaderVariant(Render::ePreparedFragmentShader frag, Render::ShaderFeatureFlags features = 0,
                                                                    NColorManagement::eTransferFunction sourceTF = Render::SHADER_DEFAULT_TF,
                                                                    NColorManagement::eTransferFunction targetTF = Render::SHADER_DEFAULT_TF);
@@ -361,6 +366,20 @@ namespace Render::GL {
         GLint                                                m_pressedHistoryKilled    = 0;
         GLint                                                m_pressedHistoryTouched   = 0;
 
+        // shader cache, variants recorded by earlier sessions are compiled ahead of first use
+        std::vector<Render::SRecordedShaderVariant> m_prewarmQueue;
+        SP<CEventLoopTimer>                         m_prewarmTimer;
+        bool                                        m_programBinariesSupported = false;
+        std::string                                 m_driverID;
+
+        void                                        prewarmNextShader();
+        void                                        createVariantProgram(SP<CShader> shader, Render::ePreparedFragmentShader frag, const Render::SShaderVariant& variant,
+                                                                         const std::string& fragSrc);
+
+        // shm uploads, started on first use
+        std::vector<EGLint>  m_eglContextAttrs;
+        UP<CShmUploadWorker> m_shmUploadWorker;
+
         //
         std::optional<std::vector<uint64_t>> getModsForFormat(EGLint format);
 
@@ -181,6 +181,8 @@ IHyprRenderer::IHyprRenderer() {
             addWindowToRenderUnfocused(window);
     });
 
+    static auto P5 = Event::bus()->m_events.monitor.removed.listen([&](PHLMONITOR mon) { m_renderPass.dropRetained(mon->m_id); });
+
     m_cursorTicker = wl_event_loop_add_timer(g_pCompositor->m_wlEventLoop, cursorTicker, nullptr);
     wl_event_source_timer_update(m_cursorTicker, 500);
 
@@ -202,12 +204,10 @@ IHyprRenderer::IHyprRenderer() {
                 if (!w->wlSurface() || !w->wlSurface()->resource() || shouldRenderWindow(w.lock()))
                     continue;
 
-                w->wlSurface()->resource()->breadthfirst(
-                    [](SP<CWLSurfaceResource> surf, const Vector2D& offset, void* data) {
-                        surf->m_stateQueue.unlockFirst(LOCK_REASON_FENCE | LOCK_REASON_FIFO | LOCK_REASON_TIMER);
-                        surf->presentFeedback(Time::steadyNow(), Desktop::focusState()->monitor(), true);
-                    },
-                    nullptr);
+                w->wlSurface()->resource()->breadthfirst([](const SP<CWLSurfaceResource>& surf, const Vector2D& offset) {
+                    surf->m_stateQueue.unlockFirst(LOCK_REASON_FENCE | LOCK_REASON_FIFO | LOCK_REASON_TIMER);
+                    surf->presentFeedback(Time::steadyNow(), Desktop::focusState()->monitor(), true);
+                });
             }
 
             if (dirty)
@@ -697,22 +697,20 @@ void IHyprRenderer::renderWindow(PHLWINDOW pWindow, PHLMONITOR pMonitor, const T
         }
 
         renderdata.surfaceCounter = 0;
-        pWindow->wlSurface()->resource()->breadthfirst(
-            [this, &renderdata, &pWindow](SP<CWLSurfaceResource> s, const Vector2D& offset, void* data) {
-                if (!s->m_current.texture)
-                    return;
+        pWindow->wlSurface()->resource()->breadthfirst([this, &renderdata, &pWindow](const SP<CWLSurfaceResource>& s, const Vector2D& offset) {
+            if (!s->m_current.texture)
+                return;
 
-                if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
-                    return;
+            if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
+                return;
 
-                renderdata.localPos    = offset;
-                renderdata.texture     = s->m_current.texture;
-                renderdata.surface     = s;
-                renderdata.mainSurface = s == pWindow->wlSurface()->resource();
-                addPassElement(makeUnique<CSurfacePassElement>(renderdata));
-                renderdata.surfaceCounter++;
-            },
-            nullptr);
+            renderdata.localPos    = offset;
+            renderdata.texture     = s->m_current.texture;
+            renderdata.surface     = s;
+            renderdata.mainSurface = s == pWindow->wlSurface()->resource();
+            addPassElement(makeUnique<CSurfacePassElement>(renderdata));
+            renderdata.surfaceCounter++;
+        });
 
         renderdata.useNearestNeighbor = false;
 
@@ -799,22 +797,20 @@ void IHyprRenderer::renderWindow(PHLWINDOW pWindow, PHLMONITOR pMonitor, const T
                     renderdata.pos += pos;
                     renderdata.fadeAlpha = popup->alpha()[POPUP_ALPHA_FADE]->value();
 
-                    popup->wlSurface()->resource()->breadthfirst(
-                        [this, &renderdata](SP<CWLSurfaceResource> s, const Vector2D& offset, void* data) {
-                            if (!s->m_current.texture)
-                                return;
+                    popup->wlSurface()->resource()->breadthfirst([this, &renderdata](const SP<CWLSurfaceResource>& s, const Vector2D& offset) {
+                        if (!s->m_current.texture)
+                            return;
 
-                            if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
-                                return;
+                        if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
+                            return;
 
-                            renderdata.localPos    = offset;
-                            renderdata.texture     = s->m_current.texture;
-                            renderdata.surface     = s;
-                            renderdata.mainSurface = false;
-                            m_renderPass.add(makeUnique<CSurfacePassElement>(renderdata));
-                            renderdata.surfaceCounter++;
-                        },
-                        data);
+                        renderdata.localPos    = offset;
+                        renderdata.texture     = s->m_current.texture;
+                        renderdata.surface     = s;
+                        renderdata.mainSurface = false;
+                        m_renderPass.add(makeUnique<CSurfacePassElement>(renderdata));
+                        renderdata.surfaceCounter++;
+                    });
 
                     renderdata.pos = oldPos;
                 },
@@ -932,6 +928,16 @@ SP<ITexture> IHyprRenderer::createTexture(const SP<Aquamarine::IBuffer> buffer,
     return tex;
 }
 
+bool IHyprRenderer::canUploadShmAsync() {
+    return false;
+}
+
+void IHyprRenderer::uploadShmAsync(UP<SShmUploadJob>&& job) {
+    job->ok = false;
+    if (job->onDone)
+        job->onDone(*job);
+}
+
 void IHyprRenderer::renderLayer(PHLLS pLayer, PHLMONITOR pMonitor, const Time::steady_tp& time, bool popups, bool lockscreen) {
     if (!pLayer)
         return;
@@ -975,22 +981,20 @@ void IHyprRenderer::renderLayer(PHLLS pLayer, PHLMONITOR pMonitor, const Time::s
     }
 
     if (!popups)
-        pLayer->wlSurface()->resource()->breadthfirst(
-            [this, &renderdata, &pLayer](SP<CWLSurfaceResource> s, const Vector2D& offset, void* data) {
-                if (!s->m_current.texture)
-                    return;
+        pLayer->wlSurface()->resource()->breadthfirst([this, &renderdata, &pLayer](const SP<CWLSurfaceResource>& s, const Vector2D& offset) {
+            if (!s->m_current.texture)
+                return;
 
-                if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
-                    return;
+            if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
+                return;
 
-                renderdata.localPos    = offset;
-                renderdata.texture     = s->m_current.texture;
-                renderdata.surface     = s;
-                renderdata.mainSurface = s == pLayer->wlSurface()->resource();
-                m_renderPass.add(makeUnique<CSurfacePassElement>(renderdata));
-                renderdata.surfaceCounter++;
-            },
-            &renderdata);
+            renderdata.localPos    = offset;
+            renderdata.texture     = s->m_current.texture;
+            renderdata.surface     = s;
+            renderdata.mainSurface = s == pLayer->wlSurface()->resource();
+            m_renderPass.add(makeUnique<CSurfacePassElement>(renderdata));
+            renderdata.surfaceCounter++;
+        });
 
     renderdata.squishOversized = false; // don't squish popups
     renderdata.dontRound       = true;
@@ -1051,22 +1055,20 @@ void IHyprRenderer::renderIMEPopup(CInputPopup* pPopup, PHLMONITOR pMonitor, con
         renderdata.discardOpacity = *PBLURIGNOREA;
     }
 
-    SURF->breadthfirst(
-        [this, &renderdata, &SURF](SP<CWLSurfaceResource> s, const Vector2D& offset, void* data) {
-            if (!s->m_current.texture)
-                return;
+    SURF->breadthfirst([this, &renderdata, &SURF](const SP<CWLSurfaceResource>& s, const Vector2D& offset) {
+        if (!s->m_current.texture)
+            return;
 
-            if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
-                return;
+        if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
+            return;
 
-            renderdata.localPos    = offset;
-            renderdata.texture     = s->m_current.texture;
-            renderdata.surface     = s;
-            renderdata.mainSurface = s == SURF;
-            m_renderPass.add(makeUnique<CSurfacePassElement>(renderdata));
-            renderdata.surfaceCounter++;
-        },
-        &renderdata);
+        renderdata.localPos    = offset;
+        renderdata.texture     = s->m_current.texture;
+        renderdata.surface     = s;
+        renderdata.mainSurface = s == SURF;
+        m_renderPass.add(makeUnique<CSurfacePassElement>(renderdata));
+        renderdata.surfaceCounter++;
+    });
 }
 
 void IHyprRenderer::renderSessionLockSurface(WP<SSessionLockSurface> pSurface, PHLMONITOR pMonitor, const Time::steady_tp& time) {
@@ -1081,22 +1083,20 @@ void IHyprRenderer::renderSessionLockSurface(WP<SSessionLockSurface> pSurface, P
     renderdata.w        = pMonitor->m_size.x;
     renderdata.h        = pMonitor->m_size.y;
 
-    renderdata.surface->breadthfirst(
-        [this, &renderdata, &pSurface](SP<CWLSurfaceResource> s, const Vector2D& offset, void* data) {
-            if (!s->m_current.texture)
-                return;
+    renderdata.surface->breadthfirst([this, &renderdata, &pSurface](const SP<CWLSurfaceResource>& s, const Vector2D& offset) {
+        if (!s->m_current.texture)
+            return;
 
-            if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
-                return;
+        if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
+            return;
 
-            renderdata.localPos    = offset;
-            renderdata.texture     = s->m_current.texture;
-            renderdata.surface     = s;
-            renderdata.mainSurface = s == pSurface->surface->surface();
-            m_renderPass.add(makeUnique<CSurfacePassElement>(renderdata));
-            renderdata.surfaceCounter++;
-        },
-        &renderdata);
+        renderdata.localPos    = offset;
+        renderdata.texture     = s->m_current.texture;
+        renderdata.surface     = s;
+        renderdata.mainSurface = s == pSurface->surface->surface();
+        m_renderPass.add(makeUnique<CSurfacePassElement>(renderdata));
+        renderdata.surfaceCounter++;
+    });
 }
 
 void IHyprRenderer::renderAllClientsForWorkspace(PHLMONITOR pMonitor, PHLWORKSPACE pWorkspace, const Time::steady_tp& time, const Vector2D& translate, const float& scale) {
@@ -1580,50 +1580,23 @@ void IHyprRenderer::initAssets() {
 }
 
 SP<ITexture> IHyprRenderer::renderText(const std::string& text, CHyprColor col, int pt, bool italic, const std::string& fontFamily, int maxWidth, int weight) {
-    static auto           FONT = CConfigValue<std::string>("misc:font_family");
-
-    const auto            FONTFAMILY = fontFamily.empty() ? *FONT : fontFamily;
-    const auto            FONTSIZE   = pt;
-    const auto            COLOR      = col;
-
-    PangoFontMap*         fontMap    = pango_cairo_font_map_get_default();
-    PangoContext*         context    = pango_font_map_create_context(fontMap);
-    PangoLayout*          layoutText = pango_layout_new(context);
-    PangoFontDescription* pangoFD    = pango_font_description_new();
-    g_object_unref(context);
-
-    pango_font_description_set_family_static(pangoFD, FONTFAMILY.c_str());
-    pango_font_description_set_absolute_size(pangoFD, FONTSIZE * PANGO_SCALE);
-    pango_font_description_set_style(pangoFD, italic ? PANGO_STYLE_ITALIC : PANGO_STYLE_NORMAL);
-    pango_font_description_set_weight(pangoFD, sc<PangoWeight>(weight));
-    pango_layout_set_font_description(layoutText, pangoFD);
-    pango_layout_set_text(layoutText, text.c_str(), -1);
-
-    if (maxWidth > 0) {
-        pango_layout_set_width(layoutText, maxWidth * PANGO_SCALE);
-        pango_layout_set_ellipsize(layoutText, PANGO_ELLIPSIZE_END);
-    }
-
-    PangoRectangle rectInk = {}, rectLog = {};
-    pango_layout_get_pixel_extents(layoutText, &rectInk, &rectLog);
-    int  textW = std::max(rectLog.width, rectInk.x + rectInk.width);
-    int  textH = std::max(rectLog.height, rectInk.y + rectInk.height);
-
-    auto CAIROSURFACE = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, textW, textH);
-    auto CAIRO        = cairo_create(CAIROSURFACE);
-
-    cairo_set_source_rgba(CAIRO, COLOR.r, COLOR.g, COLOR.b, COLOR.a);
-    cairo_move_to(CAIRO, 0, 0);
-    pango_cairo_show_layout(CAIRO, layoutText);
-
-    pango_font_description_free(pangoFD);
-    g_object_unref(layoutText);
+    static auto FONT = CConfigValue<std::string>("misc:font_family");
+
+    const auto  SURFACE = rasterizeText(STextTextureKey{
+        .text     = text,
+        .font     = fontFamily.empty() ? *FONT : fontFamily,
+        .size     = pt,
+        .weight   = weight,
+        .italic   = italic,
+        .color    = col,
+        .maxWidth = maxWidth,
+    });
 
-    cairo_surface_flush(CAIROSURFACE);
-    auto tex = createTexture(CAIROSURFACE);
+    if (!SURFACE)
+        return nullptr;
 
-    cairo_destroy(CAIRO);
-    cairo_surface_destroy(CAIROSURFACE);
+    auto tex = createTexture(SURFACE);
+    cairo_surface_destroy(SURFACE);
 
     return tex;
 }
@@ -2060,9 +2033,9 @@ void IHyprRenderer::renderMirrored() {
     m_renderPass.add(makeUnique<CTexPassElement>(std::move(data)));
 }
 
-void IHyprRenderer::renderMonitor(PHLMONITOR pMonitor, bool commit) {
+bool IHyprRenderer::renderMonitor(PHLMONITOR pMonitor, bool commit) {
     if (!pMonitor)
-        return;
+        return false;
     static std::chrono::high_resolution_clock::time_point renderStart        = std::chrono::high_resolution_clock::now();
     static std::chrono::high_resolution_clock::time_point renderStartOverlay = std::chrono::high_resolution_clock::now();
     static std::chrono::high_resolution_clock::time_point endRenderOverlay   = std::chrono::high_resolution_clock::now();
@@ -2079,7 +2052,7 @@ void IHyprRenderer::renderMonitor(PHLMONITOR pMonitor, bool commit) {
 
     if (pMonitor->m_pixelSize.x < 1 || pMonitor->m_pixelSize.y < 1) {
         Log::logger->log(Log::ERR, "Refusing to render a monitor because of an invalid pixel size: {}", pMonitor->m_pixelSize);
-        return;
+        return false;
     }
 
     if (!*PDAMAGEBLINK)
@@ -2091,7 +2064,7 @@ void IHyprRenderer::renderMonitor(PHLMONITOR pMonitor, bool commit) {
     }
 
     if (!g_pCompositor->m_sessionActive)
-        return;
+        return false;
 
     Event::bus()->m_events.render.preChecks.emit(pMonitor);
 
@@ -2115,7 +2088,7 @@ void IHyprRenderer::renderMonitor(PHLMONITOR pMonitor, bool commit) {
     // needsFrame can be cleared by commits that didnt consume our damage like a
     // commit while a pageflip was in flight, so pending damage must keep the frame alive.
     if (!pMonitor->m_output->needsFrame && pMonitor->m_forceFullFrames == 0 && !pMonitor->m_damage.hasChanged())
-        return;
+        return false;
 
     // tearing and DS first
     bool       shouldTear              = pMonitor->updateTearing();
@@ -2131,7 +2104,7 @@ void IHyprRenderer::renderMonitor(PHLMONITOR pMonitor, bool commit) {
                 pMonitor->m_directScanoutIsActive = true;
             }
             handleFullscreenSettings(pMonitor);
-            return;
+            return true;
         } else if (!pMonitor->m_lastScanout.expired() || pMonitor->m_directScanoutIsActive)
             pMonitor->handleDSleave();
     }
@@ -2141,11 +2114,11 @@ void IHyprRenderer::renderMonitor(PHLMONITOR pMonitor, bool commit) {
     const auto NOW = Time::steadyNow();
 
     if (!shouldRenderMonitor(pMonitor) && damageBlinkCleanup == 0)
-        return;
+        return false;
 
     if (*PDAMAGETRACKINGMODE == -1) {
         Log::logger->log(Log::CRIT, "Damage tracking mode -1 ????");
-        return;
+        return false;
     }
 
     Event::bus()->m_events.render.stage.emit(RENDER_PRE);
@@ -2185,7 +2158,7 @@ void IHyprRenderer::renderMonitor(PHLMONITOR pMonitor, bool commit) {
     CRegion    damage, finalDamage;
     if (!beginRender(pMonitor, damage, RENDER_MODE_NORMAL)) {
         Log::logger->log(Log::ERR, "renderer: couldn't beginRender()!");
-        return;
+        return false;
     }
 
     // if we have no tracking or full tracking, invalidate the entire monitor
@@ -2301,8 +2274,9 @@ void IHyprRenderer::renderMonitor(PHLMONITOR pMonitor, bool commit) {
     if (pMonitor->m_output->state->state().presentationMode != presentationMode)
         pMonitor->m_output->state->setPresentationMode(presentationMode);
 
+    bool committed = true;
     if (commit)
-        commitPendingAndDoExplicitSync(pMonitor);
+        committed = commitPendingAndDoExplicitSync(pMonitor);
 
     // cleared only after the commit
     pMonitor->m_renderingActive = false;
@@ -2325,6 +2299,8 @@ void IHyprRenderer::renderMonitor(PHLMONITOR pMonitor, bool commit) {
         } else
             Debug::overlay()->renderDataNoOverlay(pMonitor, durationUs);
     }
+
+    return committed;
 }
 
 static const hdr_output_metadata NO_HDR_METADATA = {.hdmi_metadata_type1 = hdr_metadata_infoframe{.eotf = 0}};
@@ -2547,7 +2523,7 @@ bool IHyprRenderer::commitPendingAndDoExplicitSync(PHLMONITOR pMonitor) {
             // rollback the buffer to avoid writing to the front buffer that is being
             // displayed
             pMonitor->m_output->swapchain->rollback();
-            pMonitor->m_damage.damageEntire();
+            pMonitor->damageEntire();
         }
     }
 
@@ -3265,22 +3241,20 @@ SP<IFramebuffer> IHyprRenderer::makeSnapshotFB(WP<Desktop::View::CPopup> popup)
     renderdata.popup           = true;
     renderdata.blur            = false;
 
-    popup->wlSurface()->resource()->breadthfirst(
-        [this, &renderdata](SP<CWLSurfaceResource> s, const Vector2D& offset, void* data) {
-            if (!s->m_current.texture)
-                return;
+    popup->wlSurface()->resource()->breadthfirst([this, &renderdata](const SP<CWLSurfaceResource>& s, const Vector2D& offset) {
+        if (!s->m_current.texture)
+            return;
 
-            if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
-                return;
+        if (s->m_current.size.x < 1 || s->m_current.size.y < 1)
+            return;
 
-            renderdata.localPos    = offset;
-            renderdata.texture     = s->m_current.texture;
-            renderdata.surface     = s;
-            renderdata.mainSurface = false;
-            m_renderPass.add(makeUnique<CSurfacePassElement>(renderdata));
-            renderdata.surfaceCounter++;
-        },
-        nullptr);
+        renderdata.localPos    = offset;
+        renderdata.texture     = s->m_current.texture;
+        renderdata.surface     = s;
+        renderdata.mainSurface = false;
+        m_renderPass.add(makeUnique<CSurfacePassElement>(renderdata));
+        renderdata.surfaceCounter++;
+    });
 
     endRender();
 
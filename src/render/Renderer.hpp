@@ -35,6 +35,8 @@
 #include "desktop/view/Popup.hpp"
 #include "Framebuffer.hpp"
 #include "Texture.hpp"
+#include "ShmUpload.hpp"
+#include "TextTextureCache.hpp"
 
 #include <hyprgraphics/resource/resources/TextResource.hpp>
 
@@ -73,7 +75,7 @@ namespace Render {
         virtual eType                       type() = 0;
         WP<Render::GL::CHyprOpenGLImpl>     glBackend();
 
-        void                                renderMonitor(PHLMONITOR pMonitor, bool commit = true);
+        bool                                renderMonitor(PHLMONITOR pMonitor, bool commit = true); // false if no frame went out
         void                                arrangeLayersForMonitor(const MONITORID&);
         void                                damageSurface(SP<CWLSurfaceResource>, double, double, double scale = 1.0);
         void                                damageWindow(PHLWINDOW, bool forceFull = false);
@@ -114,6 +116,7 @@ namespace Render {
         bool                                m_bRenderingSnapshot    = false;
         PHLMONITORREF                       m_mostHzMonitor;
         bool                                m_directScanoutBlocked = false;
+        CTextTextureCache                   m_textTextures;
 
         void                                setSurfaceScanoutMode(SP<CWLSurfaceResource> surface, PHLMONITOR monitor); // nullptr monitor resets
 
@@ -176,6 +179,8 @@ namespace Render {
         virtual SP<ITexture>         createTexture(cairo_surface_t* cairo)                                                                                                     = 0;
         virtual SP<ITexture>         createTexture(std::span<const float> lut3D, size_t N)                                                                                     = 0;
         virtual SP<ITexture>         createTexture(const SP<Aquamarine::IBuffer> buffer, bool keepDataCopy = false);
+        virtual bool                 canUploadShmAsync();
+        virtual void                 uploadShmAsync(UP<SShmUploadJob>&& job); // job->onDone runs on the main thread, always
         virtual SP<ITexture>         renderText(const std::string& text, CHyprColor col, int pt, bool italic = false, const std::string& fontFamily = "", int maxWidth = 0,
                                                 int weight = 400);
         virtual SP<ITexture>         renderText(Hyprgraphics::CTextResource::STextResourceData&& data);
@@ -91,6 +91,8 @@ bool CShader::createProgram(const std::string& vert, const std::string& frag, bo
     auto prog = glCreateProgram();
     glAttachShader(prog, vertCompiled);
     glAttachShader(prog, fragCompiled);
+    // lets the shader cache store the linked program
+    glProgramParameteri(prog, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     glLinkProgram(prog);
 
     glDetachShader(prog, vertCompiled);
@@ -118,6 +120,45 @@ bool CShader::createProgram(const std::string& vert, const std::string& frag, bo
     return true;
 }
 
+// fails quietly if the driver rejects the binary, e.g. after a driver update
+bool CShader::createProgramFromBinary(const Render::SProgramBinary& binary) {
+    auto prog = glCreateProgram();
+    glProgramBinary(prog, binary.format, binary.data.data(), binary.data.size());
+
+    GLint ok;
+    glGetProgramiv(prog, GL_LINK_STATUS, &ok);
+    if (ok == GL_FALSE) {
+        glDeleteProgram(prog);
+        return false;
+    }
+
+    m_program = prog;
+
+    getUniformLocations();
+    createVao();
+    return true;
+}
+
+bool CShader::getProgramBinary(Render::SProgramBinary& binary) const {
+    if (!m_program)
+        return false;
+
+    GLint length = 0;
+    glGetProgramiv(m_program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return false;
+
+    GLenum format = 0;
+    binary.data.resize(length);
+    glGetProgramBinary(m_program, length, &length, &format, binary.data.data());
+    if (length <= 0)
+        return false;
+
+    binary.data.resize(length);
+    binary.format = format;
+    return true;
+}
+
 // its fine to call glGet on shaders that dont have the uniform
 // this however hardcodes the name now. #TODO maybe dont
 void CShader::getUniformLocations() {
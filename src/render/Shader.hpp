@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../defines.hpp"
+#include "ShaderCache.hpp"
 #include <array>
 #include <variant>
 
@@ -168,6 +169,8 @@ class CShader {
     ~CShader();
 
     bool   createProgram(const std::string& vert, const std::string& frag, bool dynamic = false, bool silent = false);
+    bool   createProgramFromBinary(const Render::SProgramBinary& binary);
+    bool   getProgramBinary(Render::SProgramBinary& binary) const;
     void   setUniformInt(eShaderUniform location, GLint v0);
     void   setUniformFloat(eShaderUniform location, GLfloat v0);
     void   setUniformFloat2(eShaderUniform location, GLfloat v0, GLfloat v1);
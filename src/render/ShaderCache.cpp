@@ -0,0 +1,191 @@
+#include "ShaderCache.hpp"
+#include "../debug/log/Logger.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+
+using namespace Render;
+
+static std::optional<std::string> readBinaryFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.good())
+        return std::nullopt;
+
+    return std::string((std::istreambuf_iterator<char>(file)), (std::istreambuf_iterator<char>()));
+}
+
+// write next to the target and rename, so a crash mid-write never leaves a truncated entry behind
+static void writeBinaryFile(const std::string& path, std::string_view content) {
+    const auto      TMP = path + ".tmp";
+
+    std::ofstream   file(TMP, std::ios::binary | std::ios::trunc);
+    std::error_code ec;
+
+    if (!file.good() || !file.write(content.data(), content.size())) {
+        Log::logger->log(Log::WARN, "CShaderCache: couldn't write {}", TMP);
+        std::filesystem::remove(TMP, ec);
+        return;
+    }
+
+    file.close();
+
+    std::filesystem::rename(TMP, path, ec);
+    if (ec)
+        Log::logger->log(Log::WARN, "CShaderCache: couldn't move {} into place: {}", TMP, ec.message());
+}
+
+CShaderCache::CShaderCache(const std::string& root, std::string_view driver) {
+    if (root.empty())
+        return;
+
+    const auto      DIR = std::format("{}shaders/{:016x}/", root, hash(driver));
+
+    std::error_code ec;
+    std::filesystem::create_directories(DIR, ec);
+    if (ec) {
+        Log::logger->log(Log::ERR, "CShaderCache: can't create {}, shaders will only be cached in memory: {}", DIR, ec.message());
+        return;
+    }
+
+    m_dir = DIR;
+    loadRecorded();
+
+    Log::logger->log(Log::DEBUG, "CShaderCache: using {} with {} recorded variants", m_dir, m_recorded.size());
+}
+
+uint64_t CShaderCache::hash(std::string_view data, uint64_t seed) {
+    // FNV-1a
+    uint64_t result = 0xcbf29ce484222325ULL ^ seed;
+    for (const unsigned char c : data) {
+        result ^= c;
+        result *= 0x100000001b3ULL;
+    }
+
+    return result;
+}
+
+std::string CShaderCache::pathFor(ePreparedFragmentShader frag, const SShaderVariant& variant, std::string_view extension) const {
+    return std::format("{}{}-{:x}-{}-{}.{}", m_dir, sc<int>(frag), variant.features, sc<int>(variant.sourceTF), sc<int>(variant.targetTF), extension);
+}
+
+std::optional<std::string> CShaderCache::source(ePreparedFragmentShader frag, const SShaderVariant& variant, uint64_t inputHash) {
+    std::optional<std::string> content;
+    if (!m_dir.empty())
+        content = readBinaryFile(pathFor(frag, variant, "glsl"));
+
+    // first line is the hash of the inputs the source was preprocessed from
+    const auto HEADER = std::format("{:016x}\n", inputHash);
+    if (!content || !content->starts_with(HEADER)) {
+        m_stats.sourceMisses++;
+        return std::nullopt;
+    }
+
+    m_stats.sourceHits++;
+    return content->substr(HEADER.size());
+}
+
+void CShaderCache::storeSource(ePreparedFragmentShader frag, const SShaderVariant& variant, uint64_t inputHash, const std::string& source) {
+    if (m_dir.empty())
+        return;
+
+    writeBinaryFile(pathFor(frag, variant, "glsl"), std::format("{:016x}\n{}", inputHash, source));
+}
+
+std::optional<SProgramBinary> CShaderCache::binary(ePreparedFragmentShader frag, const SShaderVariant& variant, uint64_t sourceHash) {
+    std::optional<std::string> content;
+    if (!m_dir.empty())
+        content = readBinaryFile(pathFor(frag, variant, "bin"));
+
+    // layout: source hash (8), binary format (4), program binary
+    constexpr size_t HEADER_SIZE = sizeof(uint64_t) + sizeof(uint32_t);
+
+    uint64_t         storedHash = 0;
+    if (content && content->size() > HEADER_SIZE)
+        std::memcpy(&storedHash, content->data(), sizeof(storedHash));
+
+    if (!content || content->size() <= HEADER_SIZE || storedHash != sourceHash) {
+        m_stats.binaryMisses++;
+        return std::nullopt;
+    }
+
+    SProgramBinary result;
+    std::memcpy(&result.format, content->data() + sizeof(uint64_t), sizeof(result.format));
+    result.data.assign(content->begin() + HEADER_SIZE, content->end());
+
+    m_stats.binaryHits++;
+    return result;
+}
+
+void CShaderCache::storeBinary(ePreparedFragmentShader frag, const SShaderVariant& variant, uint64_t sourceHash, const SProgramBinary& binary) {
+    if (m_dir.empty() || binary.data.empty())
+        return;
+
+    std::string content;
+    content.resize(sizeof(uint64_t) + sizeof(uint32_t) + binary.data.size());
+    std::memcpy(content.data(), &sourceHash, sizeof(sourceHash));
+    std::memcpy(content.data() + sizeof(uint64_t), &binary.format, sizeof(binary.format));
+    std::memcpy(content.data() + sizeof(uint64_t) + sizeof(uint32_t), binary.data.data(), binary.data.size());
+
+    writeBinaryFile(pathFor(frag, variant, "bin"), content);
+}
+
+const std::vector<SRecordedShaderVariant>& CShaderCache::recorded() const {
+    return m_recorded;
+}
+
+void CShaderCache::record(ePreparedFragmentShader frag, const SShaderVariant& variant) {
+    if (!m_recordedSet.emplace(frag, variant).second)
+        return;
+
+    m_recorded.emplace_back(SRecordedShaderVariant{.frag = frag, .variant = variant});
+
+    if (m_dir.empty())
+        return;
+
+    std::ofstream file(m_dir + "variants", std::ios::app);
+    if (file.good())
+        file << std::format("{} {} {} {}\n", sc<int>(frag), variant.features, sc<int>(variant.sourceTF), sc<int>(variant.targetTF));
+}
+
+void CShaderCache::loadRecorded() {
+    const auto CONTENT = readBinaryFile(m_dir + "variants");
+    if (!CONTENT)
+        return;
+
+    std::istringstream stream(*CONTENT);
+    std::string        line;
+    while (std::getline(stream, line)) {
+        std::istringstream lineStream(line);
+        int                frag = 0, features = 0, sourceTF = 0, targetTF = 0;
+
+        if (!(lineStream >> frag >> features >> sourceTF >> targetTF) || frag < 0 || frag >= SH_FRAG_LAST)
+            continue;
+
+        const SShaderVariant VARIANT = {
+            .features = sc<ShaderFeatureFlags>(features),
+            .sourceTF = sc<NColorManagement::eTransferFunction>(sourceTF),
+            .targetTF = sc<NColorManagement::eTransferFunction>(targetTF),
+        };
+
+        if (m_recordedSet.emplace(sc<uint8_t>(frag), VARIANT).second)
+            m_recorded.emplace_back(SRecordedShaderVariant{.frag = sc<ePreparedFragmentShader>(frag), .variant = VARIANT});
+    }
+}
+
+void CShaderCache::addCompileTime(float ms) {
+    m_stats.compiled++;
+    m_stats.compileMs += ms;
+    m_stats.longestCompile = std::max(m_stats.longestCompile, ms);
+}
+
+const std::string& CShaderCache::directory() const {
+    return m_dir;
+}
+
+SShaderCacheStats& CShaderCache::stats() {
+    return m_stats;
+}
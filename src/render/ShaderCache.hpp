@@ -0,0 +1,71 @@
+#pragma once
+
+#include "ShaderLoader.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Render {
+    struct SProgramBinary {
+        uint32_t             format = 0;
+        std::vector<uint8_t> data;
+    };
+
+    struct SRecordedShaderVariant {
+        ePreparedFragmentShader frag = SH_FRAG_QUAD;
+        SShaderVariant          variant;
+    };
+
+    struct SShaderCacheStats {
+        size_t sourceHits     = 0;
+        size_t sourceMisses   = 0;
+        size_t binaryHits     = 0;
+        size_t binaryMisses   = 0;
+        size_t binaryRejected = 0;
+        size_t compiled       = 0;
+        size_t prewarmed      = 0;
+        float  compileMs      = 0.F;
+        float  longestCompile = 0.F;
+    };
+
+    // On disk cache of preprocessed variant sources and linked program binaries.
+    // Entries live under <cache home>/shaders/<driver hash>/ and carry the hash of whatever produced them,
+    // so a changed shader file or include simply misses instead of returning something stale.
+    class CShaderCache {
+      public:
+        // an empty root keeps everything in memory, which is what tests and a missing cache home get
+        CShaderCache(const std::string& root, std::string_view driver);
+
+        std::optional<std::string>    source(ePreparedFragmentShader frag, const SShaderVariant& variant, uint64_t inputHash);
+        void                          storeSource(ePreparedFragmentShader frag, const SShaderVariant& variant, uint64_t inputHash, const std::string& source);
+
+        std::optional<SProgramBinary> binary(ePreparedFragmentShader frag, const SShaderVariant& variant, uint64_t sourceHash);
+        void                          storeBinary(ePreparedFragmentShader frag, const SShaderVariant& variant, uint64_t sourceHash, const SProgramBinary& binary);
+
+        // variants used by this or earlier sessions, in the order they were first needed
+        const std::vector<SRecordedShaderVariant>& recorded() const;
+        void                                       record(ePreparedFragmentShader frag, const SShaderVariant& variant);
+
+        void                                       addCompileTime(float ms);
+        const std::string&                         directory() const;
+        SShaderCacheStats&                         stats();
+
+        // stable across runs, unlike std::hash
+        static uint64_t hash(std::string_view data, uint64_t seed = 0);
+
+      private:
+        std::string                                  pathFor(ePreparedFragmentShader frag, const SShaderVariant& variant, std::string_view extension) const;
+        void                                         loadRecorded();
+
+        std::string                                  m_dir;
+        std::vector<SRecordedShaderVariant>          m_recorded;
+        std::set<std::pair<uint8_t, SShaderVariant>> m_recordedSet;
+        SShaderCacheStats                            m_stats;
+    };
+
+    inline UP<CShaderCache> g_pShaderCache;
+}
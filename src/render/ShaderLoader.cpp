@@ -1,4 +1,5 @@
 #include "ShaderLoader.hpp"
+#include "ShaderCache.hpp"
 #include <format>
 #include <hyprutils/memory/Casts.hpp>
 #include <hyprutils/memory/UniquePtr.hpp>
@@ -61,7 +62,9 @@ CShaderLoader::~CShaderLoader() {
 }
 
 void CShaderLoader::include(const std::string& filename) {
-    m_includes.insert({filename, loadShader(filename)});
+    const auto& [it, inserted] = m_includes.insert({filename, loadShader(filename)});
+    if (inserted)
+        m_includesHash = CShaderCache::hash(it->second, CShaderCache::hash(filename, m_includesHash));
 }
 
 std::string CShaderLoader::getDefines(const SShaderVariant& variant) {
@@ -164,9 +167,19 @@ std::string CShaderLoader::getVariantSource(ePreparedFragmentShader frag, SShade
 
     if (!m_fragVariants[frag].contains(variant)) {
         ASSERT(m_fragFiles[frag].length());
-        m_overrideDefines             = getDefines(variant);
-        m_fragVariants[frag][variant] = processSource(m_fragFiles[frag]);
-        m_overrideDefines             = "";
+        const auto DEFINES    = getDefines(variant);
+        const auto INPUT_HASH = CShaderCache::hash(m_fragFiles[frag], CShaderCache::hash(DEFINES, m_includesHash));
+
+        if (auto cached = g_pShaderCache ? g_pShaderCache->source(frag, variant, INPUT_HASH) : std::nullopt; cached)
+            m_fragVariants[frag][variant] = std::move(*cached);
+        else {
+            m_overrideDefines             = DEFINES;
+            m_fragVariants[frag][variant] = processSource(m_fragFiles[frag]);
+            m_overrideDefines             = "";
+
+            if (g_pShaderCache)
+                g_pShaderCache->storeSource(frag, variant, INPUT_HASH, m_fragVariants[frag][variant]);
+        }
     }
 
     return m_fragVariants[frag][variant];
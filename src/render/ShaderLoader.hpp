@@ -106,6 +106,7 @@ namespace Render {
         std::map<std::string, std::string>                              m_includes;
 
         std::string                                                     m_overrideDefines;
+        uint64_t                                                        m_includesHash = 0; // part of every variant's cache key
         glsl_include_callbacks_t                                        m_callbacks;
     };
 
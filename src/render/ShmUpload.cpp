@@ -0,0 +1,141 @@
+#include "ShmUpload.hpp"
+
+#include <hyprutils/memory/Casts.hpp>
+
+#include <algorithm>
+
+using namespace Render;
+using namespace Hyprutils::Memory;
+
+// past this, the pairwise search costs more than the uploads it saves
+constexpr size_t MAX_PAIRWISE_RECTS = 128;
+
+namespace {
+    struct SCluster {
+        double x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+        double damaged = 0; // area of the original rects in here, those never overlap
+
+        double area() const {
+            return (x2 - x1) * (y2 - y1);
+        }
+    };
+
+    SCluster join(const SCluster& a, const SCluster& b) {
+        return {
+            .x1      = std::min(a.x1, b.x1),
+            .y1      = std::min(a.y1, b.y1),
+            .x2      = std::max(a.x2, b.x2),
+            .y2      = std::max(a.y2, b.y2),
+            .damaged = a.damaged + b.damaged,
+        };
+    }
+
+    bool worthJoining(const SCluster& joined, double maxWaste) {
+        return joined.damaged >= joined.area() * (1.0 - maxWaste);
+    }
+}
+
+std::vector<CBox> Render::coalesceUploadRects(const CRegion& damage, double maxWaste) {
+    std::vector<SCluster> clusters;
+    damage.forEachRect([&clusters](const auto& rect) {
+        clusters.emplace_back(SCluster{.x1 = sc<double>(rect.x1), .y1 = sc<double>(rect.y1), .x2 = sc<double>(rect.x2), .y2 = sc<double>(rect.y2)});
+        clusters.back().damaged = clusters.back().area();
+    });
+
+    if (maxWaste > 0 && clusters.size() > 1) {
+        // rects come in y-x order, so neighbours in the list are usually neighbours on screen. One cheap pass over those first.
+        std::vector<SCluster> merged;
+        merged.reserve(clusters.size());
+        for (const auto& c : clusters) {
+            if (!merged.empty()) {
+                if (const auto JOINED = join(merged.back(), c); worthJoining(JOINED, maxWaste)) {
+                    merged.back() = JOINED;
+                    continue;
+                }
+            }
+
+            merged.emplace_back(c);
+        }
+        clusters = std::move(merged);
+
+        // then anything else that's close enough, until nothing changes
+        bool changed = clusters.size() <= MAX_PAIRWISE_RECTS;
+        while (changed) {
+            changed = false;
+            for (size_t i = 0; i < clusters.size(); ++i) {
+                for (size_t j = i + 1; j < clusters.size();) {
+                    const auto JOINED = join(clusters[i], clusters[j]);
+                    if (!worthJoining(JOINED, maxWaste)) {
+                        ++j;
+                        continue;
+                    }
+
+                    clusters[i] = JOINED;
+                    clusters.erase(clusters.begin() + j);
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    std::vector<CBox> result;
+    result.reserve(clusters.size());
+    for (const auto& c : clusters) {
+        result.emplace_back(c.x1, c.y1, c.x2 - c.x1, c.y2 - c.y1);
+    }
+
+    return result;
+}
+
+size_t Render::uploadBytes(std::span<const CBox> rects, uint32_t stride, double width) {
+    if (width <= 0)
+        return 0;
+
+    const double BYTESPERPIXEL = stride / width;
+
+    double       bytes = 0;
+    for (const auto& r : rects) {
+        bytes += r.w * r.h * BYTESPERPIXEL;
+    }
+
+    return sc<size_t>(bytes);
+}
+
+void SShmUploadStats::add(const SShmUploadStats& other) {
+    uploads += other.uploads;
+    offloaded += other.offloaded;
+    damageRects += other.damageRects;
+    rects += other.rects;
+    bytes += other.bytes;
+    ms += other.ms;
+}
+
+void CShmUploadStats::record(pid_t pid, const SShmUploadStats& sample) {
+    m_clients[pid].add(sample);
+}
+
+void CShmUploadStats::forget(pid_t pid) {
+    m_clients.erase(pid);
+}
+
+void CShmUploadStats::reset() {
+    m_clients.clear();
+}
+
+const std::map<pid_t, SShmUploadStats>& CShmUploadStats::clients() const {
+    return m_clients;
+}
+
+SShmUploadStats CShmUploadStats::total() const {
+    SShmUploadStats total;
+    for (const auto& [pid, stats] : m_clients) {
+        total.add(stats);
+    }
+
+    return total;
+}
+
+CShmUploadStats& Render::shmUploadStats() {
+    static CShmUploadStats stats;
+    return stats;
+}
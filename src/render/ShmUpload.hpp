@@ -0,0 +1,69 @@
+#pragma once
+
+#include "../helpers/math/Math.hpp"
+#include "../helpers/memory/Memory.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <span>
+#include <sys/types.h>
+#include <vector>
+
+class CSHMPool;
+
+namespace Render {
+    class ITexture;
+
+    // Merges damage rects into fewer, larger ones before they get uploaded to a texture.
+    // Two rects are merged when the undamaged area their bounding box adds stays under maxWaste
+    // of that box, so a handful of extra pixels is traded for one upload call less.
+    std::vector<CBox> coalesceUploadRects(const CRegion& damage, double maxWaste);
+
+    // bytes read from a buffer with the given stride and width to upload rects
+    size_t uploadBytes(std::span<const CBox> rects, uint32_t stride, double width);
+
+    // an upload of rects from an shm pool into a texture, done off the main thread
+    struct SShmUploadJob {
+        SP<ITexture>      texture;
+        SP<CSHMPool>      pool;
+        size_t            offset    = 0;
+        uint32_t          stride    = 0;
+        uint32_t          drmFormat = 0;
+        std::vector<CBox> rects;
+
+        // main thread, once the texture holds the new contents or the upload failed
+        std::function<void(const SShmUploadJob&)> onDone;
+
+        // set by the uploader
+        bool   ok = false;
+        double ms = 0;
+    };
+
+    struct SShmUploadStats {
+        uint64_t uploads     = 0; // texture updates
+        uint64_t offloaded   = 0; // of those, done on the upload thread
+        uint64_t damageRects = 0; // rects as damaged by the client
+        uint64_t rects       = 0; // rects actually uploaded, after merging
+        uint64_t bytes       = 0;
+        double   ms          = 0; // main thread time, or upload thread time for offloaded ones
+
+        void     add(const SShmUploadStats& other);
+    };
+
+    // per client totals, keyed by pid and dropped once the last client of a pid disconnects. Main thread only.
+    class CShmUploadStats {
+      public:
+        void                                    record(pid_t pid, const SShmUploadStats& sample);
+        void                                    forget(pid_t pid);
+        void                                    reset();
+
+        const std::map<pid_t, SShmUploadStats>& clients() const;
+        SShmUploadStats                         total() const;
+
+      private:
+        std::map<pid_t, SShmUploadStats> m_clients;
+    };
+
+    CShmUploadStats& shmUploadStats();
+}
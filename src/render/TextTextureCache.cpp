@@ -0,0 +1,225 @@
+#include "TextTextureCache.hpp"
+#include "AsyncResourceGatherer.hpp"
+#include "Renderer.hpp"
+#include "../helpers/MainLoopExecutor.hpp"
+#include "../managers/eventLoop/EventLoopManager.hpp"
+
+#include <algorithm>
+#include <hyprgraphics/resource/resources/AsyncResource.hpp>
+#include <pango/pangocairo.h>
+
+using namespace Render;
+
+namespace Render {
+    class CTextTextureResource : public Hyprgraphics::IAsyncResource {
+      public:
+        CTextTextureResource(const STextTextureKey& key) : m_key(key) {
+            ;
+        }
+
+        virtual ~CTextTextureResource() {
+            if (m_surface)
+                cairo_surface_destroy(m_surface);
+        }
+
+        // on the gatherer's thread
+        virtual void render() override {
+            m_surface = rasterizeText(m_key);
+        }
+
+        const STextTextureKey m_key;
+        cairo_surface_t*      m_surface = nullptr;
+    };
+}
+
+size_t STextTextureKeyHash::operator()(const STextTextureKey& key) const {
+    size_t     hash = 0;
+
+    const auto hashCombine = [&hash](const auto& value) { hash ^= std::hash<std::decay_t<decltype(value)>>{}(value) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2); };
+
+    hashCombine(key.text);
+    hashCombine(key.font);
+    hashCombine(key.size);
+    hashCombine(key.weight);
+    hashCombine(key.italic);
+    hashCombine(key.color.getAsHex());
+    hashCombine(key.maxWidth);
+
+    return hash;
+}
+
+CTextTextureCache::CTextTextureCache(size_t capacity) : m_capacity(std::max<size_t>(capacity, 1)) {
+    ;
+}
+
+CTextTextureCache::~CTextTextureCache() = default;
+
+SP<ITexture> CTextTextureCache::lookup(const STextTextureKey& key) {
+    const auto IT = m_entries.find(key);
+    if (IT == m_entries.end())
+        return nullptr;
+
+    m_lru.splice(m_lru.begin(), m_lru, IT->second.lru);
+    return IT->second.texture;
+}
+
+SP<ITexture> CTextTextureCache::get(const STextTextureKey& key, std::function<void()>&& onReady) {
+    if (auto tex = lookup(key)) {
+        m_stats.hits++;
+        return tex;
+    }
+
+    if (const auto IT = m_pending.find(key); IT != m_pending.end()) {
+        if (onReady)
+            IT->second.waiters.emplace_back(std::move(onReady));
+        return nullptr;
+    }
+
+    m_stats.misses++;
+
+    auto& pending    = m_pending[key];
+    pending.resource = makeAtomicShared<CTextTextureResource>(key);
+    if (onReady)
+        pending.waiters.emplace_back(std::move(onReady));
+
+    // owned by the listener, so it lives as long as the resource does
+    SP<CMainLoopExecutor> executor = makeShared<CMainLoopExecutor>([this, key] { onRasterized(key); });
+
+    pending.resource->m_events.finished.listenStatic([executor] {
+        // this is in the worker thread.
+        executor->signal();
+    });
+
+    g_pAsyncResourceGatherer->enqueue(pending.resource);
+
+    return nullptr;
+}
+
+SP<ITexture> CTextTextureCache::getNow(const STextTextureKey& key) {
+    if (auto tex = lookup(key)) {
+        m_stats.hits++;
+        return tex;
+    }
+
+    m_stats.misses++;
+
+    const auto SURFACE = rasterizeText(key);
+    if (!SURFACE)
+        return nullptr;
+
+    auto tex = g_pHyprRenderer->createTexture(SURFACE);
+    cairo_surface_destroy(SURFACE);
+
+    m_stats.rasterized++;
+    store(key, tex);
+    return tex;
+}
+
+void CTextTextureCache::onRasterized(const STextTextureKey& key) {
+    const auto IT = m_pending.find(key);
+    if (IT == m_pending.end())
+        return;
+
+    auto pending = std::move(IT->second);
+    m_pending.erase(IT);
+
+    // getNow() might've beaten us to it
+    if (pending.resource->m_surface && !peek(key)) {
+        store(key, g_pHyprRenderer->createTexture(pending.resource->m_surface));
+        m_stats.rasterized++;
+    }
+
+    for (auto& fn : pending.waiters) {
+        fn();
+    }
+
+    // dropping the resource drops the executor we're being called from, so do it once that's returned
+    pending.waiters.clear();
+    m_finished.emplace_back(std::move(pending));
+    if (m_finished.size() == 1)
+        g_pEventLoopManager->doLater([this] { m_finished.clear(); });
+}
+
+SP<ITexture> CTextTextureCache::peek(const STextTextureKey& key) const {
+    const auto IT = m_entries.find(key);
+    return IT == m_entries.end() ? nullptr : IT->second.texture;
+}
+
+void CTextTextureCache::store(const STextTextureKey& key, SP<ITexture> texture) {
+    if (const auto IT = m_entries.find(key); IT != m_entries.end()) {
+        IT->second.texture = texture;
+        m_lru.splice(m_lru.begin(), m_lru, IT->second.lru);
+        return;
+    }
+
+    m_lru.emplace_front(key);
+    m_entries.emplace(key, SEntry{.texture = texture, .lru = m_lru.begin()});
+
+    while (m_entries.size() > m_capacity) {
+        m_entries.erase(m_lru.back());
+        m_lru.pop_back();
+        m_stats.evictions++;
+    }
+}
+
+void CTextTextureCache::clear() {
+    m_entries.clear();
+    m_lru.clear();
+}
+
+size_t CTextTextureCache::size() const {
+    return m_entries.size();
+}
+
+size_t CTextTextureCache::pending() const {
+    return m_pending.size();
+}
+
+const STextTextureCacheStats& CTextTextureCache::stats() const {
+    return m_stats;
+}
+
+cairo_surface_t* Render::rasterizeText(const STextTextureKey& key) {
+    PangoFontMap*         fontMap    = pango_cairo_font_map_get_default();
+    PangoContext*         context    = pango_font_map_create_context(fontMap);
+    PangoLayout*          layoutText = pango_layout_new(context);
+    PangoFontDescription* pangoFD    = pango_font_description_new();
+    g_object_unref(context);
+
+    pango_font_description_set_family_static(pangoFD, key.font.c_str());
+    pango_font_description_set_absolute_size(pangoFD, key.size * PANGO_SCALE);
+    pango_font_description_set_style(pangoFD, key.italic ? PANGO_STYLE_ITALIC : PANGO_STYLE_NORMAL);
+    pango_font_description_set_weight(pangoFD, sc<PangoWeight>(key.weight));
+    pango_layout_set_font_description(layoutText, pangoFD);
+    pango_layout_set_text(layoutText, key.text.c_str(), -1);
+
+    if (key.maxWidth > 0) {
+        pango_layout_set_width(layoutText, key.maxWidth * PANGO_SCALE);
+        pango_layout_set_ellipsize(layoutText, PANGO_ELLIPSIZE_END);
+    }
+
+    PangoRectangle rectInk = {}, rectLog = {};
+    pango_layout_get_pixel_extents(layoutText, &rectInk, &rectLog);
+    int  textW = std::max(rectLog.width, rectInk.x + rectInk.width);
+    int  textH = std::max(rectLog.height, rectInk.y + rectInk.height);
+
+    auto CAIROSURFACE = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, textW, textH);
+    auto CAIRO        = cairo_create(CAIROSURFACE);
+
+    cairo_set_source_rgba(CAIRO, key.color.r, key.color.g, key.color.b, key.color.a);
+    cairo_move_to(CAIRO, 0, 0);
+    pango_cairo_show_layout(CAIRO, layoutText);
+
+    pango_font_description_free(pangoFD);
+    g_object_unref(layoutText);
+
+    cairo_surface_flush(CAIROSURFACE);
+    cairo_destroy(CAIRO);
+
+    if (cairo_surface_status(CAIROSURFACE) != CAIRO_STATUS_SUCCESS) {
+        cairo_surface_destroy(CAIROSURFACE);
+        return nullptr;
+    }
+
+    return CAIROSURFACE;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Texture.hpp"
+#include "../helpers/Color.hpp"
+#include "../helpers/memory/Memory.hpp"
+
+#include <cairo/cairo.h>
+#include <functional>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Render {
+    struct STextTextureKey {
+        std::string text;
+        std::string font;
+        int         size   = 0; // px, monitor scale included
+        int         weight = 400;
+        bool        italic = false;
+        CHyprColor  color;
+        int         maxWidth = 0; // px, monitor scale included. Longer text is ellipsized, 0 for no limit
+
+        bool        operator==(const STextTextureKey&) const = default;
+    };
+
+    struct STextTextureKeyHash {
+        size_t operator()(const STextTextureKey& key) const;
+    };
+
+    struct STextTextureCacheStats {
+        size_t hits       = 0;
+        size_t misses     = 0;
+        size_t evictions  = 0;
+        size_t rasterized = 0;
+    };
+
+    class CTextTextureResource;
+
+    // Textures of rendered text, shared by everything that draws some: group bars, notifications, overlays.
+    // Least recently used textures are dropped once there are more than the capacity.
+    class CTextTextureCache {
+      public:
+        CTextTextureCache(size_t capacity = 256);
+        ~CTextTextureCache();
+
+        // the texture if it's ready. Otherwise nullptr, and the text gets rasterized on the resource gatherer's thread,
+        // after which onReady runs on the main thread. Callers keep drawing whatever they had until then.
+        SP<ITexture> get(const STextTextureKey& key, std::function<void()>&& onReady = nullptr);
+
+        // like get(), but rasterizes on the spot instead of returning nullptr
+        SP<ITexture> getNow(const STextTextureKey& key);
+
+        // doesn't queue anything or count as a use
+        SP<ITexture>                  peek(const STextTextureKey& key) const;
+        void                          store(const STextTextureKey& key, SP<ITexture> texture);
+
+        void                          clear();
+        size_t                        size() const;
+        size_t                        pending() const;
+        const STextTextureCacheStats& stats() const;
+
+      private:
+        struct SEntry {
+            SP<ITexture>                         texture;
+            std::list<STextTextureKey>::iterator lru;
+        };
+
+        struct SPending {
+            ASP<CTextTextureResource>          resource;
+            std::vector<std::function<void()>> waiters;
+        };
+
+        SP<ITexture>                                                       lookup(const STextTextureKey& key);
+        void                                                               onRasterized(const STextTextureKey& key);
+
+        size_t                                                             m_capacity = 0;
+        std::list<STextTextureKey>                                         m_lru; // most recently used first
+        std::unordered_map<STextTextureKey, SEntry, STextTextureKeyHash>   m_entries;
+        std::unordered_map<STextTextureKey, SPending, STextTextureKeyHash> m_pending;
+        std::vector<SPending>                                              m_finished; // their executors may still be on the stack
+        STextTextureCacheStats                                             m_stats;
+    };
+
+    // lays out the key's text with pango into a new ARGB32 surface the caller owns. Doesn't touch GL, so it's fine off the main thread.
+    cairo_surface_t* rasterizeText(const STextTextureKey& key);
+}
@@ -27,9 +27,9 @@ namespace Render {
 
         virtual ~ITexture() = default;
 
-        virtual void                setTexParameter(GLenum pname, GLint param)                                          = 0;
-        virtual void                allocate(const Vector2D& size, uint32_t drmFormat = 0)                              = 0;
-        virtual void                update(uint32_t drmFormat, uint8_t* pixels, uint32_t stride, const CRegion& damage) = 0;
+        virtual void                setTexParameter(GLenum pname, GLint param)                                                   = 0;
+        virtual void                allocate(const Vector2D& size, uint32_t drmFormat = 0)                                       = 0;
+        virtual void                update(uint32_t drmFormat, uint8_t* pixels, uint32_t stride, std::span<const CBox> rects) = 0;
         virtual void                bind() {};
         virtual void                unbind() {};
         virtual bool                ok();
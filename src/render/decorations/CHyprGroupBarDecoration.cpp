@@ -25,7 +25,41 @@ static SP<ITexture> m_tGradientInactive;
 static SP<ITexture> m_tGradientLockedActive;
 static SP<ITexture> m_tGradientLockedInactive;
 
-constexpr int       BAR_TEXT_PAD = 2;
+// titles are ellipsized to a multiple of this, so resizing a group doesn't rasterize every title on every frame
+constexpr static int TITLE_WIDTH_STEP = 32;
+
+static STextTextureKey titleTextureKey(PHLWINDOW pWindow, bool active, bool locked, int maxWidth, float monitorScale) {
+    static auto      FALLBACKFONT             = CConfigValue<std::string>("misc:font_family");
+    static auto      PTITLEFONTFAMILY         = CConfigValue<std::string>("group:groupbar:font_family");
+    static auto      PTITLEFONTSIZE           = CConfigValue<Config::INTEGER>("group:groupbar:font_size");
+    static auto      PTEXTCOLORACTIVE         = CConfigValue<Config::INTEGER>("group:groupbar:text_color");
+    static auto      PTEXTCOLORINACTIVE       = CConfigValue<Config::INTEGER>("group:groupbar:text_color_inactive");
+    static auto      PTEXTCOLORLOCKEDACTIVE   = CConfigValue<Config::INTEGER>("group:groupbar:text_color_locked_active");
+    static auto      PTEXTCOLORLOCKEDINACTIVE = CConfigValue<Config::INTEGER>("group:groupbar:text_color_locked_inactive");
+
+    static auto      PTITLEFONTWEIGHTACTIVE   = CConfigValue<Config::IComplexConfigValue>("group:groupbar:font_weight_active");
+    static auto      PTITLEFONTWEIGHTINACTIVE = CConfigValue<Config::IComplexConfigValue>("group:groupbar:font_weight_inactive");
+
+    const auto       FONTWEIGHT = sc<Config::CFontWeightConfigValueData*>((active ? PTITLEFONTWEIGHTACTIVE : PTITLEFONTWEIGHTINACTIVE).ptr());
+
+    const CHyprColor COLORACTIVE   = CHyprColor(*PTEXTCOLORACTIVE);
+    const CHyprColor COLORINACTIVE = *PTEXTCOLORINACTIVE == -1 ? COLORACTIVE : CHyprColor(*PTEXTCOLORINACTIVE);
+    CHyprColor       color         = active ? COLORACTIVE : COLORINACTIVE;
+    if (locked) {
+        const auto LOCKEDCOLOR = active ? *PTEXTCOLORLOCKEDACTIVE : *PTEXTCOLORLOCKEDINACTIVE;
+        if (LOCKEDCOLOR != -1)
+            color = CHyprColor(LOCKEDCOLOR);
+    }
+
+    return STextTextureKey{
+        .text     = pWindow->metadata().title(),
+        .font     = *PTITLEFONTFAMILY != STRVAL_EMPTY ? *PTITLEFONTFAMILY : *FALLBACKFONT,
+        .size     = sc<int>(*PTITLEFONTSIZE * monitorScale),
+        .weight   = FONTWEIGHT->m_value,
+        .color    = color,
+        .maxWidth = maxWidth,
+    };
+}
 
 CHyprGroupBarDecoration::CHyprGroupBarDecoration(PHLWINDOW pWindow) : IHyprWindowDecoration(pWindow), m_window(pWindow) {
     static auto PENABLED   = CConfigValue<Config::INTEGER>("group:groupbar:enabled");
@@ -113,7 +147,6 @@ void CHyprGroupBarDecoration::draw(PHLMONITOR pMonitor, float const& a) {
         return;
 
     static auto PRENDERTITLES              = CConfigValue<Config::INTEGER>("group:groupbar:render_titles");
-    static auto PTITLEFONTSIZE             = CConfigValue<Config::INTEGER>("group:groupbar:font_size");
     static auto PHEIGHT                    = CConfigValue<Config::INTEGER>("group:groupbar:height");
     static auto PINDICATORGAP              = CConfigValue<Config::INTEGER>("group:groupbar:indicator_gap");
     static auto PINDICATORHEIGHT           = CConfigValue<Config::INTEGER>("group:groupbar:indicator_height");
@@ -155,6 +188,9 @@ void CHyprGroupBarDecoration::draw(PHLMONITOR pMonitor, float const& a) {
 
     bool  blur = *PBLUR != 0;
 
+    // rebuilt every frame, so members that left the group drop theirs
+    std::vector<STitleTexture> titleTextures;
+
     for (int i = 0; i < barsToDraw; ++i) {
         const auto WINDOWINDEX = *PSTACKED ? m_dwGroupMembers.size() - i - 1 : i;
 
@@ -233,33 +269,39 @@ void CHyprGroupBarDecoration::draw(PHLMONITOR pMonitor, float const& a) {
             }
 
             if (*PRENDERTITLES) {
-                CTitleTex* pTitleTex = textureFromTitle(m_dwGroupMembers[WINDOWINDEX]->metadata().title());
-
-                if (!pTitleTex)
-                    pTitleTex =
-                        m_titleTexs.titleTexs
-                            .emplace_back(makeUnique<CTitleTex>(
-                                m_dwGroupMembers[WINDOWINDEX].lock(),
-                                Vector2D{(m_barWidth - (*PTEXTPADDING * 2)) * pMonitor->m_scale, (*PTITLEFONTSIZE + 2L * BAR_TEXT_PAD) * pMonitor->m_scale}, pMonitor->m_scale))
-                            .get();
-
-                SP<ITexture> titleTex;
-                if (m_dwGroupMembers[WINDOWINDEX] == Desktop::focusState()->window())
-                    titleTex = GROUPLOCKED ? pTitleTex->m_texLockedActive : pTitleTex->m_texActive;
-                else
-                    titleTex = GROUPLOCKED ? pTitleTex->m_texLockedInactive : pTitleTex->m_texInactive;
-
-                rect.y += std::ceil(((rect.height - titleTex->m_size.y) / 2.0) - (*PTEXTOFFSET * pMonitor->m_scale));
-                rect.height = titleTex->m_size.y;
-                rect.width  = titleTex->m_size.x;
-                rect.x += std::round((((m_barWidth + *PTEXTPADDING) * pMonitor->m_scale) / 2.0) - ((titleTex->m_size.x + *PTEXTPADDING) / 2.0));
-                rect.round();
-
-                CTexPassElement::SRenderData data;
-                data.tex = titleTex;
-                data.box = rect;
-                data.a   = a;
-                g_pHyprRenderer->addPassElement(makeUnique<CTexPassElement>(std::move(data)));
+                const auto MEMBER   = m_dwGroupMembers[WINDOWINDEX].lock();
+                const int  AVAILABLE = sc<int>(((m_barWidth - (*PTEXTPADDING * 2)) * pMonitor->m_scale) - 2);
+                const int  MAXWIDTH  = AVAILABLE >= TITLE_WIDTH_STEP ? AVAILABLE / TITLE_WIDTH_STEP * TITLE_WIDTH_STEP : std::max(AVAILABLE, 1);
+                const auto KEY       = titleTextureKey(MEMBER, MEMBER == Desktop::focusState()->window(), GROUPLOCKED, MAXWIDTH, pMonitor->m_scale);
+                const auto BARBOX    = rect;
+
+                auto       titleTex = g_pHyprRenderer->m_textTextures.get(KEY, [window = m_window] {
+                    if (window)
+                        g_pHyprRenderer->damageWindow(window.lock());
+                });
+
+                // until the new one is rasterized, keep showing what we had. It may be wider than the bar is now, so keep it inside.
+                const bool STALE = !titleTex;
+                if (STALE)
+                    titleTex = lastTitleTexture(MEMBER);
+
+                titleTextures.emplace_back(STitleTexture{.window = MEMBER, .texture = titleTex});
+
+                if (titleTex) {
+                    rect.y += std::ceil(((rect.height - titleTex->m_size.y) / 2.0) - (*PTEXTOFFSET * pMonitor->m_scale));
+                    rect.height = titleTex->m_size.y;
+                    rect.width  = titleTex->m_size.x;
+                    rect.x += std::round((((m_barWidth + *PTEXTPADDING) * pMonitor->m_scale) / 2.0) - ((titleTex->m_size.x + *PTEXTPADDING) / 2.0));
+                    rect.round();
+
+                    CTexPassElement::SRenderData data;
+                    data.tex = titleTex;
+                    data.box = rect;
+                    data.a   = a;
+                    if (STALE)
+                        data.clipBox = BARBOX;
+                    g_pHyprRenderer->addPassElement(makeUnique<CTexPassElement>(std::move(data)));
+                }
             }
         }
 
@@ -269,53 +311,18 @@ void CHyprGroupBarDecoration::draw(PHLMONITOR pMonitor, float const& a) {
             xoff += *PINNERGAP + m_barWidth;
     }
 
-    if (*PRENDERTITLES)
-        invalidateTextures();
+    m_titleTextures = std::move(titleTextures);
 }
 
-CTitleTex* CHyprGroupBarDecoration::textureFromTitle(const std::string& title) {
-    for (auto const& tex : m_titleTexs.titleTexs) {
-        if (tex->m_content == title)
-            return tex.get();
+SP<ITexture> CHyprGroupBarDecoration::lastTitleTexture(PHLWINDOW window) const {
+    for (auto const& t : m_titleTextures) {
+        if (t.window == window)
+            return t.texture;
     }
 
     return nullptr;
 }
 
-void CHyprGroupBarDecoration::invalidateTextures() {
-    m_titleTexs.titleTexs.clear();
-}
-
-CTitleTex::CTitleTex(PHLWINDOW pWindow, const Vector2D& bufferSize, const float monitorScale) : m_content(pWindow->metadata().title()), m_windowOwner(pWindow) {
-    static auto      FALLBACKFONT             = CConfigValue<std::string>("misc:font_family");
-    static auto      PTITLEFONTFAMILY         = CConfigValue<std::string>("group:groupbar:font_family");
-    static auto      PTITLEFONTSIZE           = CConfigValue<Config::INTEGER>("group:groupbar:font_size");
-    static auto      PTEXTCOLORACTIVE         = CConfigValue<Config::INTEGER>("group:groupbar:text_color");
-    static auto      PTEXTCOLORINACTIVE       = CConfigValue<Config::INTEGER>("group:groupbar:text_color_inactive");
-    static auto      PTEXTCOLORLOCKEDACTIVE   = CConfigValue<Config::INTEGER>("group:groupbar:text_color_locked_active");
-    static auto      PTEXTCOLORLOCKEDINACTIVE = CConfigValue<Config::INTEGER>("group:groupbar:text_color_locked_inactive");
-
-    static auto      PTITLEFONTWEIGHTACTIVE   = CConfigValue<Config::IComplexConfigValue>("group:groupbar:font_weight_active");
-    static auto      PTITLEFONTWEIGHTINACTIVE = CConfigValue<Config::IComplexConfigValue>("group:groupbar:font_weight_inactive");
-
-    const auto       FONTWEIGHTACTIVE   = sc<Config::CFontWeightConfigValueData*>((PTITLEFONTWEIGHTACTIVE.ptr()));
-    const auto       FONTWEIGHTINACTIVE = sc<Config::CFontWeightConfigValueData*>((PTITLEFONTWEIGHTINACTIVE.ptr()));
-
-    const CHyprColor COLORACTIVE         = CHyprColor(*PTEXTCOLORACTIVE);
-    const CHyprColor COLORINACTIVE       = *PTEXTCOLORINACTIVE == -1 ? COLORACTIVE : CHyprColor(*PTEXTCOLORINACTIVE);
-    const CHyprColor COLORLOCKEDACTIVE   = *PTEXTCOLORLOCKEDACTIVE == -1 ? COLORACTIVE : CHyprColor(*PTEXTCOLORLOCKEDACTIVE);
-    const CHyprColor COLORLOCKEDINACTIVE = *PTEXTCOLORLOCKEDINACTIVE == -1 ? COLORINACTIVE : CHyprColor(*PTEXTCOLORLOCKEDINACTIVE);
-
-    const auto       FONTFAMILY = *PTITLEFONTFAMILY != STRVAL_EMPTY ? *PTITLEFONTFAMILY : *FALLBACKFONT;
-
-#define RENDER_TEXT(color, weight) g_pHyprRenderer->renderText(pWindow->metadata().title(), (color), *PTITLEFONTSIZE* monitorScale, false, FONTFAMILY, bufferSize.x - 2, (weight));
-    m_texActive         = RENDER_TEXT(COLORACTIVE, FONTWEIGHTACTIVE->m_value);
-    m_texInactive       = RENDER_TEXT(COLORINACTIVE, FONTWEIGHTINACTIVE->m_value);
-    m_texLockedActive   = RENDER_TEXT(COLORLOCKEDACTIVE, FONTWEIGHTACTIVE->m_value);
-    m_texLockedInactive = RENDER_TEXT(COLORLOCKEDINACTIVE, FONTWEIGHTINACTIVE->m_value);
-#undef RENDER_TEXT
-}
-
 static SP<ITexture> renderGradient(Config::CGradientValueData* grad) {
 
     if (!Desktop::focusState()->monitor())
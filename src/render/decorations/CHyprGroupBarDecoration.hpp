@@ -7,20 +7,6 @@
 #include <string>
 #include "../../helpers/memory/Memory.hpp"
 
-class CTitleTex {
-  public:
-    CTitleTex(PHLWINDOW pWindow, const Vector2D& bufferSize, const float monitorScale);
-    ~CTitleTex() = default;
-
-    SP<Render::ITexture> m_texActive;
-    SP<Render::ITexture> m_texInactive;
-    SP<Render::ITexture> m_texLockedActive;
-    SP<Render::ITexture> m_texLockedInactive;
-    std::string          m_content;
-
-    PHLWINDOWREF         m_windowOwner;
-};
-
 void refreshGroupBarGradients();
 
 class CHyprGroupBarDecoration : public IHyprWindowDecoration {
@@ -60,8 +46,7 @@ class CHyprGroupBarDecoration : public IHyprWindowDecoration {
 
     std::optional<bool>       m_bLastVisibilityStatus;
 
-    CTitleTex*                textureFromTitle(const std::string&);
-    void                      invalidateTextures();
+    SP<Render::ITexture>      lastTitleTexture(PHLWINDOW) const;
 
     CBox                      assignedBoxGlobal();
     bool                      visible();
@@ -71,8 +56,10 @@ class CHyprGroupBarDecoration : public IHyprWindowDecoration {
     bool                      onMouseButtonOnDeco(const Vector2D&, const IPointer::SButtonEvent&);
     bool                      onScrollOnDeco(const Vector2D&, const IPointer::SAxisEvent);
 
-    struct STitleTexs {
-        // STitleTexs*                            overriden = nullptr; // TODO: make shit shared in-group to decrease VRAM usage.
-        std::vector<UP<CTitleTex>> titleTexs;
-    } m_titleTexs;
+    // the title each member was last drawn with, shown while a changed one is being rasterized
+    struct STitleTexture {
+        PHLWINDOWREF         window;
+        SP<Render::ITexture> texture;
+    };
+    std::vector<STitleTexture> m_titleTextures;
 };
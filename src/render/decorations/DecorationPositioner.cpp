@@ -2,6 +2,7 @@
 #include "../../desktop/view/window/Window.hpp"
 #include "../../desktop/view/window/WindowPresentation.hpp"
 #include "../../layout/target/Target.hpp"
+#include "../../desktop/state/ViewState.hpp"
 #include "../../event/EventBus.hpp"
 
 CDecorationPositioner::CDecorationPositioner() {
@@ -124,6 +125,9 @@ void CDecorationPositioner::onWindowUpdate(PHLWINDOW pWindow) {
             return;
     }
 
+    // decoration extents are part of the window's hit box
+    Desktop::viewState()->invalidateHitIndex();
+
     if (m_needsSanitize)
         sanitizeDatas();
 
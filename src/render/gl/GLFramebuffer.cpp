@@ -5,6 +5,7 @@
 #include "../Framebuffer.hpp"
 #include <hyprgraphics/egl/Egl.hpp>
 #include <algorithm>
+#include <cstring>
 #include <limits>
 
 using namespace Hyprgraphics::Egl;
@@ -141,113 +142,143 @@ void CGLFramebuffer::release() {
         m_fb          = 0;
     }
 
+    if (m_pbo) {
+        glDeleteBuffers(1, &m_pbo);
+        m_pbo     = 0;
+        m_pboSize = 0;
+    }
+
+    m_readback.rects.clear();
+
     if (m_tex)
         m_tex.reset();
 
     m_size = Vector2D();
 }
 
-bool CGLFramebuffer::readPixels(CHLBufferReference buffer, uint32_t offsetX, uint32_t offsetY, uint32_t width, uint32_t height) {
-    auto shm = buffer->shm();
-    if (!shm.success) {
-        LOGM(Log::ERR, "Can't copy: buffer is not shm");
-        return false;
-    }
+namespace {
+    // where a rect of the framebuffer lands in an shm buffer
+    struct SShmRect {
+        uint8_t* dst         = nullptr; // first byte of the first row
+        size_t   strideBytes = 0;
+        size_t   rowBytes    = 0;
+    };
+}
+
+static std::optional<SShmRect> shmRectFor(CHLBufferReference& buffer, const SPixelFormat* format, uint32_t offsetX, uint32_t offsetY, uint32_t width, uint32_t height) {
+    const auto shm = buffer->shm();
 
     auto [pixelData, fmt, bufLen] = buffer->beginDataPtr(0); // no need for end, cuz it's shm
     if (!pixelData) {
         LOGM(Log::ERR, "Can't copy: failed to get shm data pointer");
-        return false;
-    }
-
-    const auto PFORMAT = getPixelFormatFromDRM(shm.format);
-    if (!PFORMAT) {
-        LOGM(Log::ERR, "Can't copy: failed to find a pixel format");
-        return false;
+        return std::nullopt;
     }
 
-    const auto fbWidth    = sc<uint32_t>(m_size.x);
-    const auto fbHeight   = sc<uint32_t>(m_size.y);
-    const auto readWidth  = width > 0 ? width : fbWidth;
-    const auto readHeight = height > 0 ? height : fbHeight;
-
-    if (readWidth == 0 || readHeight == 0 || shm.stride <= 0) {
+    if (width == 0 || height == 0 || shm.stride <= 0) {
         LOGM(Log::ERR, "Can't copy: invalid shm read dimensions");
-        return false;
-    }
-
-    if (offsetX > fbWidth || offsetY > fbHeight || readWidth > fbWidth - offsetX || readHeight > fbHeight - offsetY) {
-        LOGM(Log::ERR, "Can't copy: read rect exceeds framebuffer");
-        return false;
+        return std::nullopt;
     }
 
     const auto shmWidth  = sc<uint32_t>(shm.size.x);
     const auto shmHeight = sc<uint32_t>(shm.size.y);
-    if (offsetX > shmWidth || offsetY > shmHeight || readWidth > shmWidth - offsetX || readHeight > shmHeight - offsetY) {
+    if (offsetX > shmWidth || offsetY > shmHeight || width > shmWidth - offsetX || height > shmHeight - offsetY) {
         LOGM(Log::ERR, "Can't copy: read rect exceeds shm buffer");
-        return false;
+        return std::nullopt;
     }
 
     const auto strideBytes = sc<size_t>(shm.stride);
-    const auto rowOffset   = sc<size_t>(minStride(PFORMAT, offsetX));
-    const auto rowBytes    = sc<size_t>(minStride(PFORMAT, readWidth));
+    const auto rowOffset   = sc<size_t>(minStride(format, offsetX));
+    const auto rowBytes    = sc<size_t>(minStride(format, width));
 
     if (rowBytes == 0) {
         LOGM(Log::ERR, "Can't copy: invalid shm row size");
-        return false;
+        return std::nullopt;
     }
 
     if (rowOffset > std::numeric_limits<size_t>::max() - rowBytes || rowOffset + rowBytes > strideBytes) {
         LOGM(Log::ERR, "Can't copy: shm stride is too small");
-        return false;
+        return std::nullopt;
     }
 
-    const auto lastRow = sc<size_t>(offsetY) + sc<size_t>(readHeight) - 1;
+    const auto lastRow = sc<size_t>(offsetY) + sc<size_t>(height) - 1;
     if (strideBytes > 0 && lastRow > std::numeric_limits<size_t>::max() / strideBytes) {
         LOGM(Log::ERR, "Can't copy: shm row offset overflows");
-        return false;
+        return std::nullopt;
     }
 
     const auto lastRowStart = lastRow * strideBytes;
     const auto rowEnd       = rowOffset + rowBytes;
     if (lastRowStart > std::numeric_limits<size_t>::max() - rowEnd || lastRowStart + rowEnd > bufLen) {
         LOGM(Log::ERR, "Can't copy: shm buffer is too small");
+        return std::nullopt;
+    }
+
+    return SShmRect{.dst = pixelData + sc<size_t>(offsetY) * strideBytes + rowOffset, .strideBytes = strideBytes, .rowBytes = rowBytes};
+}
+
+static GLenum readFormatFor(const SPixelFormat* format) {
+    static auto stripSwizzleAlpha = [](std::array<GLint, 4> arr) {
+        arr[3] = GL_ONE;
+        return arr;
+    };
+
+    if (format->swizzle.has_value()) {
+        if (stripSwizzleAlpha(*format->swizzle) == stripSwizzleAlpha(SWIZZLE_RGBA))
+            return GL_RGBA;
+        if (stripSwizzleAlpha(*format->swizzle) == stripSwizzleAlpha(SWIZZLE_BGRA))
+            return GL_BGRA_EXT;
+
+        LOGM(Log::ERR, "Copied frame via shm might be broken or color flipped");
+        return GL_RGBA;
+    }
+
+    if (format->glFormat == GL_RGBA)
+        return GL_BGRA_EXT;
+
+    return format->glFormat;
+}
+
+bool CGLFramebuffer::readPixels(CHLBufferReference buffer, uint32_t offsetX, uint32_t offsetY, uint32_t width, uint32_t height) {
+    auto shm = buffer->shm();
+    if (!shm.success) {
+        LOGM(Log::ERR, "Can't copy: buffer is not shm");
+        return false;
+    }
+
+    const auto PFORMAT = getPixelFormatFromDRM(shm.format);
+    if (!PFORMAT) {
+        LOGM(Log::ERR, "Can't copy: failed to find a pixel format");
+        return false;
+    }
+
+    const auto fbWidth    = sc<uint32_t>(m_size.x);
+    const auto fbHeight   = sc<uint32_t>(m_size.y);
+    const auto readWidth  = width > 0 ? width : fbWidth;
+    const auto readHeight = height > 0 ? height : fbHeight;
+
+    if (offsetX > fbWidth || offsetY > fbHeight || readWidth > fbWidth - offsetX || readHeight > fbHeight - offsetY) {
+        LOGM(Log::ERR, "Can't copy: read rect exceeds framebuffer");
         return false;
     }
 
+    const auto RECT = shmRectFor(buffer, PFORMAT, offsetX, offsetY, readWidth, readHeight);
+    if (!RECT)
+        return false;
+
     g_pHyprOpenGL->makeEGLCurrent();
     g_pHyprOpenGL->bindFramebuffer(GL_READ_FRAMEBUFFER, getFBID());
     bind();
 
     glPixelStorei(GL_PACK_ALIGNMENT, 1);
 
-    int         glFormat = PFORMAT->glFormat;
+    const auto GLFORMAT = readFormatFor(PFORMAT);
 
-    static auto stripSwizzleAlpha = [](std::array<GLint, 4> arr) {
-        arr[3] = GL_ONE;
-        return arr;
-    };
-
-    if (PFORMAT->swizzle.has_value()) {
-        if (stripSwizzleAlpha(*PFORMAT->swizzle) == stripSwizzleAlpha(SWIZZLE_RGBA))
-            glFormat = GL_RGBA;
-        else if (stripSwizzleAlpha(*PFORMAT->swizzle) == stripSwizzleAlpha(SWIZZLE_BGRA))
-            glFormat = GL_BGRA_EXT;
-        else {
-            LOGM(Log::ERR, "Copied frame via shm might be broken or color flipped");
-            glFormat = GL_RGBA;
-        }
-    } else if (glFormat == GL_RGBA)
-        glFormat = GL_BGRA_EXT;
-
-    // This could be optimized by using a pixel buffer object to make this async,
-    // but really clients should just use a dma buffer anyways.
-    if (rowOffset == 0 && rowBytes == strideBytes) {
-        glReadPixels(offsetX, offsetY, readWidth, readHeight, glFormat, PFORMAT->glType, pixelData + sc<size_t>(offsetY) * strideBytes);
-    } else {
+    // synchronous, see queueReadback() for the path that doesn't stall on the gpu
+    if (RECT->rowBytes == RECT->strideBytes)
+        glReadPixels(offsetX, offsetY, readWidth, readHeight, GLFORMAT, PFORMAT->glType, RECT->dst);
+    else {
         for (uint32_t i = 0; i < readHeight; ++i) {
-            const auto y = offsetY + i;
-            glReadPixels(offsetX, y, readWidth, 1, glFormat, PFORMAT->glType, pixelData + sc<size_t>(y) * strideBytes + rowOffset);
+            glReadPixels(offsetX, offsetY + i, readWidth, 1, GLFORMAT, PFORMAT->glType, RECT->dst + sc<size_t>(i) * RECT->strideBytes);
         }
     }
 
@@ -258,6 +289,109 @@ bool CGLFramebuffer::readPixels(CHLBufferReference buffer, uint32_t offsetX, uin
     return true;
 }
 
+bool CGLFramebuffer::queueReadback(const CRegion& region, DRMFormat format) {
+    const auto PFORMAT = getPixelFormatFromDRM(format);
+    if (!PFORMAT || !m_fbAllocated)
+        return false;
+
+    m_readback.rects.clear();
+    m_readback.format = format;
+    m_readback.size   = 0;
+
+    bool fits = true;
+    region.forEachRect([&](const auto& rect) {
+        if (rect.x1 < 0 || rect.y1 < 0 || rect.x2 > m_size.x || rect.y2 > m_size.y) {
+            fits = false;
+            return;
+        }
+
+        const auto W = sc<uint32_t>(rect.x2 - rect.x1);
+        const auto H = sc<uint32_t>(rect.y2 - rect.y1);
+        if (W == 0 || H == 0)
+            return;
+
+        m_readback.rects.emplace_back(SReadbackRect{.x = sc<uint32_t>(rect.x1), .y = sc<uint32_t>(rect.y1), .w = W, .h = H, .offset = m_readback.size});
+        m_readback.size += sc<size_t>(minStride(PFORMAT, W)) * H;
+    });
+
+    if (!fits || m_readback.rects.empty()) {
+        m_readback.rects.clear();
+        return false;
+    }
+
+    g_pHyprOpenGL->makeEGLCurrent();
+
+    if (!m_pbo)
+        glGenBuffers(1, &m_pbo);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbo);
+    if (m_pboSize < m_readback.size) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, m_readback.size, nullptr, GL_STREAM_READ);
+        m_pboSize = m_readback.size;
+    }
+
+    g_pHyprOpenGL->bindFramebuffer(GL_READ_FRAMEBUFFER, getFBID());
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+    // with a pack buffer bound the pointer is an offset into it, and the copy is queued instead of waited on
+    const auto GLFORMAT = readFormatFor(PFORMAT);
+    for (const auto& r : m_readback.rects) {
+        glReadPixels(r.x, r.y, r.w, r.h, GLFORMAT, PFORMAT->glType, rc<void*>(r.offset));
+    }
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    g_pHyprOpenGL->bindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+    return true;
+}
+
+bool CGLFramebuffer::finishReadback(CHLBufferReference buffer) {
+    if (m_readback.rects.empty())
+        return false;
+
+    auto shm = buffer->shm();
+    if (!shm.success || shm.format != m_readback.format) {
+        LOGM(Log::ERR, "Can't copy: readback doesn't match the shm buffer");
+        m_readback.rects.clear();
+        return false;
+    }
+
+    const auto PFORMAT = getPixelFormatFromDRM(m_readback.format);
+
+    g_pHyprOpenGL->makeEGLCurrent();
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbo);
+
+    const auto* mapped = sc<const uint8_t*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, m_readback.size, GL_MAP_READ_BIT));
+    bool        ok     = mapped != nullptr;
+
+    if (!mapped)
+        LOGM(Log::ERR, "Can't copy: failed to map the readback buffer");
+
+    for (const auto& r : m_readback.rects) {
+        if (!ok)
+            break;
+
+        const auto RECT = shmRectFor(buffer, PFORMAT, r.x, r.y, r.w, r.h);
+        if (!RECT) {
+            ok = false;
+            break;
+        }
+
+        for (uint32_t i = 0; i < r.h; ++i) {
+            std::memcpy(RECT->dst + sc<size_t>(i) * RECT->strideBytes, mapped + r.offset + sc<size_t>(i) * RECT->rowBytes, RECT->rowBytes);
+        }
+    }
+
+    if (mapped)
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    m_readback.rects.clear();
+
+    return ok;
+}
+
 CGLFramebuffer::~CGLFramebuffer() {
     release();
 }
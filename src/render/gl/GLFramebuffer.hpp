@@ -15,6 +15,8 @@ namespace Render::GL {
         void   addStencil(SP<ITexture> tex) override;
         void   release() override;
         bool   readPixels(CHLBufferReference buffer, uint32_t offsetX = 0, uint32_t offsetY = 0, uint32_t width = 0, uint32_t height = 0) override;
+        bool   queueReadback(const CRegion& region, DRMFormat format) override;
+        bool   finishReadback(CHLBufferReference buffer) override;
 
         void   bind() override;
         void   unbind();
@@ -32,6 +34,21 @@ namespace Render::GL {
         bool   m_tempBuf = false;
         bool   m_cleared = false;
 
+        // pixel pack buffer for queueReadback(), grows to the largest readback seen
+        GLuint m_pbo     = 0;
+        size_t m_pboSize = 0;
+
+        struct SReadbackRect {
+            uint32_t x, y, w, h;
+            size_t   offset; // into m_pbo, rows are tightly packed
+        };
+
+        struct {
+            std::vector<SReadbackRect> rects;
+            size_t                     size   = 0;
+            DRMFormat                  format = DRM_FORMAT_INVALID;
+        } m_readback;
+
         friend class CGLRenderbuffer;
     };
 }
@@ -120,8 +120,8 @@ CGLTexture::CGLTexture(std::span<const float> lut3D, size_t N) : ITexture(lut3D,
     unbind();
 }
 
-void CGLTexture::update(uint32_t drmFormat, uint8_t* pixels, uint32_t stride, const CRegion& damage) {
-    if (damage.empty())
+void CGLTexture::update(uint32_t drmFormat, uint8_t* pixels, uint32_t stride, std::span<const CBox> rects) {
+    if (rects.empty())
         return;
 
     g_pHyprOpenGL->makeEGLCurrent();
@@ -143,14 +143,15 @@ void CGLTexture::update(uint32_t drmFormat, uint8_t* pixels, uint32_t stride, co
 
     GLCALL(glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, stride / format->bytesPerBlock));
 
-    damage.copy().intersect(CBox{{}, m_size}).forEachRect([&format, &pixels](const auto& rect) {
-        GLCALL(glPixelStorei(GL_UNPACK_SKIP_PIXELS_EXT, rect.x1));
-        GLCALL(glPixelStorei(GL_UNPACK_SKIP_ROWS_EXT, rect.y1));
+    for (const auto& r : rects) {
+        const auto RECT = r.intersection({{}, m_size});
+        if (RECT.empty())
+            continue;
 
-        int width  = rect.x2 - rect.x1;
-        int height = rect.y2 - rect.y1;
-        GLCALL(glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x1, rect.y1, width, height, format->glFormat, format->glType, pixels));
-    });
+        GLCALL(glPixelStorei(GL_UNPACK_SKIP_PIXELS_EXT, RECT.x));
+        GLCALL(glPixelStorei(GL_UNPACK_SKIP_ROWS_EXT, RECT.y));
+        GLCALL(glTexSubImage2D(GL_TEXTURE_2D, 0, RECT.x, RECT.y, RECT.w, RECT.h, format->glFormat, format->glType, pixels));
+    }
 
     if (alignmentChanged)
         GLCALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
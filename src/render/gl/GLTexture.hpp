@@ -22,7 +22,7 @@ namespace Render::GL {
         ~CGLTexture();
 
         void allocate(const Vector2D& size, uint32_t drmFormat = 0) override;
-        void update(uint32_t drmFormat, uint8_t* pixels, uint32_t stride, const CRegion& damage) override;
+        void update(uint32_t drmFormat, uint8_t* pixels, uint32_t stride, std::span<const CBox> rects) override;
         void bind() override;
         void unbind() override;
         void setTexParameter(GLenum pname, GLint param) override;
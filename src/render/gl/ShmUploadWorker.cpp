@@ -0,0 +1,242 @@
+#include "ShmUploadWorker.hpp"
+#include "../../Compositor.hpp"
+#include "../../protocols/core/Shm.hpp"
+#include "../OpenGL.hpp"
+#include <GLES3/gl32.h>
+#include <GLES2/gl2ext.h>
+#include <algorithm>
+#include <chrono>
+#include <hyprgraphics/egl/Egl.hpp>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <wayland-server-core.h>
+
+using namespace Hyprgraphics::Egl;
+using namespace Hyprutils::OS;
+using namespace Render::GL;
+
+static int onWorkerSignal(int fd, uint32_t mask, void* data) {
+    eventfd_t value = 0;
+    eventfd_read(fd, &value);
+
+    sc<CShmUploadWorker*>(data)->onSignal();
+    return 0;
+}
+
+CShmUploadWorker::CShmUploadWorker(EGLDisplay display, EGLContext context) : m_display(display), m_context(context) {
+    if (m_context == EGL_NO_CONTEXT)
+        return;
+
+    m_createSync  = rc<PFNEGLCREATESYNCKHRPROC>(eglGetProcAddress("eglCreateSyncKHR"));
+    m_destroySync = rc<PFNEGLDESTROYSYNCKHRPROC>(eglGetProcAddress("eglDestroySyncKHR"));
+    m_waitSync    = rc<PFNEGLWAITSYNCKHRPROC>(eglGetProcAddress("eglWaitSyncKHR"));
+    if (!m_createSync || !m_destroySync || !m_waitSync) {
+        Log::logger->log(Log::ERR, "CShmUploadWorker: EGL fences are not supported, uploading on the main thread");
+        return;
+    }
+
+    m_eventFd = CFileDescriptor{eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)};
+    if (!m_eventFd.isValid()) {
+        Log::logger->log(Log::ERR, "CShmUploadWorker: failed to create an eventfd, uploading on the main thread");
+        return;
+    }
+
+    m_eventSource = wl_event_loop_add_fd(wl_display_get_event_loop(g_pCompositor->m_wlDisplay), m_eventFd.get(), WL_EVENT_READABLE, ::onWorkerSignal, this);
+    m_thread      = std::thread([this] { threadMain(); });
+
+    Log::logger->log(Log::DEBUG, "CShmUploadWorker: started");
+}
+
+CShmUploadWorker::~CShmUploadWorker() {
+    if (m_thread.joinable()) {
+        {
+            std::lock_guard lk(m_mutex);
+            m_exit = true;
+        }
+
+        m_cv.notify_all();
+        m_thread.join();
+    }
+
+    for (auto& queued : m_queued) {
+        destroyFence(queued.mainDone);
+    }
+
+    for (auto& queued : m_done) {
+        destroyFence(queued.uploadDone);
+    }
+
+    if (m_eventSource)
+        wl_event_source_remove(m_eventSource);
+
+    if (m_context != EGL_NO_CONTEXT)
+        eglDestroyContext(m_display, m_context);
+}
+
+bool CShmUploadWorker::ok() const {
+    return m_thread.joinable();
+}
+
+// flushed right away, so the other context never waits on commands that were never submitted.
+// Without a fence, waits for the gpu on the spot instead.
+EGLSyncKHR CShmUploadWorker::fence() {
+    const auto SYNC = m_createSync(m_display, EGL_SYNC_FENCE_KHR, nullptr);
+
+    if (SYNC == EGL_NO_SYNC_KHR)
+        glFinish();
+    else
+        glFlush();
+
+    return SYNC;
+}
+
+void CShmUploadWorker::destroyFence(EGLSyncKHR& sync) {
+    if (sync == EGL_NO_SYNC_KHR)
+        return;
+
+    m_destroySync(m_display, sync);
+    sync = EGL_NO_SYNC_KHR;
+}
+
+void CShmUploadWorker::queue(UP<SShmUploadJob>&& job) {
+    // the texture may have just been allocated, or been the shown one until the last commit with frames still sampling it.
+    // The worker doesn't write to it before the main context is done with all of that.
+    g_pHyprOpenGL->makeEGLCurrent();
+
+    SQueued queued = {.texID = job->texture->m_texID, .size = job->texture->m_size, .mainDone = fence()};
+    queued.job     = m_jobs.emplace_back(std::move(job)).get();
+
+    {
+        std::lock_guard lk(m_mutex);
+        m_queued.emplace_back(queued);
+    }
+
+    m_cv.notify_one();
+}
+
+void CShmUploadWorker::onSignal() {
+    std::vector<SQueued> done;
+
+    {
+        std::lock_guard lk(m_mutex);
+        done.swap(m_done);
+    }
+
+    for (auto& queued : done) {
+        // anything the main context does with the texture from here on waits for the upload, on the gpu
+        bool uploaded = true;
+        if (queued.uploadDone != EGL_NO_SYNC_KHR) {
+            g_pHyprOpenGL->makeEGLCurrent();
+            uploaded = m_waitSync(m_display, queued.uploadDone, 0) == EGL_TRUE;
+            destroyFence(queued.uploadDone);
+        }
+
+        const auto IT = std::ranges::find_if(m_jobs, [job = queued.job](const auto& other) { return other.get() == job; });
+        if (IT == m_jobs.end())
+            continue;
+
+        // callbacks may queue new jobs, so take this one out first
+        auto owned = std::move(*IT);
+        m_jobs.erase(IT);
+
+        owned->ok = owned->ok && uploaded;
+
+        if (owned->onDone)
+            owned->onDone(*owned);
+    }
+}
+
+void CShmUploadWorker::threadMain() {
+    // without a current context every job comes back failed, their surfaces upload on the main thread instead
+    const bool CURRENT = eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_context) == EGL_TRUE;
+
+    while (true) {
+        SQueued queued;
+
+        {
+            std::unique_lock lk(m_mutex);
+            m_cv.wait(lk, [this] { return m_exit || !m_queued.empty(); });
+
+            if (m_exit)
+                break;
+
+            queued = m_queued.front();
+            m_queued.pop_front();
+        }
+
+        if (CURRENT)
+            upload(queued);
+        else
+            destroyFence(queued.mainDone);
+
+        {
+            std::lock_guard lk(m_mutex);
+            m_done.emplace_back(queued);
+        }
+
+        eventfd_write(m_eventFd.get(), 1);
+    }
+
+    if (CURRENT)
+        eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+    eglReleaseThread();
+}
+
+// no GLCALL or logging in here, neither is safe off the main thread
+void CShmUploadWorker::upload(SQueued& queued) {
+    auto&      job    = *queued.job;
+    const auto BEGIN  = std::chrono::steady_clock::now();
+    const auto FORMAT = getPixelFormatFromDRM(job.drmFormat);
+
+    bool       waited = true;
+    if (queued.mainDone != EGL_NO_SYNC_KHR) {
+        waited = m_waitSync(m_display, queued.mainDone, 0) == EGL_TRUE;
+        destroyFence(queued.mainDone);
+    }
+
+    if (!waited || !FORMAT || !job.pool || !queued.texID)
+        return;
+
+    glBindTexture(GL_TEXTURE_2D, queued.texID);
+
+    if (FORMAT->bytesPerBlock != 4)
+        glPixelStorei(GL_UNPACK_ALIGNMENT, job.stride % 4 == 0 ? 4 : 1);
+
+    glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, job.stride / FORMAT->bytesPerBlock);
+
+    bool mapped = false;
+
+    {
+        std::lock_guard lk(job.pool->m_mapMutex);
+
+        // a failed remap leaves the pool without any mapping
+        mapped = job.pool->m_data != MAP_FAILED && job.offset + sc<size_t>(job.stride) * sc<size_t>(queued.size.y) <= job.pool->m_size;
+
+        if (mapped) {
+            const auto* const PIXELS = sc<const uint8_t*>(job.pool->m_data) + job.offset;
+
+            for (const auto& r : job.rects) {
+                const auto RECT = r.intersection({{}, queued.size});
+                if (RECT.empty())
+                    continue;
+
+                glPixelStorei(GL_UNPACK_SKIP_PIXELS_EXT, RECT.x);
+                glPixelStorei(GL_UNPACK_SKIP_ROWS_EXT, RECT.y);
+                glTexSubImage2D(GL_TEXTURE_2D, 0, RECT.x, RECT.y, RECT.w, RECT.h, FORMAT->glFormat, FORMAT->glType, PIXELS);
+            }
+        }
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH_EXT, 0);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS_EXT, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS_EXT, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    job.ok = mapped && glGetError() == GL_NO_ERROR;
+    job.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - BEGIN).count();
+
+    // the main context waits on this before the texture gets shown
+    queued.uploadDone = fence();
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../../defines.hpp"
+#include "../ShmUpload.hpp"
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <hyprutils/os/FileDescriptor.hpp>
+
+struct wl_event_source;
+
+namespace Render::GL {
+    // Uploads damaged parts of shm buffers into textures on a separate thread, through an EGL context
+    // shared with the renderer's. Jobs are owned by the main thread from queue() until their callback ran,
+    // the worker only reads plain data out of them, so no SP is ever copied or dropped off the main thread.
+    // Each direction is fenced: the worker waits for whatever the main context queued on the texture before it,
+    // and the main context waits for the upload before the callback gets to show the texture.
+    class CShmUploadWorker {
+      public:
+        // takes ownership of the context
+        CShmUploadWorker(EGLDisplay display, EGLContext context);
+        ~CShmUploadWorker();
+
+        bool ok() const;
+        void queue(UP<SShmUploadJob>&& job);
+
+        // do not call
+        void onSignal();
+
+      private:
+        struct SQueued {
+            SShmUploadJob* job   = nullptr;
+            GLuint         texID = 0;
+            Vector2D       size;
+            EGLSyncKHR     mainDone   = EGL_NO_SYNC_KHR; // main context, allocation and sampling of the texture so far
+            EGLSyncKHR     uploadDone = EGL_NO_SYNC_KHR; // worker context, the upload
+        };
+
+        void                     threadMain();
+        void                     upload(SQueued& queued);
+        EGLSyncKHR               fence();
+        void                     destroyFence(EGLSyncKHR& sync);
+
+        EGLDisplay               m_display = nullptr;
+        EGLContext               m_context = nullptr;
+
+        PFNEGLCREATESYNCKHRPROC  m_createSync  = nullptr;
+        PFNEGLDESTROYSYNCKHRPROC m_destroySync = nullptr;
+        PFNEGLWAITSYNCKHRPROC    m_waitSync    = nullptr;
+
+        std::thread              m_thread;
+        std::mutex               m_mutex;
+        std::condition_variable  m_cv;
+        std::deque<SQueued>      m_queued;
+        std::vector<SQueued>     m_done;
+        bool                     m_exit = false;
+
+        // main thread only
+        std::vector<UP<SShmUploadJob>> m_jobs;
+        Hyprutils::OS::CFileDescriptor m_eventFd;
+        wl_event_source*               m_eventSource = nullptr;
+    };
+}
@@ -37,78 +37,198 @@ void CRenderPass::add(UP<IPassElement>&& el) {
     m_passElements.emplace_back(SPassElementData{.element = std::move(el)});
 }
 
+static bool regionsEqual(const CRegion& a, const CRegion& b) {
+    // pixman_region32_equal doesn't modify either region
+    return pixman_region32_equal(const_cast<CRegion&>(a).pixman(), const_cast<CRegion&>(b).pixman());
+}
+
+static CRegion occluderFor(CRegion opaque, float scale, bool willBlur, const CRegion& liveBlurRegion) {
+    // scale and rounding is very particular so we have to use CBoxes scale and round functions
+    if (pixman_region32_n_rects(opaque.pixman()) == 1)
+        opaque = opaque.getExtents().scale(scale).round();
+    else {
+        CRegion scaledRegion;
+        opaque.forEachRect([&scaledRegion, scale](const auto& RECT) {
+            scaledRegion.add(CBox(RECT.x1, RECT.y1, RECT.x2 - RECT.x1, RECT.y2 - RECT.y1).scale(scale).round());
+        });
+        opaque = scaledRegion;
+    }
+
+    // if this intersects the liveBlur region, allow live blur to operate correctly.
+    // do not occlude a border near it.
+    if (willBlur) {
+        if (auto infringement = opaque.copy().intersect(liveBlurRegion); !infringement.empty()) {
+            // eh, this is not the correct solution, but it will do...
+            // TODO: is this *easily* fixable?
+            opaque.subtract(infringement);
+        }
+    }
+
+    return opaque;
+}
+
 void CRenderPass::simplify(bool willBlur, const CRegion& liveBlurRegion) {
     const auto  pMonitor   = g_pHyprRenderer->m_renderData.pMonitor;
     static auto PDEBUGPASS = CConfigValue<Config::INTEGER>("debug:pass");
+    static auto PRETAINED  = CConfigValue<Config::INTEGER>("render:retained_pass");
 
     // TODO: use precompute blur for instances where there is nothing in between
 
+    // occluders only depend on the element itself and these
+    auto& retained = m_retained[pMonitor->m_id];
+    if (!*PRETAINED || retained.scale != pMonitor->m_scale || retained.willBlur != willBlur || (willBlur && !regionsEqual(retained.liveBlurRegion, liveBlurRegion))) {
+        retained.steps.clear();
+        retained.occluders.clear();
+    }
+
+    retained.scale          = pMonitor->m_scale;
+    retained.willBlur       = willBlur;
+    retained.liveBlurRegion = willBlur ? liveBlurRegion.copy() : CRegion{};
+    retained.frame++;
+    m_retainedStats = {};
+
     CRegion newDamage = m_damage.copy().intersect(CBox{{}, pMonitor->m_transformedSize});
+
+    // while this holds, newDamage isn't updated and the steps of the last frame are taken over instead
+    const size_t LASTSTEPS  = retained.steps.size();
+    bool         samePrefix = LASTSTEPS > 0 && regionsEqual(retained.damage, newDamage);
+
+    retained.damage = newDamage.copy();
+    retained.steps.resize(std::max(LASTSTEPS, m_passElements.size()));
+
+    size_t idx = 0;
     for (auto& el : m_passElements | std::views::reverse) {
+        const size_t I    = idx++;
+        const auto&  bb1  = el.element->boundingBoxCached;
+        auto&        step = retained.steps[I];
+
+        // only computed for elements that survive the damage test
+        std::optional<CRegion> opaque;
+
+        if (samePrefix && I < LASTSTEPS) {
+            bool same = step.type == el.element->type() && step.box == bb1;
+
+            // discarded elements don't occlude, otherwise the occluder has to be known to be the same
+            if (same && !step.discard) {
+                if (const auto KEY = el.element->retainKey(); step.key || KEY)
+                    same = step.key == KEY;
+                else if (step.occludes)
+                    same = false;
+                else if (bb1) {
+                    opaque = el.element->opaqueRegion();
+                    same   = opaque->empty();
+                }
+            }
+
+            if (same) {
+                if (step.discard)
+                    el.discard = true;
+                else
+                    el.elementDamage = step.damage.copy();
+
+                if (!step.discard && step.key) {
+                    if (auto it = retained.occluders.find(step.key->identity); it != retained.occluders.end()) {
+                        it->second.frame = retained.frame;
+                        if (*PDEBUGPASS && step.occludes)
+                            m_occludedRegions.emplace_back(it->second.occluder);
+                    }
+                }
+
+                m_retainedStats.reused++;
+                continue;
+            }
+
+            newDamage = step.damage.copy();
+        } else if (samePrefix)
+            newDamage = retained.remaining.copy();
+
+        samePrefix = false;
+        step       = {.type = el.element->type(), .box = bb1, .damage = newDamage.copy()};
 
         if (newDamage.empty() && !el.element->undiscardable()) {
-            el.discard = true;
+            el.discard   = true;
+            step.discard = true;
             continue;
         }
 
-        auto bb1 = el.element->boundingBox();
         if (!bb1 || newDamage.empty()) {
             el.elementDamage = newDamage;
             continue;
         }
 
-        auto bb = bb1->scale(pMonitor->m_scale);
+        auto bb = bb1->copy().scale(pMonitor->m_scale);
 
         // drop if empty
         if (CRegion copy = newDamage.copy(); copy.intersect(bb).empty()) {
-            el.discard = true;
+            el.discard   = true;
+            step.discard = true;
             continue;
         }
 
         el.elementDamage = newDamage;
 
-        auto opaque = el.element->opaqueRegion();
-
-        if (!opaque.empty()) {
-            // scale and rounding is very particular so we have to use CBoxes scale and round functions
-            if (pixman_region32_n_rects(opaque.pixman()) == 1)
-                opaque = opaque.getExtents().scale(pMonitor->m_scale).round();
-            else {
-                CRegion scaledRegion;
-                opaque.forEachRect([&scaledRegion, pMonitor](const auto& RECT) {
-                    scaledRegion.add(CBox(RECT.x1, RECT.y1, RECT.x2 - RECT.x1, RECT.y2 - RECT.y1).scale(pMonitor->m_scale).round());
-                });
-                opaque = scaledRegion;
-            }
-
-            // if this intersects the liveBlur region, allow live blur to operate correctly.
-            // do not occlude a border near it.
-            if (willBlur) {
-                if (auto infringement = opaque.copy().intersect(liveBlurRegion); !infringement.empty()) {
-                    // eh, this is not the correct solution, but it will do...
-                    // TODO: is this *easily* fixable?
-                    opaque.subtract(infringement);
+        const auto     KEY = el.element->retainKey();
+        CRegion        uncached;
+        const CRegion* occluder = &uncached;
+
+        step.key = KEY;
+        if (KEY) {
+            auto& cached = retained.occluders[KEY->identity];
+            if (cached.frame == 0 || cached.key != *KEY || cached.box != *bb1) {
+                cached.key      = *KEY;
+                cached.box      = *bb1;
+                cached.occluder = CRegion{};
+                if (auto region = el.element->opaqueRegion(); !region.empty()) {
+                    cached.occluder = occluderFor(std::move(region), pMonitor->m_scale, willBlur, liveBlurRegion);
+                    m_retainedStats.recomputed++;
                 }
+            } else
+                m_retainedStats.reused++;
+
+            cached.frame = retained.frame;
+            occluder     = &cached.occluder;
+        } else {
+            if (!opaque)
+                opaque = el.element->opaqueRegion();
+
+            if (!opaque->empty()) {
+                uncached = occluderFor(std::move(*opaque), pMonitor->m_scale, willBlur, liveBlurRegion);
+                m_retainedStats.recomputed++;
             }
-            newDamage.subtract(opaque);
-            if (*PDEBUGPASS)
-                m_occludedRegions.emplace_back(opaque);
         }
+
+        if (occluder->empty())
+            continue;
+
+        step.occludes = true;
+        newDamage.subtract(*occluder);
+        if (*PDEBUGPASS)
+            m_occludedRegions.emplace_back(*occluder);
     }
 
+    // every element was taken over, what's left is the same unless some were removed at the bottom
+    if (samePrefix && m_passElements.size() < LASTSTEPS)
+        retained.remaining = retained.steps[m_passElements.size()].damage.copy();
+    else if (!samePrefix)
+        retained.remaining = newDamage.copy();
+
+    retained.steps.resize(m_passElements.size());
+    std::erase_if(retained.occluders, [&retained](const auto& e) { return e.second.frame != retained.frame; });
+
     if (*PDEBUGPASS) {
         for (auto& el2 : m_passElements) {
             if (!el2.element->needsLiveBlurCached)
                 continue;
 
-            const auto BB = el2.element->boundingBox();
-            RASSERT(BB, "No bounding box for an element with live blur is illegal");
-
-            m_totalLiveBlurRegion.add(BB->copy().scale(pMonitor->m_scale));
+            m_totalLiveBlurRegion.add(el2.element->boundingBoxCached->copy().scale(pMonitor->m_scale));
         }
     }
 }
 
+void CRenderPass::dropRetained(MONITORID id) {
+    m_retained.erase(id);
+}
+
 void CRenderPass::clear() {
     m_passElements.clear();
 }
@@ -147,12 +267,12 @@ CRegion CRenderPass::render(const CRegion& damage_) {
     for (auto& el : m_passElements) {
         el.element->needsLiveBlurCached       = el.element->needsLiveBlur();
         el.element->needsPrecomputeBlurCached = el.element->needsPrecomputeBlur();
+        el.element->boundingBoxCached         = el.element->boundingBox();
 
         if (el.element->needsLiveBlurCached) {
-            willBlur      = true;
-            const auto BB = el.element->boundingBox();
-            RASSERT(BB, "No bounding box for an element with live blur is illegal");
-            blurRegion.add(*BB);
+            willBlur = true;
+            RASSERT(el.element->boundingBoxCached, "No bounding box for an element with live blur is illegal");
+            blurRegion.add(*el.element->boundingBoxCached);
         }
 
         if (el.element->needsPrecomputeBlurCached)
@@ -237,7 +357,7 @@ CRegion CRenderPass::render(const CRegion& damage_) {
         if (!providerIsAnimated || (!el.element->needsLiveBlurCached && !el.element->needsPrecomputeBlurCached))
             continue;
 
-        const auto BB = el.element->boundingBox();
+        const auto& BB = el.element->boundingBoxCached;
         if (!BB)
             animatedBlurDamage.add(CBox{{}, pMonitor->m_transformedSize});
         else {
@@ -335,7 +455,8 @@ void CRenderPass::renderDebugData() {
     }
 
     const auto DISCARDED_ELEMENTS = std::ranges::count_if(m_passElements, [](const auto& e) { return e.discard; });
-    auto tex = g_pHyprRenderer->renderText(std::format("occlusion layers: {}\npass elements: {} ({} discarded)\nviewport: {:X0}", m_occludedRegions.size(), m_passElements.size(),
+    auto tex = g_pHyprRenderer->renderText(std::format("occlusion layers: {} ({} retained, {} recomputed)\npass elements: {} ({} discarded)\nviewport: {:X0}",
+                                                       m_occludedRegions.size(), m_retainedStats.reused, m_retainedStats.recomputed, m_passElements.size(),
                                                        DISCARDED_ELEMENTS, pMonitor->m_transformedSize),
                                            Colors::WHITE, 12);
 
@@ -351,7 +472,7 @@ void CRenderPass::renderDebugData() {
     auto        yn   = [](const bool val) -> const char* { return val ? "yes" : "no"; };
     auto        tick = [](const bool val) -> const char* { return val ? "✔" : "✖"; };
     for (const auto& el : m_passElements | std::views::reverse) {
-        passStructure += std::format("{} {} (bb: {} op: {}, pb: {}, lb: {})\n", tick(!el.discard), el.element->passName(), yn(el.element->boundingBox().has_value()),
+        passStructure += std::format("{} {} (bb: {} op: {}, pb: {}, lb: {})\n", tick(!el.discard), el.element->passName(), yn(el.element->boundingBoxCached.has_value()),
                                      yn(!el.element->opaqueRegion().empty()), yn(el.element->needsPrecomputeBlurCached), yn(el.element->needsLiveBlurCached));
     }
 
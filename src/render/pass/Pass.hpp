@@ -3,6 +3,8 @@
 #include "../../defines.hpp"
 #include "PassElement.hpp"
 
+#include <unordered_map>
+
 class CGradientValueData;
 
 namespace Render {
@@ -18,6 +20,7 @@ namespace Render {
         void    add(UP<IPassElement>&& elem);
         void    clear();
         void    removeAllOfType(const std::string& type);
+        void    dropRetained(MONITORID id);
 
         CRegion render(const CRegion& damage_);
 
@@ -34,6 +37,41 @@ namespace Render {
 
         std::vector<SPassElementData> m_passElements;
 
+        // Results of the last simplify() per monitor. Occluders are kept per element identity (see IPassElement::retainKey).
+        // While the damage and all elements above one are the same as last frame, so is the damage left for it.
+        struct SRetainedOccluder {
+            IPassElement::SRetainKey key;
+            CBox                     box;
+            CRegion                  occluder;
+            uint64_t                 frame = 0;
+        };
+
+        struct SRetainedStep {
+            ePassElementType                        type = EK_UNKNOWN;
+            std::optional<IPassElement::SRetainKey> key;
+            std::optional<CBox>                     box;
+            CRegion                                 damage; // left before this element
+            bool                                    discard  = false;
+            bool                                    occludes = false;
+        };
+
+        struct SRetainedFrame {
+            float                                              scale    = 0.F;
+            bool                                               willBlur = false;
+            CRegion                                            liveBlurRegion;
+            CRegion                                            damage;    // simplify() started with
+            CRegion                                            remaining; // left after the last element
+            std::vector<SRetainedStep>                         steps;     // top to bottom
+            std::unordered_map<const void*, SRetainedOccluder> occluders;
+            uint64_t                                           frame = 0;
+        };
+
+        std::unordered_map<MONITORID, SRetainedFrame> m_retained;
+
+        struct {
+            size_t reused = 0, recomputed = 0;
+        } m_retainedStats;
+
         void                          simplify(bool willBlur, const CRegion& liveBlurRegion);
         void                          planBackdropScopes();
         void                          renderDebugData();
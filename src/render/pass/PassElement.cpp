@@ -12,6 +12,10 @@ bool IPassElement::disableSimplification() {
     return false;
 }
 
+std::optional<IPassElement::SRetainKey> IPassElement::retainKey() {
+    return std::nullopt;
+}
+
 void IPassElement::discard() {
     ;
 }
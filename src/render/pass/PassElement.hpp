@@ -37,7 +37,22 @@ class IPassElement {
     virtual CRegion             opaqueRegion(); // in monitor-local logical coordinates
     virtual bool                disableSimplification();
 
+    // Elements are rebuilt every frame, this identifies what an element draws across frames.
+    // Two elements with the same key and bounding box have the same opaque region.
+    struct SRetainKey {
+        const void* identity   = nullptr;
+        uint64_t    generation = 0; // changes whenever the drawn content could have changed its opaque region
+        Vector2D    origin;         // where the opaque region is placed, monitor-local logical coordinates
+        int         inset = 0;      // how far the opaque region is shrunk from its edges
+
+        bool        operator==(const SRetainKey&) const = default;
+    };
+
+    // std::nullopt if the element can't be recognized in the next frame
+    virtual std::optional<SRetainKey> retainKey();
+
     // cached results, computed once per frame in CRenderPass::render()
-    bool needsLiveBlurCached       = false;
-    bool needsPrecomputeBlurCached = false;
+    bool                needsLiveBlurCached       = false;
+    bool                needsPrecomputeBlurCached = false;
+    std::optional<CBox> boundingBoxCached;
 };
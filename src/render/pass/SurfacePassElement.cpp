@@ -136,6 +136,27 @@ CRegion CSurfacePassElement::opaqueRegion() {
     return m_data.texture && m_data.texture->m_opaque ? boundingBox()->expand(-m_data.rounding) : CRegion{};
 }
 
+std::optional<IPassElement::SRetainKey> CSurfacePassElement::retainKey() {
+    // the surface's own opaque region only changes when it commits. The texture fallback in opaqueRegion() is cheap enough.
+    if (!m_data.surface || m_data.surface->m_current.size != Vector2D{m_data.w, m_data.h})
+        return std::nullopt;
+
+    auto        PSURFACE = Desktop::View::CWLSurface::fromResource(m_data.surface);
+
+    const float ALPHA = m_data.alpha * m_data.fadeAlpha * (PSURFACE ? PSURFACE->m_alphaModifier * PSURFACE->m_overallOpacity : 1.F);
+
+    // translucent surfaces don't occlude anything
+    if (ALPHA < 1.F)
+        return std::nullopt;
+
+    return SRetainKey{
+        .identity   = m_data.surface.get(),
+        .generation = m_data.surface->m_stateGeneration,
+        .origin     = m_data.pos + m_data.localPos - m_data.pMonitor->m_position,
+        .inset      = m_data.rounding,
+    };
+}
+
 CRegion CSurfacePassElement::visibleRegion(bool& cancel) {
     auto PSURFACE = Desktop::View::CWLSurface::fromResource(m_data.surface);
     if (!PSURFACE)
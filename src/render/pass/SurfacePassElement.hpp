@@ -56,14 +56,15 @@ class CSurfacePassElement : public IPassElement {
     CSurfacePassElement(const SRenderData& data);
     virtual ~CSurfacePassElement() = default;
 
-    virtual bool                needsLiveBlur();
-    virtual bool                needsPrecomputeBlur();
-    virtual std::optional<CBox> boundingBox();
-    virtual CRegion             opaqueRegion();
-    virtual void                discard();
-    CRegion                     visibleRegion(bool& cancel);
-
-    virtual const char*         passName() {
+    virtual bool                      needsLiveBlur();
+    virtual bool                      needsPrecomputeBlur();
+    virtual std::optional<CBox>       boundingBox();
+    virtual CRegion                   opaqueRegion();
+    virtual std::optional<SRetainKey> retainKey();
+    virtual void                      discard();
+    CRegion                           visibleRegion(bool& cancel);
+
+    virtual const char*               passName() {
         return "CSurfacePassElement";
     }
 
@@ -8,11 +8,13 @@
 using namespace Hyprutils::OS;
 
 CXDataSource::CXDataSource(SXSelection& sel_) : m_selection(sel_) {
+    const auto                BEGIN  = std::chrono::steady_clock::now();
     xcb_get_property_cookie_t cookie = xcb_get_property(g_pXWayland->m_wm->getConnection(),
                                                         1, // delete
-                                                        m_selection.window, HYPRATOMS["_WL_SELECTION"], XCB_GET_PROPERTY_TYPE_ANY, 0, 4096);
+                                                        m_selection.window, HYPRATOMS[ATOM_WL_SELECTION], XCB_GET_PROPERTY_TYPE_ANY, 0, 4096);
 
     xcb_get_property_reply_t* reply = xcb_get_property_reply(g_pXWayland->m_wm->getConnection(), cookie, nullptr);
+    g_pXWayland->m_wm->noteRoundTrip(BEGIN);
     if (!reply)
         return;
 
@@ -23,11 +25,11 @@ CXDataSource::CXDataSource(SXSelection& sel_) : m_selection(sel_) {
 
     auto value = sc<xcb_atom_t*>(xcb_get_property_value(reply));
     for (uint32_t i = 0; i < reply->value_len; i++) {
-        if (value[i] == HYPRATOMS["UTF8_STRING"])
+        if (value[i] == HYPRATOMS[ATOM_UTF8_STRING])
             m_mimeTypes.emplace_back("text/plain;charset=utf-8");
-        else if (value[i] == HYPRATOMS["TEXT"])
+        else if (value[i] == HYPRATOMS[ATOM_TEXT])
             m_mimeTypes.emplace_back("text/plain");
-        else if (value[i] != HYPRATOMS["TARGETS"] && value[i] != HYPRATOMS["TIMESTAMP"]) {
+        else if (value[i] != HYPRATOMS[ATOM_TARGETS] && value[i] != HYPRATOMS[ATOM_TIMESTAMP]) {
 
             auto type = g_pXWayland->m_wm->mimeFromAtom(value[i]);
 
@@ -52,9 +54,9 @@ void CXDataSource::send(const std::string& mime, CFileDescriptor fd) {
     xcb_atom_t mimeAtom = 0;
 
     if (mime == "text/plain")
-        mimeAtom = HYPRATOMS["TEXT"];
+        mimeAtom = HYPRATOMS[ATOM_TEXT];
     else if (mime == "text/plain;charset=utf-8")
-        mimeAtom = HYPRATOMS["UTF8_STRING"];
+        mimeAtom = HYPRATOMS[ATOM_UTF8_STRING];
     else {
         for (size_t i = 0; i < m_mimeTypes.size(); ++i) {
             if (m_mimeTypes[i] == mime) {
@@ -77,13 +79,13 @@ void CXDataSource::send(const std::string& mime, CFileDescriptor fd) {
     xcb_create_window(g_pXWayland->m_wm->getConnection(), XCB_COPY_FROM_PARENT, transfer->incomingWindow, g_pXWayland->m_wm->m_screen->root, 0, 0, 10, 10, 0,
                       XCB_WINDOW_CLASS_INPUT_OUTPUT, g_pXWayland->m_wm->m_screen->root_visual, XCB_CW_EVENT_MASK, &MASK);
 
-    xcb_atom_t selection_atom = HYPRATOMS["CLIPBOARD"];
+    xcb_atom_t selection_atom = HYPRATOMS[ATOM_CLIPBOARD];
     if (&m_selection == &g_pXWayland->m_wm->m_primarySelection)
-        selection_atom = HYPRATOMS["PRIMARY"];
+        selection_atom = HYPRATOMS[ATOM_PRIMARY];
     else if (&m_selection == &g_pXWayland->m_wm->m_dndSelection)
-        selection_atom = HYPRATOMS["XdndSelection"];
+        selection_atom = HYPRATOMS[ATOM_XDND_SELECTION];
 
-    xcb_convert_selection(g_pXWayland->m_wm->getConnection(), transfer->incomingWindow, selection_atom, mimeAtom, HYPRATOMS["_WL_SELECTION"], XCB_TIME_CURRENT_TIME);
+    xcb_convert_selection(g_pXWayland->m_wm->getConnection(), transfer->incomingWindow, selection_atom, mimeAtom, HYPRATOMS[ATOM_WL_SELECTION], XCB_TIME_CURRENT_TIME);
 
     xcb_flush(g_pXWayland->m_wm->getConnection());
 
@@ -7,6 +7,7 @@
 #ifndef NO_XWAYLAND
 
 CXWaylandSurface::CXWaylandSurface(uint32_t xID_, CBox geometry_, bool OR) : m_xID(xID_), m_geometry(geometry_), m_overrideRedirect(OR) {
+    const auto                        BEGIN            = std::chrono::steady_clock::now();
     xcb_res_query_client_ids_cookie_t client_id_cookie = {0};
     if (g_pXWayland->m_wm->m_xres) {
         xcb_res_client_id_spec_t spec = {.client = m_xID, .mask = XCB_RES_CLIENT_ID_MASK_LOCAL_CLIENT_PID};
@@ -19,6 +20,7 @@ CXWaylandSurface::CXWaylandSurface(uint32_t xID_, CBox geometry_, bool OR) : m_x
 
     if (g_pXWayland->m_wm->m_xres) {
         xcb_res_query_client_ids_reply_t* reply = xcb_res_query_client_ids_reply(g_pXWayland->m_wm->getConnection(), client_id_cookie, nullptr);
+        g_pXWayland->m_wm->noteRoundTrip(BEGIN);
         if (!reply)
             return;
 
@@ -48,10 +50,13 @@ CXWaylandSurface::CXWaylandSurface(uint32_t xID_, CBox geometry_, bool OR) : m_x
 void CXWaylandSurface::recheckSupportedProps() {
     m_supportedProps.clear();
 
-    auto  listCookie = xcb_list_properties(g_pXWayland->m_wm->getConnection(), m_xID);
-    auto* listReply  = xcb_list_properties_reply(g_pXWayland->m_wm->getConnection(), listCookie, nullptr);
-    auto  getCookie  = xcb_get_property(g_pXWayland->m_wm->getConnection(), 0, m_xID, HYPRATOMS["WM_PROTOCOLS"], XCB_ATOM_ATOM, 0, 32);
-    auto* getReply   = xcb_get_property_reply(g_pXWayland->m_wm->getConnection(), getCookie, nullptr);
+    // both requests go out before we wait, so it's a single round-trip
+    const auto BEGIN      = std::chrono::steady_clock::now();
+    auto       listCookie = xcb_list_properties(g_pXWayland->m_wm->getConnection(), m_xID);
+    auto       getCookie  = xcb_get_property(g_pXWayland->m_wm->getConnection(), 0, m_xID, HYPRATOMS[ATOM_WM_PROTOCOLS], XCB_ATOM_ATOM, 0, 32);
+    auto*      listReply  = xcb_list_properties_reply(g_pXWayland->m_wm->getConnection(), listCookie, nullptr);
+    auto*      getReply   = xcb_get_property_reply(g_pXWayland->m_wm->getConnection(), getCookie, nullptr);
+    g_pXWayland->m_wm->noteRoundTrip(BEGIN);
 
     if (listReply) {
         const auto* atoms = xcb_list_properties_atoms(listReply);
@@ -177,10 +182,10 @@ bool CXWaylandSurface::wantsFocus() {
         return true;
 
     const std::array<uint32_t, 10> search = {
-        HYPRATOMS["_NET_WM_WINDOW_TYPE_COMBO"],   HYPRATOMS["_NET_WM_WINDOW_TYPE_DND"],          HYPRATOMS["_NET_WM_WINDOW_TYPE_DROPDOWN_MENU"],
-        HYPRATOMS["_NET_WM_WINDOW_TYPE_MENU"],    HYPRATOMS["_NET_WM_WINDOW_TYPE_NOTIFICATION"], HYPRATOMS["_NET_WM_WINDOW_TYPE_POPUP_MENU"],
-        HYPRATOMS["_NET_WM_WINDOW_TYPE_SPLASH"],  HYPRATOMS["_NET_WM_WINDOW_TYPE_DESKTOP"],      HYPRATOMS["_NET_WM_WINDOW_TYPE_TOOLTIP"],
-        HYPRATOMS["_NET_WM_WINDOW_TYPE_UTILITY"],
+        HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_COMBO],   HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_DND],          HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_DROPDOWN_MENU],
+        HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_MENU],    HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_NOTIFICATION], HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_POPUP_MENU],
+        HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_SPLASH],  HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_DESKTOP],      HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_TOOLTIP],
+        HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE_UTILITY],
     };
 
     for (auto const& searched : search) {
@@ -261,9 +266,9 @@ void CXWaylandSurface::close() {
     // Recheck the supported props, check if we maybe have WM_DELETE_WINDOW.
     recheckSupportedProps();
 
-    if (m_supportedProps[HYPRATOMS["WM_DELETE_WINDOW"]]) {
+    if (m_supportedProps[HYPRATOMS[ATOM_WM_DELETE_WINDOW]]) {
         xcb_client_message_data_t msg = {};
-        msg.data32[0]                 = HYPRATOMS["WM_DELETE_WINDOW"];
+        msg.data32[0]                 = HYPRATOMS[ATOM_WM_DELETE_WINDOW];
         msg.data32[1]                 = XCB_CURRENT_TIME;
         g_pXWayland->m_wm->sendWMMessage(m_self.lock(), &msg, XCB_EVENT_MASK_NO_EVENT);
     } else {
@@ -283,11 +288,11 @@ void CXWaylandSurface::setWithdrawn(bool withdrawn_) {
     else
         props[0] = XCB_ICCCM_WM_STATE_NORMAL;
 
-    xcb_change_property(g_pXWayland->m_wm->getConnection(), XCB_PROP_MODE_REPLACE, m_xID, HYPRATOMS["WM_STATE"], HYPRATOMS["WM_STATE"], 32, props.size(), props.data());
+    xcb_change_property(g_pXWayland->m_wm->getConnection(), XCB_PROP_MODE_REPLACE, m_xID, HYPRATOMS[ATOM_WM_STATE], HYPRATOMS[ATOM_WM_STATE], 32, props.size(), props.data());
 }
 
 void CXWaylandSurface::ping() {
-    bool supportsPing = std::ranges::find(m_protocols, HYPRATOMS["_NET_WM_PING"]) != m_protocols.end();
+    bool supportsPing = std::ranges::find(m_protocols, HYPRATOMS[ATOM_NET_WM_PING]) != m_protocols.end();
 
     if (!supportsPing) {
         Log::logger->log(Log::TRACE, "CXWaylandSurface: XID {} does not support ping, just sending an instant reply", m_xID);
@@ -296,7 +301,7 @@ void CXWaylandSurface::ping() {
     }
 
     xcb_client_message_data_t msg = {};
-    msg.data32[0]                 = HYPRATOMS["_NET_WM_PING"];
+    msg.data32[0]                 = HYPRATOMS[ATOM_NET_WM_PING];
     msg.data32[1]                 = Time::millis(Time::steadyNow());
     msg.data32[2]                 = m_xID;
 
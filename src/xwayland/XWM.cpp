@@ -108,6 +108,9 @@ void CXWM::handleConfigureNotify(xcb_configure_notify_event_t* e) {
 }
 
 void CXWM::handleMapRequest(xcb_map_request_event_t* e) {
+    // size hints and the like may still be in flight, and everything below works off them
+    dispatchPendingProperties(true);
+
     const auto XSURF = windowForXID(e->window);
 
     if (!XSURF)
@@ -189,16 +192,18 @@ static bool lookupParentExists(SP<CXWaylandSurface> XSURF, SP<CXWaylandSurface>
 }
 
 std::string CXWM::getAtomName(uint32_t atom) {
-    for (auto const& ha : HYPRATOMS) {
-        if (ha.second != atom)
-            continue;
+    if (const auto IT = HYPRATOMS_REVERSE.find(atom); IT != HYPRATOMS_REVERSE.end())
+        return std::string{HYPRATOM_NAMES[IT->second]};
 
-        return ha.first;
-    }
+    // atoms live as long as the server, so their names never change
+    if (const auto IT = m_atomNames.find(atom); IT != m_atomNames.end())
+        return IT->second;
 
     // Get the name of the atom
+    const auto                             BEGIN  = std::chrono::steady_clock::now();
     const auto                             cookie = xcb_get_atom_name(getConnection(), atom);
     XCBReplyPtr<xcb_get_atom_name_reply_t> reply(xcb_get_atom_name_reply(getConnection(), cookie, nullptr));
+    noteRoundTrip(BEGIN);
 
     if (!reply)
         return "Unknown";
@@ -206,7 +211,7 @@ std::string CXWM::getAtomName(uint32_t atom) {
     auto const name_len = xcb_get_atom_name_name_length(reply.get());
     auto*      name     = xcb_get_atom_name_name(reply.get());
 
-    return {name, name_len};
+    return m_atomNames[atom] = std::string{name, name_len};
 }
 
 void CXWM::readProp(SP<CXWaylandSurface> XSURF, uint32_t atom, xcb_get_property_reply_t* reply) {
@@ -228,11 +233,11 @@ void CXWM::readProp(SP<CXWaylandSurface> XSURF, uint32_t atom, xcb_get_property_
     };
 
     auto handleWMName = [&]() {
-        auto& cachedName = atom == HYPRATOMS["_NET_WM_NAME"] ? XSURF->m_netWmName : XSURF->m_wmName;
+        auto& cachedName = atom == HYPRATOMS[ATOM_NET_WM_NAME] ? XSURF->m_netWmName : XSURF->m_wmName;
 
         if (reply->type == XCB_ATOM_NONE)
             cachedName.reset();
-        else if (reply->type == HYPRATOMS["UTF8_STRING"] || reply->type == HYPRATOMS["TEXT"] || reply->type == XCB_ATOM_STRING)
+        else if (reply->type == HYPRATOMS[ATOM_UTF8_STRING] || reply->type == HYPRATOMS[ATOM_TEXT] || reply->type == XCB_ATOM_STRING)
             cachedName = std::string{value, valueLen};
         else
             return;
@@ -249,7 +254,7 @@ void CXWM::readProp(SP<CXWaylandSurface> XSURF, uint32_t atom, xcb_get_property_
     auto handleWMState = [&]() {
         auto* atoms = rc<const xcb_atom_t*>(value);
         for (uint32_t i = 0; i < reply->value_len; i++) {
-            if (atoms[i] == HYPRATOMS["_NET_WM_STATE_MODAL"])
+            if (atoms[i] == HYPRATOMS[ATOM_NET_WM_STATE_MODAL])
                 XSURF->m_modal = true;
         }
     };
@@ -299,7 +304,7 @@ void CXWM::readProp(SP<CXWaylandSurface> XSURF, uint32_t atom, xcb_get_property_
             return;
         }
 
-        if (reply->type != HYPRATOMS["WM_SIZE_HINTS"])
+        if (reply->type != HYPRATOMS[ATOM_WM_SIZE_HINTS])
             return;
 
         auto sizeHints = makeUnique<xcb_size_hints_t>();
@@ -337,21 +342,21 @@ void CXWM::readProp(SP<CXWaylandSurface> XSURF, uint32_t atom, xcb_get_property_
 
     if (atom == XCB_ATOM_WM_CLASS)
         handleWMClass();
-    else if (atom == XCB_ATOM_WM_NAME || atom == HYPRATOMS["_NET_WM_NAME"])
+    else if (atom == XCB_ATOM_WM_NAME || atom == HYPRATOMS[ATOM_NET_WM_NAME])
         handleWMName();
-    else if (atom == HYPRATOMS["_NET_WM_WINDOW_TYPE"])
+    else if (atom == HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE])
         handleWindowType();
-    else if (atom == HYPRATOMS["_NET_WM_STATE"])
+    else if (atom == HYPRATOMS[ATOM_NET_WM_STATE])
         handleWMState();
-    else if (atom == HYPRATOMS["WM_HINTS"])
+    else if (atom == HYPRATOMS[ATOM_WM_HINTS])
         handleWMHints();
-    else if (atom == HYPRATOMS["WM_WINDOW_ROLE"])
+    else if (atom == HYPRATOMS[ATOM_WM_WINDOW_ROLE])
         handleWMRole();
     else if (atom == XCB_ATOM_WM_TRANSIENT_FOR)
         handleTransientFor();
-    else if (atom == HYPRATOMS["WM_NORMAL_HINTS"])
+    else if (atom == HYPRATOMS[ATOM_WM_NORMAL_HINTS])
         handleSizeHints();
-    else if (atom == HYPRATOMS["WM_PROTOCOLS"])
+    else if (atom == HYPRATOMS[ATOM_WM_PROTOCOLS])
         handleWMProtocols();
     else {
         Log::logger->log(Log::TRACE, "[xwm] Unhandled prop {} -> {}", atom, propName);
@@ -369,32 +374,125 @@ void CXWM::handlePropertyNotify(xcb_property_notify_event_t* e) {
         return;
     }
 
-    xcb_get_property_cookie_t             cookie = xcb_get_property(getConnection(), 0, XSURF->m_xID, e->atom, XCB_ATOM_ANY, 0, 2048);
-    XCBReplyPtr<xcb_get_property_reply_t> reply(xcb_get_property_reply(getConnection(), cookie, nullptr));
+    // the reply is read in onEvent once it arrives
+    requestProperty(XSURF, e->atom);
+}
+
+void CXWM::requestProperty(SP<CXWaylandSurface> surf, xcb_atom_t atom) {
+    // chatty clients (titles, user time) change the same property over and over, only the newest value matters
+    for (auto& p : m_pendingProperties) {
+        if (p.window == surf->m_xID && p.atom == atom)
+            p.superseded = true;
+    }
+
+    m_pendingProperties.emplace_back(SXPendingProperty{
+        .cookie = xcb_get_property(getConnection(), 0, surf->m_xID, atom, XCB_ATOM_ANY, 0, 2048),
+        .surf   = surf,
+        .window = surf->m_xID,
+        .atom   = atom,
+    });
+}
+
+bool CXWM::dispatchPendingProperties(bool wait) {
+    const auto BEGIN   = std::chrono::steady_clock::now();
+    bool       handled = false;
+
+    // replies come in the order we sent the requests, so stop at the first one that isn't here yet
+    while (!m_pendingProperties.empty()) {
+        const auto                PENDING = m_pendingProperties.front();
+        xcb_get_property_reply_t* reply   = nullptr;
+        xcb_generic_error_t*      error   = nullptr;
+
+        if (wait)
+            reply = sc<xcb_get_property_reply_t*>(xcb_wait_for_reply(getConnection(), PENDING.cookie.sequence, &error));
+        else if (!xcb_poll_for_reply(getConnection(), PENDING.cookie.sequence, rc<void**>(&reply), &error))
+            break;
+
+        m_pendingProperties.pop_front();
+        handled = true;
+        free(error);
+
+        XCBReplyPtr<xcb_get_property_reply_t> replyPtr(reply);
+
+        if (!wait)
+            m_stats.pipelined++;
+
+        if (PENDING.superseded) {
+            m_stats.superseded++;
+            continue;
+        }
+
+        onPropertyReply(PENDING, replyPtr.get());
+    }
+
+    if (wait && handled)
+        noteRoundTrip(BEGIN);
+
+    return handled;
+}
+
+void CXWM::onPropertyReply(const SXPendingProperty& pending, xcb_get_property_reply_t* reply) {
+    const auto XSURF = pending.surf.lock();
+
+    // destroyed while we were waiting
+    if (!XSURF)
+        return;
 
     if (!reply) {
-        Log::logger->log(Log::ERR, "[xwm] Failed to read property notify cookie for window {}", e->window);
-        removeTransfersForWindow(e->window);
+        Log::logger->log(Log::ERR, "[xwm] Failed to read property {} for window {}", pending.atom, pending.window);
+        removeTransfersForWindow(pending.window);
         return;
     }
 
-    readProp(XSURF, e->atom, reply.get());
+    readProp(XSURF, pending.atom, reply);
+}
+
+void CXWM::noteRoundTrip(std::chrono::steady_clock::time_point begin) {
+    const auto NOW = std::chrono::steady_clock::now();
+
+    m_stats.roundTrips++;
+    m_stats.blockedMs += std::chrono::duration<double, std::milli>(NOW - begin).count();
+
+    m_roundTripsInWindow++;
+    if (NOW - m_roundTripWindowStart >= std::chrono::seconds(1)) {
+        m_stats.roundTripsPerSecond = m_roundTripsInWindow / std::chrono::duration<double>(NOW - m_roundTripWindowStart).count();
+        m_roundTripsInWindow        = 0;
+        m_roundTripWindowStart      = NOW;
+    }
+}
+
+SXWMStats CXWM::stats() const {
+    auto       result  = m_stats;
+    const auto ELAPSED = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_roundTripWindowStart).count();
+
+    // nothing rolled the window over in a while, so the last rate is stale
+    if (ELAPSED >= 1.0)
+        result.roundTripsPerSecond = m_roundTripsInWindow / ELAPSED;
+
+    result.inFlight = m_pendingProperties.size();
+    return result;
 }
 
 void CXWM::handleClientMessage(xcb_client_message_event_t* e) {
+    // clients often set a property right before sending a message that depends on it
+    dispatchPendingProperties(true);
+
     const auto XSURF = windowForXID(e->window);
 
     if (!XSURF)
         return;
 
-    std::string propName = getAtomName(e->type);
+    // only for logging, and looking up an unknown atom is a round-trip
+    std::string propName;
+    if (Env::isTrace())
+        propName = getAtomName(e->type);
 
-    if (e->type == HYPRATOMS["WM_PROTOCOLS"]) {
-        if (e->data.data32[1] == XSURF->m_lastPingSeq && e->data.data32[0] == HYPRATOMS["_NET_WM_PING"]) {
+    if (e->type == HYPRATOMS[ATOM_WM_PROTOCOLS]) {
+        if (e->data.data32[1] == XSURF->m_lastPingSeq && e->data.data32[0] == HYPRATOMS[ATOM_NET_WM_PING]) {
             XSURF->m_events.pong.emit();
             return;
         }
-    } else if (e->type == HYPRATOMS["WL_SURFACE_ID"]) {
+    } else if (e->type == HYPRATOMS[ATOM_WL_SURFACE_ID]) {
         if (XSURF->m_surface) {
             Log::logger->log(Log::WARN, "[xwm] Re-assignment of WL_SURFACE_ID");
             dissociate(XSURF);
@@ -406,7 +504,7 @@ void CXWM::handleClientMessage(xcb_client_message_event_t* e) {
             auto surf = CWLSurfaceResource::fromResource(resource);
             associate(XSURF, surf);
         }
-    } else if (e->type == HYPRATOMS["WL_SURFACE_SERIAL"]) {
+    } else if (e->type == HYPRATOMS[ATOM_WL_SURFACE_SERIAL]) {
         if (XSURF->m_wlSerial) {
             Log::logger->log(Log::WARN, "[xwm] Re-assignment of WL_SURFACE_SERIAL");
             dissociate(XSURF);
@@ -429,7 +527,7 @@ void CXWM::handleClientMessage(xcb_client_message_event_t* e) {
             break;
         }
 
-    } else if (e->type == HYPRATOMS["_NET_WM_STATE"]) {
+    } else if (e->type == HYPRATOMS[ATOM_NET_WM_STATE]) {
         if (e->format == 32) {
             uint32_t action = e->data.data32[0];
             for (size_t i = 0; i < 2; ++i) {
@@ -451,26 +549,26 @@ void CXWM::handleClientMessage(xcb_client_message_event_t* e) {
                     return false;
                 };
 
-                if (prop == HYPRATOMS["_NET_WM_STATE_FULLSCREEN"])
+                if (prop == HYPRATOMS[ATOM_NET_WM_STATE_FULLSCREEN])
                     XSURF->m_state.requestsFullscreen = updateState(action, XSURF->m_fullscreen);
-                if (prop == HYPRATOMS["_NET_WM_STATE_HIDDEN"])
+                if (prop == HYPRATOMS[ATOM_NET_WM_STATE_HIDDEN])
                     XSURF->m_state.requestsMinimize = updateState(action, XSURF->m_minimized);
-                if (prop == HYPRATOMS["_NET_WM_STATE_MAXIMIZED_VERT"] || prop == HYPRATOMS["_NET_WM_STATE_MAXIMIZED_HORZ"])
+                if (prop == HYPRATOMS[ATOM_NET_WM_STATE_MAXIMIZED_VERT] || prop == HYPRATOMS[ATOM_NET_WM_STATE_MAXIMIZED_HORZ])
                     XSURF->m_state.requestsMaximize = updateState(action, XSURF->m_maximized);
             }
 
             XSURF->m_events.stateChanged.emit();
         }
-    } else if (e->type == HYPRATOMS["WM_CHANGE_STATE"]) {
+    } else if (e->type == HYPRATOMS[ATOM_WM_CHANGE_STATE]) {
         int state = e->data.data32[0];
         if (state == XCB_ICCCM_WM_STATE_ICONIC || state == XCB_ICCCM_WM_STATE_WITHDRAWN)
             XSURF->m_state.requestsMinimize = true;
         else if (state == XCB_ICCCM_WM_STATE_NORMAL)
             XSURF->m_state.requestsMinimize = false;
         XSURF->m_events.stateChanged.emit();
-    } else if (e->type == HYPRATOMS["_NET_ACTIVE_WINDOW"]) {
+    } else if (e->type == HYPRATOMS[ATOM_NET_ACTIVE_WINDOW]) {
         XSURF->m_events.activate.emit();
-    } else if (e->type == HYPRATOMS["XdndStatus"]) {
+    } else if (e->type == HYPRATOMS[ATOM_XDND_STATUS]) {
         if (m_dndDataOffers.empty() || !m_dndDataOffers.at(0)->getSource()) {
             Log::logger->log(Log::TRACE, "[xwm] Rejecting XdndStatus message: nothing to get");
             return;
@@ -483,7 +581,7 @@ void CXWM::handleClientMessage(xcb_client_message_event_t* e) {
             m_dndDataOffers.at(0)->getSource()->accepted("");
 
         Log::logger->log(Log::DEBUG, "[xwm] XdndStatus: accepted: {}");
-    } else if (e->type == HYPRATOMS["XdndFinished"]) {
+    } else if (e->type == HYPRATOMS[ATOM_XDND_FINISHED]) {
         if (m_dndDataOffers.empty() || !m_dndDataOffers.at(0)->getSource()) {
             Log::logger->log(Log::TRACE, "[xwm] Rejecting XdndFinished message: nothing to get");
             return;
@@ -535,7 +633,7 @@ void CXWM::sendWMMessage(SP<CXWaylandSurface> surf, xcb_client_message_data_t* d
         .format        = 32,
         .sequence      = 0,
         .window        = surf->m_xID,
-        .type          = HYPRATOMS["WM_PROTOCOLS"],
+        .type          = HYPRATOMS[ATOM_WM_PROTOCOLS],
         .data          = *data,
     };
 
@@ -567,7 +665,7 @@ void CXWM::focusWindow(SP<CXWaylandSurface> surf) {
         return;
 
     xcb_client_message_data_t msg = {{0}};
-    msg.data32[0]                 = HYPRATOMS["WM_TAKE_FOCUS"];
+    msg.data32[0]                 = HYPRATOMS[ATOM_WM_TAKE_FOCUS];
     msg.data32[1]                 = XCB_TIME_CURRENT_TIME;
 
     if (surf->m_hints && !surf->m_hints->input)
@@ -617,33 +715,35 @@ void CXWM::selectionSendNotify(xcb_selection_request_event_t* e, bool success) {
 
 xcb_atom_t CXWM::mimeToAtom(const std::string& mime) {
     if (mime == "text/plain;charset=utf-8")
-        return HYPRATOMS["UTF8_STRING"];
+        return HYPRATOMS[ATOM_UTF8_STRING];
     if (mime == "text/plain")
-        return HYPRATOMS["TEXT"];
+        return HYPRATOMS[ATOM_TEXT];
+
+    if (const auto IT = m_mimeAtoms.find(mime); IT != m_mimeAtoms.end())
+        return IT->second;
 
+    const auto                           BEGIN  = std::chrono::steady_clock::now();
     xcb_intern_atom_cookie_t             cookie = xcb_intern_atom(getConnection(), 0, mime.length(), mime.c_str());
     XCBReplyPtr<xcb_intern_atom_reply_t> reply(xcb_intern_atom_reply(getConnection(), cookie, nullptr));
+    noteRoundTrip(BEGIN);
     if (!reply.get())
         return XCB_ATOM_NONE;
     xcb_atom_t atom = reply->atom;
 
+    m_mimeAtoms[mime] = atom;
+    m_atomNames[atom] = mime;
     return atom;
 }
 
 std::string CXWM::mimeFromAtom(xcb_atom_t atom) {
-    if (atom == HYPRATOMS["UTF8_STRING"])
+    if (atom == HYPRATOMS[ATOM_UTF8_STRING])
         return "text/plain;charset=utf-8";
-    if (atom == HYPRATOMS["TEXT"])
+    if (atom == HYPRATOMS[ATOM_TEXT])
         return "text/plain";
 
-    xcb_get_atom_name_cookie_t             cookie = xcb_get_atom_name(getConnection(), atom);
-    XCBReplyPtr<xcb_get_atom_name_reply_t> reply(xcb_get_atom_name_reply(getConnection(), cookie, nullptr));
-    if (!reply)
-        return "INVALID";
-    size_t      len = xcb_get_atom_name_name_length(reply.get());
-    char*       buf = xcb_get_atom_name_name(reply.get()); // not a C string
-    std::string SZNAME{buf, len};
-    return SZNAME;
+    // mime types are atom names, and getAtomName remembers the ones it looked up
+    const auto NAME = getAtomName(atom);
+    return NAME == "Unknown" ? "INVALID" : NAME;
 }
 
 void CXWM::handleSelectionNotify(xcb_selection_notify_event_t* e) {
@@ -662,7 +762,7 @@ void CXWM::handleSelectionNotify(xcb_selection_notify_event_t* e) {
             Log::logger->log(Log::TRACE, "[xwm] converting selection failed");
             sel->transfers.erase(it);
         }
-    } else if (e->target == HYPRATOMS["TARGETS"]) {
+    } else if (e->target == HYPRATOMS[ATOM_TARGETS]) {
         if (!m_focusedSurface) {
             Log::logger->log(Log::TRACE, "[xwm] denying access to write to clipboard because no X client is in focus");
             return;
@@ -707,11 +807,11 @@ bool CXWM::handleSelectionPropertyNotify(xcb_property_notify_event_t* e) {
 }
 
 SXSelection* CXWM::getSelection(xcb_atom_t atom) {
-    if (atom == HYPRATOMS["CLIPBOARD"])
+    if (atom == HYPRATOMS[ATOM_CLIPBOARD])
         return &m_clipboard;
-    else if (atom == HYPRATOMS["PRIMARY"])
+    else if (atom == HYPRATOMS[ATOM_PRIMARY])
         return &m_primarySelection;
-    else if (atom == HYPRATOMS["XdndSelection"])
+    else if (atom == HYPRATOMS[ATOM_XDND_SELECTION])
         return &m_dndSelection;
 
     return nullptr;
@@ -729,7 +829,7 @@ void CXWM::handleSelectionRequest(xcb_selection_request_event_t* e) {
         return;
     }
 
-    if (e->selection == HYPRATOMS["CLIPBOARD_MANAGER"]) {
+    if (e->selection == HYPRATOMS[ATOM_CLIPBOARD_MANAGER]) {
         selectionSendNotify(e, true);
         return;
     }
@@ -746,7 +846,7 @@ void CXWM::handleSelectionRequest(xcb_selection_request_event_t* e) {
         return;
     }
 
-    if (e->target == HYPRATOMS["TARGETS"]) {
+    if (e->target == HYPRATOMS[ATOM_TARGETS]) {
         // send mime types
         std::vector<std::string> mimes;
         if (sel == &m_clipboard && g_pSeatManager->m_selection.currentSelection)
@@ -760,8 +860,8 @@ void CXWM::handleSelectionRequest(xcb_selection_request_event_t* e) {
         std::vector<xcb_atom_t> atoms;
         // reserve to avoid reallocations
         atoms.reserve(mimes.size() + 2);
-        atoms.push_back(HYPRATOMS["TIMESTAMP"]);
-        atoms.push_back(HYPRATOMS["TARGETS"]);
+        atoms.push_back(HYPRATOMS[ATOM_TIMESTAMP]);
+        atoms.push_back(HYPRATOMS[ATOM_TARGETS]);
 
         for (auto const& m : mimes) {
             atoms.push_back(mimeToAtom(m));
@@ -769,10 +869,10 @@ void CXWM::handleSelectionRequest(xcb_selection_request_event_t* e) {
 
         xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, e->requestor, e->property, XCB_ATOM_ATOM, 32, atoms.size(), atoms.data());
         selectionSendNotify(e, true);
-    } else if (e->target == HYPRATOMS["TIMESTAMP"]) {
+    } else if (e->target == HYPRATOMS[ATOM_TIMESTAMP]) {
         xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, e->requestor, e->property, XCB_ATOM_INTEGER, 32, 1, &sel->timestamp);
         selectionSendNotify(e, true);
-    } else if (e->target == HYPRATOMS["DELETE"]) {
+    } else if (e->target == HYPRATOMS[ATOM_DELETE]) {
         selectionSendNotify(e, true);
     } else {
         std::string mime = mimeFromAtom(e->target);
@@ -825,9 +925,9 @@ bool CXWM::handleSelectionXFixesNotify(xcb_xfixes_selection_notify_event_t* e) {
     }
 
     if (sel == &m_clipboard)
-        xcb_convert_selection(getConnection(), sel->window, HYPRATOMS["CLIPBOARD"], HYPRATOMS["TARGETS"], HYPRATOMS["_WL_SELECTION"], e->timestamp);
+        xcb_convert_selection(getConnection(), sel->window, HYPRATOMS[ATOM_CLIPBOARD], HYPRATOMS[ATOM_TARGETS], HYPRATOMS[ATOM_WL_SELECTION], e->timestamp);
     else if (sel == &m_primarySelection)
-        xcb_convert_selection(getConnection(), sel->window, HYPRATOMS["PRIMARY"], HYPRATOMS["TARGETS"], HYPRATOMS["_WL_SELECTION"], e->timestamp);
+        xcb_convert_selection(getConnection(), sel->window, HYPRATOMS[ATOM_PRIMARY], HYPRATOMS[ATOM_TARGETS], HYPRATOMS[ATOM_WL_SELECTION], e->timestamp);
     xcb_flush(getConnection());
 
     return true;
@@ -868,12 +968,20 @@ int CXWM::onEvent(int fd, uint32_t mask) {
         return 0;
     }
 
-    int processedEventCount = 0;
-    using XCBEventPtr       = std::unique_ptr<xcb_generic_event_t, decltype(&free)>;
+    int  processedEventCount = 0;
+    bool handledReplies      = false;
+    using XCBEventPtr        = std::unique_ptr<xcb_generic_event_t, decltype(&free)>;
     while (true) {
         XCBEventPtr event(xcb_poll_for_event(getConnection()), &free);
-        if (!event)
+        if (!event) {
+            // reading replies can pull more events off the socket, which won't wake us up again
+            if (dispatchPendingProperties(false)) {
+                handledReplies = true;
+                continue;
+            }
+
             break;
+        }
 
         processedEventCount++;
 
@@ -899,7 +1007,7 @@ int CXWM::onEvent(int fd, uint32_t mask) {
         }
     }
 
-    if (processedEventCount)
+    if (processedEventCount || handledReplies)
         xcb_flush(getConnection());
 
     return processedEventCount;
@@ -910,25 +1018,39 @@ void CXWM::gatherResources() {
     xcb_prefetch_extension_data(getConnection(), &xcb_composite_id);
     xcb_prefetch_extension_data(getConnection(), &xcb_res_id);
 
-    for (auto& ATOM : HYPRATOMS) {
-        xcb_intern_atom_cookie_t             cookie = xcb_intern_atom(getConnection(), 0, ATOM.first.length(), ATOM.first.c_str());
-        XCBReplyPtr<xcb_intern_atom_reply_t> reply(xcb_intern_atom_reply(getConnection(), cookie, nullptr));
+    // send all of them before reading any reply, one round-trip instead of one per atom
+    const auto                                       BEGIN = std::chrono::steady_clock::now();
+    std::array<xcb_intern_atom_cookie_t, ATOM_COUNT> cookies;
+    for (size_t i = 0; i < ATOM_COUNT; ++i) {
+        cookies[i] = xcb_intern_atom(getConnection(), 0, HYPRATOM_NAMES[i].length(), HYPRATOM_NAMES[i].data());
+    }
+
+    HYPRATOMS_REVERSE.clear();
+
+    for (size_t i = 0; i < ATOM_COUNT; ++i) {
+        XCBReplyPtr<xcb_intern_atom_reply_t> reply(xcb_intern_atom_reply(getConnection(), cookies[i], nullptr));
 
         if (!reply) {
-            Log::logger->log(Log::ERR, "[xwm] Atom failed: {}", ATOM.first);
+            Log::logger->log(Log::ERR, "[xwm] Atom failed: {}", HYPRATOM_NAMES[i]);
+            HYPRATOMS[i] = XCB_ATOM_NONE;
             continue;
         }
 
-        ATOM.second = reply->atom;
+        HYPRATOMS[i]                   = reply->atom;
+        HYPRATOMS_REVERSE[reply->atom] = sc<eHyprAtom>(i);
     }
 
+    noteRoundTrip(BEGIN);
+
     m_xfixes = xcb_get_extension_data(getConnection(), &xcb_xfixes_id);
 
     if (!m_xfixes || !m_xfixes->present)
         Log::logger->log(Log::WARN, "XFixes not available");
 
+    const auto                                    xfixesBegin   = std::chrono::steady_clock::now();
     auto                                          xfixes_cookie = xcb_xfixes_query_version(getConnection(), XCB_XFIXES_MAJOR_VERSION, XCB_XFIXES_MINOR_VERSION);
     XCBReplyPtr<xcb_xfixes_query_version_reply_t> xfixes_reply(xcb_xfixes_query_version_reply(getConnection(), xfixes_cookie, nullptr));
+    noteRoundTrip(xfixesBegin);
 
     if (xfixes_reply) {
         Log::logger->log(Log::DEBUG, "xfixes version: {}.{}", xfixes_reply->major_version, xfixes_reply->minor_version);
@@ -939,8 +1061,10 @@ void CXWM::gatherResources() {
     if (!xresReply1 || !xresReply1->present)
         return;
 
+    const auto                                 xresBegin   = std::chrono::steady_clock::now();
     auto                                       xres_cookie = xcb_res_query_version(getConnection(), XCB_RES_MAJOR_VERSION, XCB_RES_MINOR_VERSION);
     XCBReplyPtr<xcb_res_query_version_reply_t> xres_reply(xcb_res_query_version_reply(getConnection(), xres_cookie, nullptr));
+    noteRoundTrip(xresBegin);
     if (!xres_reply)
         return;
 
@@ -978,8 +1102,10 @@ void CXWM::getVisual() {
 }
 
 void CXWM::getRenderFormat() {
+    const auto                                         BEGIN  = std::chrono::steady_clock::now();
     auto                                               cookie = xcb_render_query_pict_formats(getConnection());
     XCBReplyPtr<xcb_render_query_pict_formats_reply_t> reply(xcb_render_query_pict_formats_reply(getConnection(), cookie, nullptr));
+    noteRoundTrip(BEGIN);
 
     if (!reply) {
         Log::logger->log(Log::DEBUG, "xwm: No xcb_render_query_pict_formats_reply_t reply");
@@ -1037,11 +1163,12 @@ CXWM::CXWM() : m_connection(makeUnique<CXCBConnection>(g_pXWayland->m_server->m_
     xcb_composite_redirect_subwindows(getConnection(), m_screen->root, XCB_COMPOSITE_REDIRECT_MANUAL);
 
     xcb_atom_t supported[] = {
-        HYPRATOMS["_NET_WM_STATE"],        HYPRATOMS["_NET_ACTIVE_WINDOW"],       HYPRATOMS["_NET_WM_MOVERESIZE"],           HYPRATOMS["_NET_WM_STATE_FOCUSED"],
-        HYPRATOMS["_NET_WM_STATE_MODAL"],  HYPRATOMS["_NET_WM_STATE_FULLSCREEN"], HYPRATOMS["_NET_WM_STATE_MAXIMIZED_VERT"], HYPRATOMS["_NET_WM_STATE_MAXIMIZED_HORZ"],
-        HYPRATOMS["_NET_WM_STATE_HIDDEN"], HYPRATOMS["_NET_CLIENT_LIST"],         HYPRATOMS["_NET_CLIENT_LIST_STACKING"],    HYPRATOMS["_NET_WORKAREA"],
+        HYPRATOMS[ATOM_NET_WM_STATE],        HYPRATOMS[ATOM_NET_ACTIVE_WINDOW],       HYPRATOMS[ATOM_NET_WM_MOVERESIZE],           HYPRATOMS[ATOM_NET_WM_STATE_FOCUSED],
+        HYPRATOMS[ATOM_NET_WM_STATE_MODAL],  HYPRATOMS[ATOM_NET_WM_STATE_FULLSCREEN], HYPRATOMS[ATOM_NET_WM_STATE_MAXIMIZED_VERT], HYPRATOMS[ATOM_NET_WM_STATE_MAXIMIZED_HORZ],
+        HYPRATOMS[ATOM_NET_WM_STATE_HIDDEN], HYPRATOMS[ATOM_NET_CLIENT_LIST],         HYPRATOMS[ATOM_NET_CLIENT_LIST_STACKING],    HYPRATOMS[ATOM_NET_WORKAREA],
     };
-    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS["_NET_SUPPORTED"], XCB_ATOM_ATOM, 32, sizeof(supported) / sizeof(*supported), supported);
+    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS[ATOM_NET_SUPPORTED], XCB_ATOM_ATOM, 32, sizeof(supported) / sizeof(*supported),
+                        supported);
 
     setActiveWindow(XCB_WINDOW_NONE);
     initSelection();
@@ -1065,24 +1192,24 @@ CXWM::~CXWM() {
 }
 
 void CXWM::setActiveWindow(xcb_window_t window) {
-    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS["_NET_ACTIVE_WINDOW"], HYPRATOMS["WINDOW"], 32, 1, &window);
+    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS[ATOM_NET_ACTIVE_WINDOW], HYPRATOMS[ATOM_WINDOW], 32, 1, &window);
 }
 
 void CXWM::createWMWindow() {
     constexpr const char* wmName = "Hyprland :D";
     m_wmWindow                   = xcb_generate_id(getConnection());
     xcb_create_window(getConnection(), XCB_COPY_FROM_PARENT, m_wmWindow, m_screen->root, 0, 0, 10, 10, 0, XCB_WINDOW_CLASS_INPUT_OUTPUT, m_screen->root_visual, 0, nullptr);
-    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_wmWindow, HYPRATOMS["_NET_WM_NAME"], HYPRATOMS["UTF8_STRING"],
+    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_wmWindow, HYPRATOMS[ATOM_NET_WM_NAME], HYPRATOMS[ATOM_UTF8_STRING],
                         8, // format
                         strlen(wmName), wmName);
-    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS["_NET_SUPPORTING_WM_CHECK"], XCB_ATOM_WINDOW,
+    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS[ATOM_NET_SUPPORTING_WM_CHECK], XCB_ATOM_WINDOW,
                         32, // format
                         1, &m_wmWindow);
-    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_wmWindow, HYPRATOMS["_NET_SUPPORTING_WM_CHECK"], XCB_ATOM_WINDOW,
+    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_wmWindow, HYPRATOMS[ATOM_NET_SUPPORTING_WM_CHECK], XCB_ATOM_WINDOW,
                         32, // format
                         1, &m_wmWindow);
-    xcb_set_selection_owner(getConnection(), m_wmWindow, HYPRATOMS["WM_S0"], XCB_CURRENT_TIME);
-    xcb_set_selection_owner(getConnection(), m_wmWindow, HYPRATOMS["_NET_WM_CM_S0"], XCB_CURRENT_TIME);
+    xcb_set_selection_owner(getConnection(), m_wmWindow, HYPRATOMS[ATOM_WM_S0], XCB_CURRENT_TIME);
+    xcb_set_selection_owner(getConnection(), m_wmWindow, HYPRATOMS[ATOM_NET_WM_CM_S0], XCB_CURRENT_TIME);
 }
 
 void CXWM::activateSurface(SP<CXWaylandSurface> surf, bool activate) {
@@ -1107,7 +1234,7 @@ void CXWM::sendState(SP<CXWaylandSurface> surf) {
         surf->setWithdrawn(false); // resend normal state
 
     if (surf->m_withdrawn) {
-        xcb_delete_property(getConnection(), surf->m_xID, HYPRATOMS["_NET_WM_STATE"]);
+        xcb_delete_property(getConnection(), surf->m_xID, HYPRATOMS[ATOM_NET_WM_STATE]);
         return;
     }
 
@@ -1115,19 +1242,19 @@ void CXWM::sendState(SP<CXWaylandSurface> surf) {
     // reserve to avoid reallocations
     props.reserve(6); // props below
     if (surf->m_modal)
-        props.push_back(HYPRATOMS["_NET_WM_STATE_MODAL"]);
+        props.push_back(HYPRATOMS[ATOM_NET_WM_STATE_MODAL]);
     if (surf->m_fullscreen)
-        props.push_back(HYPRATOMS["_NET_WM_STATE_FULLSCREEN"]);
+        props.push_back(HYPRATOMS[ATOM_NET_WM_STATE_FULLSCREEN]);
     if (surf->m_maximized) {
-        props.push_back(HYPRATOMS["_NET_WM_STATE_MAXIMIZED_VERT"]);
-        props.push_back(HYPRATOMS["_NET_WM_STATE_MAXIMIZED_HORZ"]);
+        props.push_back(HYPRATOMS[ATOM_NET_WM_STATE_MAXIMIZED_VERT]);
+        props.push_back(HYPRATOMS[ATOM_NET_WM_STATE_MAXIMIZED_HORZ]);
     }
     if (surf->m_minimized)
-        props.push_back(HYPRATOMS["_NET_WM_STATE_HIDDEN"]);
+        props.push_back(HYPRATOMS[ATOM_NET_WM_STATE_HIDDEN]);
     if (surf == m_focusedSurface)
-        props.push_back(HYPRATOMS["_NET_WM_STATE_FOCUSED"]);
+        props.push_back(HYPRATOMS[ATOM_NET_WM_STATE_FOCUSED]);
 
-    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, surf->m_xID, HYPRATOMS["_NET_WM_STATE"], XCB_ATOM_ATOM, 32, props.size(), props.data());
+    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, surf->m_xID, HYPRATOMS[ATOM_NET_WM_STATE], XCB_ATOM_ATOM, 32, props.size(), props.data());
 }
 
 void CXWM::onNewSurface(SP<CWLSurfaceResource> surf) {
@@ -1166,20 +1293,18 @@ void CXWM::onNewResource(SP<CXWaylandSurfaceResource> resource) {
 
 void CXWM::readWindowData(SP<CXWaylandSurface> surf) {
     const std::array<xcb_atom_t, 9> interestingProps = {
-        XCB_ATOM_WM_CLASS,          XCB_ATOM_WM_NAME,          XCB_ATOM_WM_TRANSIENT_FOR,        HYPRATOMS["WM_HINTS"],
-        HYPRATOMS["_NET_WM_STATE"], HYPRATOMS["_NET_WM_NAME"], HYPRATOMS["_NET_WM_WINDOW_TYPE"], HYPRATOMS["WM_NORMAL_HINTS"],
-        HYPRATOMS["WM_PROTOCOLS"],
+        XCB_ATOM_WM_CLASS,            XCB_ATOM_WM_NAME,            XCB_ATOM_WM_TRANSIENT_FOR,          HYPRATOMS[ATOM_WM_HINTS],
+        HYPRATOMS[ATOM_NET_WM_STATE], HYPRATOMS[ATOM_NET_WM_NAME], HYPRATOMS[ATOM_NET_WM_WINDOW_TYPE], HYPRATOMS[ATOM_WM_NORMAL_HINTS],
+        HYPRATOMS[ATOM_WM_PROTOCOLS],
     };
 
-    for (size_t i = 0; i < interestingProps.size(); i++) {
-        xcb_get_property_cookie_t             cookie = xcb_get_property(getConnection(), 0, surf->m_xID, interestingProps[i], XCB_ATOM_ANY, 0, 2048);
-        XCBReplyPtr<xcb_get_property_reply_t> reply(xcb_get_property_reply(getConnection(), cookie, nullptr));
-        if (!reply) {
-            Log::logger->log(Log::ERR, "[xwm] Failed to get window property");
-            continue;
-        }
-        readProp(surf, interestingProps[i], reply.get());
+    // callers need the data right away, but there's no need to wait for each property on its own.
+    // Anything still in flight was requested earlier, so it goes first or it would overwrite what we read here.
+    for (const auto& prop : interestingProps) {
+        requestProperty(surf, prop);
     }
+
+    dispatchPendingProperties(true);
 }
 
 SP<CXWaylandSurface> CXWM::windowForWayland(SP<CWLSurfaceResource> surf) {
@@ -1232,7 +1357,7 @@ void CXWM::updateClientList() {
             windows.push_back(surf->m_xID);
     }
 
-    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS["_NET_CLIENT_LIST"], XCB_ATOM_WINDOW, 32, windows.size(), windows.data());
+    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS[ATOM_NET_CLIENT_LIST], XCB_ATOM_WINDOW, 32, windows.size(), windows.data());
 
     windows.clear();
     windows.reserve(m_mappedSurfacesStacking.size());
@@ -1242,7 +1367,7 @@ void CXWM::updateClientList() {
             windows.push_back(surf->m_xID);
     }
 
-    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS["_NET_CLIENT_LIST_STACKING"], XCB_ATOM_WINDOW, 32, windows.size(), windows.data());
+    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS[ATOM_NET_CLIENT_LIST_STACKING], XCB_ATOM_WINDOW, 32, windows.size(), windows.data());
 }
 
 void CXWM::updateWorkArea(int x, int y, int w, int h) {
@@ -1251,13 +1376,13 @@ void CXWM::updateWorkArea(int x, int y, int w, int h) {
     auto connection = g_pXWayland->m_wm->getConnection();
 
     if (w <= 0 || h <= 0) {
-        xcb_delete_property(connection, m_screen->root, HYPRATOMS["_NET_WORKAREA"]);
+        xcb_delete_property(connection, m_screen->root, HYPRATOMS[ATOM_NET_WORKAREA]);
         xcb_flush(connection);
         return;
     }
 
     uint32_t values[4] = {sc<uint32_t>(x), sc<uint32_t>(y), sc<uint32_t>(w), sc<uint32_t>(h)};
-    xcb_change_property(connection, XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS["_NET_WORKAREA"], XCB_ATOM_CARDINAL, 32, 4, values);
+    xcb_change_property(connection, XCB_PROP_MODE_REPLACE, m_screen->root, HYPRATOMS[ATOM_NET_WORKAREA], XCB_ATOM_CARDINAL, 32, 4, values);
     xcb_flush(connection);
 }
 
@@ -1277,7 +1402,7 @@ void CXWM::initSelection() {
     const uint32_t xfixesMask =
         XCB_XFIXES_SELECTION_EVENT_MASK_SET_SELECTION_OWNER | XCB_XFIXES_SELECTION_EVENT_MASK_SELECTION_WINDOW_DESTROY | XCB_XFIXES_SELECTION_EVENT_MASK_SELECTION_CLIENT_CLOSE;
 
-    auto createSelectionWindow = [&](xcb_window_t& window, const std::string& atomName, bool inputOnly = false) {
+    auto createSelectionWindow = [&](xcb_window_t& window, eHyprAtom atom, bool inputOnly = false) {
         window                = xcb_generate_id(getConnection());
         const uint16_t width  = inputOnly ? 8192 : 10;
         const uint16_t height = inputOnly ? 8192 : 10;
@@ -1286,25 +1411,25 @@ void CXWM::initSelection() {
                           inputOnly ? XCB_WINDOW_CLASS_INPUT_ONLY : XCB_WINDOW_CLASS_INPUT_OUTPUT, m_screen->root_visual, XCB_CW_EVENT_MASK, &windowMask);
 
         if (!inputOnly) {
-            xcb_set_selection_owner(getConnection(), window, HYPRATOMS[atomName], XCB_TIME_CURRENT_TIME);
-            xcb_xfixes_select_selection_input(getConnection(), window, HYPRATOMS[atomName], xfixesMask);
+            xcb_set_selection_owner(getConnection(), window, HYPRATOMS[atom], XCB_TIME_CURRENT_TIME);
+            xcb_xfixes_select_selection_input(getConnection(), window, HYPRATOMS[atom], xfixesMask);
         }
 
         return window;
     };
 
-    createSelectionWindow(m_clipboard.window, "CLIPBOARD_MANAGER");
-    createSelectionWindow(m_clipboard.window, "CLIPBOARD");
+    createSelectionWindow(m_clipboard.window, ATOM_CLIPBOARD_MANAGER);
+    createSelectionWindow(m_clipboard.window, ATOM_CLIPBOARD);
     m_clipboard.listeners.setSelection        = g_pSeatManager->m_events.setSelection.listen([this] { m_clipboard.onSelection(); });
     m_clipboard.listeners.keyboardFocusChange = g_pSeatManager->m_events.keyboardFocusChange.listen([this] { m_clipboard.onKeyboardFocus(); });
 
-    createSelectionWindow(m_primarySelection.window, "PRIMARY");
+    createSelectionWindow(m_primarySelection.window, ATOM_PRIMARY);
     m_primarySelection.listeners.setSelection        = g_pSeatManager->m_events.setPrimarySelection.listen([this] { m_primarySelection.onSelection(); });
     m_primarySelection.listeners.keyboardFocusChange = g_pSeatManager->m_events.keyboardFocusChange.listen([this] { m_primarySelection.onKeyboardFocus(); });
 
-    createSelectionWindow(m_dndSelection.window, "XdndAware", true);
+    createSelectionWindow(m_dndSelection.window, ATOM_XDND_AWARE, true);
     const uint32_t xdndVersion = XDND_VERSION;
-    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_dndSelection.window, HYPRATOMS["XdndAware"], XCB_ATOM_ATOM, 32, 1, &xdndVersion);
+    xcb_change_property(getConnection(), XCB_PROP_MODE_REPLACE, m_dndSelection.window, HYPRATOMS[ATOM_XDND_AWARE], XCB_ATOM_ATOM, 32, 1, &xdndVersion);
 }
 
 void CXWM::setClipboardToWayland(SXSelection& sel) {
@@ -1357,7 +1482,7 @@ void CXWM::getTransferData(SXSelection& sel) {
         return;
     }
 
-    if (transfer->propertyReply->type == HYPRATOMS["INCR"]) {
+    if (transfer->propertyReply->type == HYPRATOMS[ATOM_INCR]) {
         transfer->incremental   = true;
         transfer->propertyStart = 0;
         free(transfer->propertyReply); // NOLINT(cppcoreguidelines-no-malloc)
@@ -1459,11 +1584,11 @@ void SXSelection::onSelection() {
     auto conn = g_pXWayland->m_wm->getConnection();
 
     if (isClipboard && currentSel) {
-        xcb_set_selection_owner(conn, g_pXWayland->m_wm->m_clipboard.window, HYPRATOMS["CLIPBOARD"], XCB_TIME_CURRENT_TIME);
+        xcb_set_selection_owner(conn, g_pXWayland->m_wm->m_clipboard.window, HYPRATOMS[ATOM_CLIPBOARD], XCB_TIME_CURRENT_TIME);
         xcb_flush(conn);
         g_pXWayland->m_wm->m_clipboard.notifyOnFocus = true;
     } else if (isPrimary && currentPrimSel) {
-        xcb_set_selection_owner(conn, g_pXWayland->m_wm->m_primarySelection.window, HYPRATOMS["PRIMARY"], XCB_TIME_CURRENT_TIME);
+        xcb_set_selection_owner(conn, g_pXWayland->m_wm->m_primarySelection.window, HYPRATOMS[ATOM_PRIMARY], XCB_TIME_CURRENT_TIME);
         xcb_flush(conn);
         g_pXWayland->m_wm->m_primarySelection.notifyOnFocus = true;
     }
@@ -1701,11 +1826,13 @@ SXTransfer::~SXTransfer() {
 }
 
 bool SXTransfer::getIncomingSelectionProp(bool erase) {
+    const auto                BEGIN = std::chrono::steady_clock::now();
     xcb_get_property_cookie_t cookie =
-        xcb_get_property(*g_pXWayland->m_wm->m_connection, erase, incomingWindow, HYPRATOMS["_WL_SELECTION"], XCB_GET_PROPERTY_TYPE_ANY, 0, 0x1fffffff);
+        xcb_get_property(*g_pXWayland->m_wm->m_connection, erase, incomingWindow, HYPRATOMS[ATOM_WL_SELECTION], XCB_GET_PROPERTY_TYPE_ANY, 0, 0x1fffffff);
 
     propertyStart = 0;
     propertyReply = xcb_get_property_reply(*g_pXWayland->m_wm->m_connection, cookie, nullptr);
+    g_pXWayland->m_wm->noteRoundTrip(BEGIN);
 
     if (!propertyReply) {
         Log::logger->log(Log::ERR, "[SXTransfer] couldn't get a prop reply");
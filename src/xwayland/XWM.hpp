@@ -11,8 +11,11 @@
 #include <xcb/composite.h>
 #include <xcb/xcb_errors.h>
 #include <hyprutils/os/FileDescriptor.hpp>
+#include <chrono>
 #include <cinttypes> // for PRIxPTR
 #include <cstdint>
+#include <deque>
+#include <unordered_map>
 
 struct wl_event_source;
 class CXWaylandSurfaceResource;
@@ -64,6 +67,24 @@ struct SXSelection {
     std::vector<UP<SXTransfer>> transfers;
 };
 
+// a GetProperty we sent but haven't read the reply of yet
+struct SXPendingProperty {
+    xcb_get_property_cookie_t cookie;
+    WP<CXWaylandSurface>      surf;
+    xcb_window_t              window     = 0;
+    xcb_atom_t                atom       = 0;
+    bool                      superseded = false; // a newer request for the same property is in flight
+};
+
+struct SXWMStats {
+    uint64_t roundTrips          = 0; // times we waited on the server
+    double   roundTripsPerSecond = 0;
+    double   blockedMs           = 0;
+    uint64_t pipelined           = 0; // replies handled as they came in, without waiting
+    uint64_t superseded          = 0;
+    size_t   inFlight            = 0;
+};
+
 class CXCBConnection {
   public:
     CXCBConnection(int fd) : m_connection{xcb_connect_to_fd(fd, nullptr)} {
@@ -119,6 +140,7 @@ class CXWM {
     SP<CX11DataDevice> getDataDevice();
     SP<IDataOffer>     createX11DataOffer(SP<CWLSurfaceResource> surf, SP<IDataSource> source);
     void               updateWorkArea(int x, int y, int w, int h);
+    SXWMStats          stats() const;
 
   private:
     void                 setCursor(unsigned char* pixData, uint32_t stride, const Vector2D& size, const Vector2D& hotspot);
@@ -145,6 +167,10 @@ class CXWM {
     SP<CXWaylandSurface> windowForWayland(SP<CWLSurfaceResource> surf);
 
     void                 readWindowData(SP<CXWaylandSurface> surf);
+    void                 requestProperty(SP<CXWaylandSurface> surf, xcb_atom_t atom);
+    bool                 dispatchPendingProperties(bool wait);
+    void                 onPropertyReply(const SXPendingProperty& pending, xcb_get_property_reply_t* reply);
+    void                 noteRoundTrip(std::chrono::steady_clock::time_point begin);
     void                 associate(SP<CXWaylandSurface> surf, SP<CWLSurfaceResource> wlSurf);
     void                 dissociate(SP<CXWaylandSurface> surf);
 
@@ -215,6 +241,14 @@ class CXWM {
     SP<CX11DataDevice>                        m_dndDataDevice = makeShared<CX11DataDevice>();
     std::vector<SP<CX11DataOffer>>            m_dndDataOffers;
 
+    std::deque<SXPendingProperty>             m_pendingProperties;
+    std::unordered_map<uint32_t, std::string> m_atomNames;
+    std::unordered_map<std::string, uint32_t> m_mimeAtoms;
+
+    SXWMStats                                 m_stats;
+    std::chrono::steady_clock::time_point     m_roundTripWindowStart = std::chrono::steady_clock::now();
+    uint64_t                                  m_roundTripsInWindow   = 0;
+
     inline xcb_connection_t*                  getConnection() {
         return m_connection ? *m_connection : nullptr;
     }
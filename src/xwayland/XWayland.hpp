@@ -6,6 +6,11 @@
 
 #include "XSurface.hpp"
 
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
 #ifndef NO_XWAYLAND
 #include "Server.hpp"
 #include "XWM.hpp"
@@ -30,102 +35,118 @@ class CXWayland {
     bool m_enabled = false;
 };
 
-inline UP<CXWayland>                             g_pXWayland;
+inline UP<CXWayland> g_pXWayland;
 
-inline std::unordered_map<std::string, uint32_t> HYPRATOMS = {
-#ifndef NO_XWAYLAND
-    HYPRATOM("_NET_SUPPORTED"),
-    HYPRATOM("_NET_SUPPORTING_WM_CHECK"),
-    HYPRATOM("_NET_WM_NAME"),
-    HYPRATOM("_NET_WM_VISIBLE_NAME"),
-    HYPRATOM("_NET_WM_MOVERESIZE"),
-    HYPRATOM("_NET_WM_STATE_STICKY"),
-    HYPRATOM("_NET_WM_STATE_FULLSCREEN"),
-    HYPRATOM("_NET_WM_STATE_DEMANDS_ATTENTION"),
-    HYPRATOM("_NET_WM_STATE_MODAL"),
-    HYPRATOM("_NET_WM_STATE_HIDDEN"),
-    HYPRATOM("_NET_WM_STATE_FOCUSED"),
-    HYPRATOM("_NET_WM_STATE"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_NORMAL"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_DOCK"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_DIALOG"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_UTILITY"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_TOOLBAR"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_SPLASH"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_MENU"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_DROPDOWN_MENU"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_POPUP_MENU"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_TOOLTIP"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_NOTIFICATION"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_COMBO"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_DND"),
-    HYPRATOM("_NET_WM_WINDOW_TYPE_DESKTOP"),
-    HYPRATOM("_NET_WM_STATE_MAXIMIZED_HORZ"),
-    HYPRATOM("_NET_WM_STATE_MAXIMIZED_VERT"),
-    HYPRATOM("_NET_WM_DESKTOP"),
-    HYPRATOM("_NET_WM_STRUT_PARTIAL"),
-    HYPRATOM("_NET_CLIENT_LIST"),
-    HYPRATOM("_NET_CLIENT_LIST_STACKING"),
-    HYPRATOM("_NET_CURRENT_DESKTOP"),
-    HYPRATOM("_NET_NUMBER_OF_DESKTOPS"),
-    HYPRATOM("_NET_DESKTOP_NAMES"),
-    HYPRATOM("_NET_DESKTOP_VIEWPORT"),
-    HYPRATOM("_NET_ACTIVE_WINDOW"),
-    HYPRATOM("_NET_CLOSE_WINDOW"),
-    HYPRATOM("_NET_MOVERESIZE_WINDOW"),
-    HYPRATOM("_NET_WM_USER_TIME"),
-    HYPRATOM("_NET_STARTUP_ID"),
-    HYPRATOM("_NET_WORKAREA"),
-    HYPRATOM("_NET_WM_ICON"),
-    HYPRATOM("_NET_WM_CM_S0"),
-    HYPRATOM("_NET_WM_PING"),
-    HYPRATOM("WM_PROTOCOLS"),
-    HYPRATOM("WM_HINTS"),
-    HYPRATOM("WM_DELETE_WINDOW"),
-    HYPRATOM("UTF8_STRING"),
-    HYPRATOM("WM_STATE"),
-    HYPRATOM("WM_CLIENT_LEADER"),
-    HYPRATOM("WM_TAKE_FOCUS"),
-    HYPRATOM("WM_NORMAL_HINTS"),
-    HYPRATOM("WM_SIZE_HINTS"),
-    HYPRATOM("WM_WINDOW_ROLE"),
-    HYPRATOM("_NET_REQUEST_FRAME_EXTENTS"),
-    HYPRATOM("_NET_FRAME_EXTENTS"),
-    HYPRATOM("_MOTIF_WM_HINTS"),
-    HYPRATOM("WM_CHANGE_STATE"),
-    HYPRATOM("_NET_SYSTEM_TRAY_OPCODE"),
-    HYPRATOM("_NET_SYSTEM_TRAY_COLORS"),
-    HYPRATOM("_NET_SYSTEM_TRAY_VISUAL"),
-    HYPRATOM("_NET_SYSTEM_TRAY_ORIENTATION"),
-    HYPRATOM("_XEMBED_INFO"),
-    HYPRATOM("MANAGER"),
-    HYPRATOM("XdndSelection"),
-    HYPRATOM("XdndAware"),
-    HYPRATOM("XdndStatus"),
-    HYPRATOM("XdndPosition"),
-    HYPRATOM("XdndEnter"),
-    HYPRATOM("XdndLeave"),
-    HYPRATOM("XdndDrop"),
-    HYPRATOM("XdndFinished"),
-    HYPRATOM("XdndProxy"),
-    HYPRATOM("XdndTypeList"),
-    HYPRATOM("XdndActionMove"),
-    HYPRATOM("XdndActionCopy"),
-    HYPRATOM("XdndActionAsk"),
-    HYPRATOM("XdndActionPrivate"),
-    HYPRATOM("CLIPBOARD"),
-    HYPRATOM("PRIMARY"),
-    HYPRATOM("_WL_SELECTION"),
-    HYPRATOM("CLIPBOARD_MANAGER"),
-    HYPRATOM("WINDOW"),
-    HYPRATOM("WM_S0"),
-    HYPRATOM("WL_SURFACE_ID"),
-    HYPRATOM("WL_SURFACE_SERIAL"),
-    HYPRATOM("TARGETS"),
-    HYPRATOM("TIMESTAMP"),
-    HYPRATOM("DELETE"),
-    HYPRATOM("TEXT"),
-    HYPRATOM("INCR"),
-#endif
+// atoms the XWM uses. Ids are the name in upper snake case, without leading underscores.
+// HYPRATOMS holds the server's value for each, interned once when CXWM starts.
+#define HYPRATOM_LIST(ATOM)                                                                                                                                                        \
+    ATOM(ATOM_NET_SUPPORTED, "_NET_SUPPORTED")                                                                                                                                     \
+    ATOM(ATOM_NET_SUPPORTING_WM_CHECK, "_NET_SUPPORTING_WM_CHECK")                                                                                                                 \
+    ATOM(ATOM_NET_WM_NAME, "_NET_WM_NAME")                                                                                                                                         \
+    ATOM(ATOM_NET_WM_VISIBLE_NAME, "_NET_WM_VISIBLE_NAME")                                                                                                                         \
+    ATOM(ATOM_NET_WM_MOVERESIZE, "_NET_WM_MOVERESIZE")                                                                                                                             \
+    ATOM(ATOM_NET_WM_STATE_STICKY, "_NET_WM_STATE_STICKY")                                                                                                                         \
+    ATOM(ATOM_NET_WM_STATE_FULLSCREEN, "_NET_WM_STATE_FULLSCREEN")                                                                                                                 \
+    ATOM(ATOM_NET_WM_STATE_DEMANDS_ATTENTION, "_NET_WM_STATE_DEMANDS_ATTENTION")                                                                                                   \
+    ATOM(ATOM_NET_WM_STATE_MODAL, "_NET_WM_STATE_MODAL")                                                                                                                           \
+    ATOM(ATOM_NET_WM_STATE_HIDDEN, "_NET_WM_STATE_HIDDEN")                                                                                                                         \
+    ATOM(ATOM_NET_WM_STATE_FOCUSED, "_NET_WM_STATE_FOCUSED")                                                                                                                       \
+    ATOM(ATOM_NET_WM_STATE, "_NET_WM_STATE")                                                                                                                                       \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE, "_NET_WM_WINDOW_TYPE")                                                                                                                           \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_NORMAL, "_NET_WM_WINDOW_TYPE_NORMAL")                                                                                                             \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_DOCK, "_NET_WM_WINDOW_TYPE_DOCK")                                                                                                                 \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_DIALOG, "_NET_WM_WINDOW_TYPE_DIALOG")                                                                                                             \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_UTILITY, "_NET_WM_WINDOW_TYPE_UTILITY")                                                                                                           \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_TOOLBAR, "_NET_WM_WINDOW_TYPE_TOOLBAR")                                                                                                           \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_SPLASH, "_NET_WM_WINDOW_TYPE_SPLASH")                                                                                                             \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_MENU, "_NET_WM_WINDOW_TYPE_MENU")                                                                                                                 \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_DROPDOWN_MENU, "_NET_WM_WINDOW_TYPE_DROPDOWN_MENU")                                                                                               \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_POPUP_MENU, "_NET_WM_WINDOW_TYPE_POPUP_MENU")                                                                                                     \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_TOOLTIP, "_NET_WM_WINDOW_TYPE_TOOLTIP")                                                                                                           \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_NOTIFICATION, "_NET_WM_WINDOW_TYPE_NOTIFICATION")                                                                                                 \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_COMBO, "_NET_WM_WINDOW_TYPE_COMBO")                                                                                                               \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_DND, "_NET_WM_WINDOW_TYPE_DND")                                                                                                                   \
+    ATOM(ATOM_NET_WM_WINDOW_TYPE_DESKTOP, "_NET_WM_WINDOW_TYPE_DESKTOP")                                                                                                           \
+    ATOM(ATOM_KDE_NET_WM_WINDOW_TYPE_OVERRIDE, "_KDE_NET_WM_WINDOW_TYPE_OVERRIDE")                                                                                                 \
+    ATOM(ATOM_NET_WM_STATE_MAXIMIZED_HORZ, "_NET_WM_STATE_MAXIMIZED_HORZ")                                                                                                         \
+    ATOM(ATOM_NET_WM_STATE_MAXIMIZED_VERT, "_NET_WM_STATE_MAXIMIZED_VERT")                                                                                                         \
+    ATOM(ATOM_NET_WM_DESKTOP, "_NET_WM_DESKTOP")                                                                                                                                   \
+    ATOM(ATOM_NET_WM_STRUT_PARTIAL, "_NET_WM_STRUT_PARTIAL")                                                                                                                       \
+    ATOM(ATOM_NET_CLIENT_LIST, "_NET_CLIENT_LIST")                                                                                                                                 \
+    ATOM(ATOM_NET_CLIENT_LIST_STACKING, "_NET_CLIENT_LIST_STACKING")                                                                                                               \
+    ATOM(ATOM_NET_CURRENT_DESKTOP, "_NET_CURRENT_DESKTOP")                                                                                                                         \
+    ATOM(ATOM_NET_NUMBER_OF_DESKTOPS, "_NET_NUMBER_OF_DESKTOPS")                                                                                                                   \
+    ATOM(ATOM_NET_DESKTOP_NAMES, "_NET_DESKTOP_NAMES")                                                                                                                             \
+    ATOM(ATOM_NET_DESKTOP_VIEWPORT, "_NET_DESKTOP_VIEWPORT")                                                                                                                       \
+    ATOM(ATOM_NET_ACTIVE_WINDOW, "_NET_ACTIVE_WINDOW")                                                                                                                             \
+    ATOM(ATOM_NET_CLOSE_WINDOW, "_NET_CLOSE_WINDOW")                                                                                                                               \
+    ATOM(ATOM_NET_MOVERESIZE_WINDOW, "_NET_MOVERESIZE_WINDOW")                                                                                                                     \
+    ATOM(ATOM_NET_WM_USER_TIME, "_NET_WM_USER_TIME")                                                                                                                               \
+    ATOM(ATOM_NET_STARTUP_ID, "_NET_STARTUP_ID")                                                                                                                                   \
+    ATOM(ATOM_NET_WORKAREA, "_NET_WORKAREA")                                                                                                                                       \
+    ATOM(ATOM_NET_WM_ICON, "_NET_WM_ICON")                                                                                                                                         \
+    ATOM(ATOM_NET_WM_CM_S0, "_NET_WM_CM_S0")                                                                                                                                       \
+    ATOM(ATOM_NET_WM_PING, "_NET_WM_PING")                                                                                                                                         \
+    ATOM(ATOM_WM_PROTOCOLS, "WM_PROTOCOLS")                                                                                                                                        \
+    ATOM(ATOM_WM_HINTS, "WM_HINTS")                                                                                                                                                \
+    ATOM(ATOM_WM_DELETE_WINDOW, "WM_DELETE_WINDOW")                                                                                                                                \
+    ATOM(ATOM_UTF8_STRING, "UTF8_STRING")                                                                                                                                          \
+    ATOM(ATOM_WM_STATE, "WM_STATE")                                                                                                                                                \
+    ATOM(ATOM_WM_CLIENT_LEADER, "WM_CLIENT_LEADER")                                                                                                                                \
+    ATOM(ATOM_WM_TAKE_FOCUS, "WM_TAKE_FOCUS")                                                                                                                                      \
+    ATOM(ATOM_WM_NORMAL_HINTS, "WM_NORMAL_HINTS")                                                                                                                                  \
+    ATOM(ATOM_WM_SIZE_HINTS, "WM_SIZE_HINTS")                                                                                                                                      \
+    ATOM(ATOM_WM_WINDOW_ROLE, "WM_WINDOW_ROLE")                                                                                                                                    \
+    ATOM(ATOM_NET_REQUEST_FRAME_EXTENTS, "_NET_REQUEST_FRAME_EXTENTS")                                                                                                             \
+    ATOM(ATOM_NET_FRAME_EXTENTS, "_NET_FRAME_EXTENTS")                                                                                                                             \
+    ATOM(ATOM_MOTIF_WM_HINTS, "_MOTIF_WM_HINTS")                                                                                                                                   \
+    ATOM(ATOM_WM_CHANGE_STATE, "WM_CHANGE_STATE")                                                                                                                                  \
+    ATOM(ATOM_NET_SYSTEM_TRAY_OPCODE, "_NET_SYSTEM_TRAY_OPCODE")                                                                                                                   \
+    ATOM(ATOM_NET_SYSTEM_TRAY_COLORS, "_NET_SYSTEM_TRAY_COLORS")                                                                                                                   \
+    ATOM(ATOM_NET_SYSTEM_TRAY_VISUAL, "_NET_SYSTEM_TRAY_VISUAL")                                                                                                                   \
+    ATOM(ATOM_NET_SYSTEM_TRAY_ORIENTATION, "_NET_SYSTEM_TRAY_ORIENTATION")                                                                                                         \
+    ATOM(ATOM_XEMBED_INFO, "_XEMBED_INFO")                                                                                                                                         \
+    ATOM(ATOM_MANAGER, "MANAGER")                                                                                                                                                  \
+    ATOM(ATOM_XDND_SELECTION, "XdndSelection")                                                                                                                                     \
+    ATOM(ATOM_XDND_AWARE, "XdndAware")                                                                                                                                             \
+    ATOM(ATOM_XDND_STATUS, "XdndStatus")                                                                                                                                           \
+    ATOM(ATOM_XDND_POSITION, "XdndPosition")                                                                                                                                       \
+    ATOM(ATOM_XDND_ENTER, "XdndEnter")                                                                                                                                             \
+    ATOM(ATOM_XDND_LEAVE, "XdndLeave")                                                                                                                                             \
+    ATOM(ATOM_XDND_DROP, "XdndDrop")                                                                                                                                               \
+    ATOM(ATOM_XDND_FINISHED, "XdndFinished")                                                                                                                                       \
+    ATOM(ATOM_XDND_PROXY, "XdndProxy")                                                                                                                                             \
+    ATOM(ATOM_XDND_TYPE_LIST, "XdndTypeList")                                                                                                                                      \
+    ATOM(ATOM_XDND_ACTION_MOVE, "XdndActionMove")                                                                                                                                  \
+    ATOM(ATOM_XDND_ACTION_COPY, "XdndActionCopy")                                                                                                                                  \
+    ATOM(ATOM_XDND_ACTION_ASK, "XdndActionAsk")                                                                                                                                    \
+    ATOM(ATOM_XDND_ACTION_PRIVATE, "XdndActionPrivate")                                                                                                                            \
+    ATOM(ATOM_CLIPBOARD, "CLIPBOARD")                                                                                                                                              \
+    ATOM(ATOM_PRIMARY, "PRIMARY")                                                                                                                                                  \
+    ATOM(ATOM_WL_SELECTION, "_WL_SELECTION")                                                                                                                                       \
+    ATOM(ATOM_CLIPBOARD_MANAGER, "CLIPBOARD_MANAGER")                                                                                                                              \
+    ATOM(ATOM_WINDOW, "WINDOW")                                                                                                                                                    \
+    ATOM(ATOM_WM_S0, "WM_S0")                                                                                                                                                      \
+    ATOM(ATOM_WL_SURFACE_ID, "WL_SURFACE_ID")                                                                                                                                      \
+    ATOM(ATOM_WL_SURFACE_SERIAL, "WL_SURFACE_SERIAL")                                                                                                                              \
+    ATOM(ATOM_TARGETS, "TARGETS")                                                                                                                                                  \
+    ATOM(ATOM_TIMESTAMP, "TIMESTAMP")                                                                                                                                              \
+    ATOM(ATOM_DELETE, "DELETE")                                                                                                                                                    \
+    ATOM(ATOM_TEXT, "TEXT")                                                                                                                                                        \
+    ATOM(ATOM_INCR, "INCR")
+
+enum eHyprAtom : uint8_t {
+#define HYPRATOM_ENUM(id, name) id,
+    HYPRATOM_LIST(HYPRATOM_ENUM)
+#undef HYPRATOM_ENUM
+    ATOM_COUNT,
 };
+
+inline constexpr std::array<std::string_view, ATOM_COUNT> HYPRATOM_NAMES = {
+#define HYPRATOM_NAME(id, name) name,
+    HYPRATOM_LIST(HYPRATOM_NAME)
+#undef HYPRATOM_NAME
+};
+
+inline std::array<uint32_t, ATOM_COUNT>         HYPRATOMS = {};
+inline std::unordered_map<uint32_t, eHyprAtom> HYPRATOMS_REVERSE; // value -> atom, for logging and mime lookups
@@ -177,3 +177,72 @@ TEST(ConfigLuaEventHandler, removeNonexistentCustomEventFails) {
 
     EXPECT_FALSE(handler.removeCustomEvent("plugin.nonexistent"));
 }
+
+TEST(ConfigLuaEventHandler, deferredEventsAreCoalescedUntilFlushed) {
+    CLuaState        S;
+    const auto       L = S.get();
+    CLuaEventHandler handler(L);
+
+    ASSERT_EQ(luaL_dostring(L, R"(
+        immediate = 0
+        deferred = 0
+        lastSubmap = ""
+        function onImmediate(name)
+            immediate = immediate + 1
+        end
+        function onDeferred(name)
+            deferred = deferred + 1
+            lastSubmap = name
+        end
+    )"),
+              LUA_OK);
+
+    const auto immediateHandle = handler.registerEvent("keybinds.submap", refGlobalFunction(L, "onImmediate"));
+    const auto deferredHandle  = handler.registerEvent("keybinds.submap", refGlobalFunction(L, "onDeferred"), true);
+    ASSERT_TRUE(immediateHandle.has_value());
+    ASSERT_TRUE(deferredHandle.has_value());
+
+    Event::bus()->m_events.keybinds.submap.emit("first");
+    Event::bus()->m_events.keybinds.submap.emit("second");
+    Event::bus()->m_events.keybinds.submap.emit("third");
+
+    EXPECT_EQ(getGlobalInt(L, "immediate"), 3);
+    EXPECT_EQ(getGlobalInt(L, "deferred"), 0);
+
+    // only the latest one is delivered
+    handler.flushDeferred();
+    EXPECT_EQ(getGlobalInt(L, "deferred"), 1);
+    EXPECT_STREQ(getGlobalString(L, "lastSubmap"), "third");
+
+    handler.flushDeferred();
+    EXPECT_EQ(getGlobalInt(L, "deferred"), 1);
+
+    const auto& subs = handler.subscriptions();
+    EXPECT_EQ(subs.at(*immediateHandle).calls, 3);
+    EXPECT_EQ(subs.at(*immediateHandle).coalesced, 0);
+    EXPECT_EQ(subs.at(*deferredHandle).calls, 1);
+    EXPECT_EQ(subs.at(*deferredHandle).coalesced, 2);
+}
+
+TEST(ConfigLuaEventHandler, unregisteringDropsPendingDeferredEvents) {
+    CLuaState        S;
+    const auto       L = S.get();
+    CLuaEventHandler handler(L);
+
+    ASSERT_EQ(luaL_dostring(L, R"(
+        count = 0
+        function onReload()
+            count = count + 1
+        end
+    )"),
+              LUA_OK);
+
+    const auto handle = handler.registerEvent("config.reloaded", refGlobalFunction(L, "onReload"), true);
+    ASSERT_TRUE(handle.has_value());
+
+    Event::bus()->m_events.config.reloaded.emit();
+    EXPECT_TRUE(handler.unregisterEvent(*handle));
+
+    handler.flushDeferred();
+    EXPECT_EQ(getGlobalInt(L, "count"), 0);
+}
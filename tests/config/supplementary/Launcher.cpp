@@ -0,0 +1,132 @@
+#include <config/supplementary/executor/Launcher.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <iostream>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace Config::Supplementary;
+
+namespace {
+    int exitStatus(pid_t pid) {
+        int status = 0;
+        if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status))
+            return -1;
+        return WEXITSTATUS(status);
+    }
+
+    int run(SLaunchRequest request, bool expectDirect) {
+        const auto RESULT = launchProcess(request);
+        EXPECT_TRUE(RESULT.has_value());
+        if (!RESULT)
+            return -1;
+
+        EXPECT_EQ(RESULT->direct, expectDirect);
+        return exitStatus(RESULT->pid);
+    }
+
+    // what CExecutor::spawnRawProc used to do
+    pid_t forkShell(const std::string& command) {
+        const pid_t CHILD = fork();
+        if (CHILD != 0)
+            return CHILD;
+
+        sigset_t set;
+        sigemptyset(&set);
+        sigprocmask(SIG_SETMASK, &set, nullptr);
+
+        execl("/bin/sh", "/bin/sh", "-c", command.c_str(), nullptr);
+        _exit(0);
+    }
+}
+
+TEST(Launcher, splitsPlainCommands) {
+    EXPECT_EQ(splitPlainCommand("kitty"), (std::vector<std::string>{"kitty"}));
+    EXPECT_EQ(splitPlainCommand("  firefox   --new-window\thttps://example.org/a=b "), (std::vector<std::string>{"firefox", "--new-window", "https://example.org/a=b"}));
+    EXPECT_EQ(splitPlainCommand("/usr/bin/foot -e htop"), (std::vector<std::string>{"/usr/bin/foot", "-e", "htop"}));
+}
+
+TEST(Launcher, leavesShellSyntaxToTheShell) {
+    for (const auto& cmd : {"", "   ", "a && b", "a; b", "a | b", "a > /tmp/x", "echo $HOME", "echo ~", "ls *.png", "echo 'quoted'", "echo \"quoted\"", "FOO=bar cmd",
+                            "echo `date`", "a &", "(a)", "echo a\\ b", "cmd # comment"}) {
+        EXPECT_FALSE(splitPlainCommand(cmd).has_value()) << cmd;
+    }
+}
+
+TEST(Launcher, runsCommands) {
+    EXPECT_EQ(run({.command = "true"}, true), 0);
+    EXPECT_EQ(run({.command = "false"}, true), 1);
+    EXPECT_EQ(run({.command = "false", .direct = false}, false), 1);
+    EXPECT_EQ(run({.command = "exit 7"}, false), 7);
+    // not on PATH, the shell gets to report it
+    EXPECT_EQ(run({.command = "hyprland-launcher-test-missing-binary"}, false), 127);
+}
+
+TEST(Launcher, passesEnvironment) {
+    setenv("HL_LAUNCHER_TEST_INHERITED", "yes", 1);
+
+    EXPECT_EQ(run({.command = R"(test "$HL_LAUNCHER_TEST_INHERITED" = yes)"}, false), 0);
+    EXPECT_EQ(run({.command = R"(test "$HL_LAUNCHER_TEST_INHERITED" = no)", .env = {{"HL_LAUNCHER_TEST_INHERITED", "no"}}}, false), 0);
+    EXPECT_EQ(run({.command = R"(test "$HL_LAUNCHER_TEST" = second)", .env = {{"HL_LAUNCHER_TEST", "first"}, {"HL_LAUNCHER_TEST", "second"}}}, false), 0);
+
+    unsetenv("HL_LAUNCHER_TEST_INHERITED");
+}
+
+TEST(Launcher, appliesNofile) {
+    rlimit current = {};
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &current), 0);
+
+    const rlimit LOWER = {.rlim_cur = std::min<rlim_t>(current.rlim_cur, 64), .rlim_max = current.rlim_max};
+    EXPECT_EQ(run({.command = std::format(R"#(test "$(ulimit -n)" = {})#", LOWER.rlim_cur), .nofile = LOWER}, false), 0);
+}
+
+TEST(Launcher, clearsSignalMask) {
+    sigset_t blocked, old;
+    sigemptyset(&blocked);
+    sigaddset(&blocked, SIGUSR1);
+    pthread_sigmask(SIG_BLOCK, &blocked, &old);
+
+    // SigBlk in /proc is a hex mask, all zeroes when nothing is blocked
+    EXPECT_EQ(run({.command = R"(grep -q '^SigBlk:[[:space:]]*0*$' /proc/self/status)"}, false), 0);
+
+    pthread_sigmask(SIG_SETMASK, &old, nullptr);
+}
+
+TEST(Launcher, DISABLED_spawnBenchmark) {
+    constexpr size_t LAUNCHES = 50;
+
+    // a compositor has a few hundred MB mapped, fork() has to copy the page tables of all of it
+    std::vector<uint8_t> ballast(256 * 1024 * 1024);
+    for (size_t i = 0; i < ballast.size(); i += 4096) {
+        ballast[i] = 1;
+    }
+
+    auto measure = [](auto&& spawn) {
+        std::chrono::steady_clock::duration spawning{}, total{};
+        for (size_t i = 0; i < LAUNCHES; ++i) {
+            const auto  BEGIN = std::chrono::steady_clock::now();
+            const pid_t PID   = spawn();
+            spawning += std::chrono::steady_clock::now() - BEGIN;
+
+            EXPECT_EQ(exitStatus(PID), 0);
+            total += std::chrono::steady_clock::now() - BEGIN;
+        }
+
+        return std::pair{std::chrono::duration<double, std::micro>(spawning).count() / LAUNCHES, std::chrono::duration<double, std::micro>(total).count() / LAUNCHES};
+    };
+
+    const auto FORKED = measure([] { return forkShell("true"); });
+    const auto SHELL  = measure([] { return launchProcess({.command = "true", .direct = false}).value_or(SLaunchResult{}).pid; });
+    const auto DIRECT = measure([] { return launchProcess({.command = "true"}).value_or(SLaunchResult{}).pid; });
+
+    std::cout << std::format("[ BENCH    ] fork + sh: {:.1f}us to return, {:.1f}us to exit\n", FORKED.first, FORKED.second);
+    std::cout << std::format("[ BENCH    ] vfork + sh: {:.1f}us to return, {:.1f}us to exit\n", SHELL.first, SHELL.second);
+    std::cout << std::format("[ BENCH    ] vfork, direct: {:.1f}us to return, {:.1f}us to exit\n", DIRECT.first, DIRECT.second);
+
+    EXPECT_EQ(ballast[0], 1);
+}
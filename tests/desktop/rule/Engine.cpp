@@ -0,0 +1,200 @@
+#include <desktop/rule/Engine.hpp>
+#include <desktop/rule/windowRule/WindowRule.hpp>
+#include <desktop/rule/layerRule/LayerRule.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <iostream>
+
+using namespace Desktop::Rule;
+
+namespace {
+    // every 10th rule matches on focus and every 7th carries rounding, the rest only match on class
+    void fillEngine(CRuleEngine& engine, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            auto rule = makeShared<CWindowRule>(std::format("rule-{}", i));
+            engine.registerRule(SP<IRule>(rule));
+
+            rule->registerMatch(RULE_PROP_CLASS, std::format("^(app-{})$", i));
+            if (i % 10 == 0)
+                rule->registerMatch(RULE_PROP_FOCUS, "true");
+            if (i % 7 == 0)
+                rule->addEffect(WINDOW_RULE_EFFECT_ROUNDING, "5");
+            else
+                rule->addEffect(WINDOW_RULE_EFFECT_OPACITY, "0.9");
+        }
+
+        engine.registerRule(SP<IRule>(makeShared<CLayerRule>("layer")));
+    }
+
+    // what CWindowRuleApplicator::propertiesChanged used to do
+    std::vector<SP<IRule>> fullScan(CRuleEngine& engine, std::underlying_type_t<eRuleProperty> props, const std::unordered_set<effectStorageType>& effects) {
+        std::vector<SP<IRule>> result;
+        for (const auto& r : engine.rules()) {
+            if (r->type() != RULE_TYPE_WINDOW)
+                continue;
+
+            const auto WR = reinterpretPointerCast<CWindowRule>(r);
+
+            if (!(WR->getPropertiesMask() & props) && !std::ranges::any_of(effects, [&WR](const auto& e) { return WR->effectsSet().contains(e); }))
+                continue;
+
+            result.emplace_back(r);
+        }
+        return result;
+    }
+}
+
+TEST(RuleEngine, candidatesMatchFullScan) {
+    CRuleEngine engine;
+    fillEngine(engine, 100);
+
+    EXPECT_EQ(engine.candidates(RULE_TYPE_WINDOW, RULE_PROP_FOCUS), fullScan(engine, RULE_PROP_FOCUS, {}));
+    EXPECT_EQ(engine.candidates(RULE_TYPE_WINDOW, RULE_PROP_FOCUS | RULE_PROP_CLASS), fullScan(engine, RULE_PROP_FOCUS | RULE_PROP_CLASS, {}));
+    EXPECT_EQ(engine.candidates(RULE_TYPE_WINDOW, RULE_PROP_FOCUS, {WINDOW_RULE_EFFECT_ROUNDING}), fullScan(engine, RULE_PROP_FOCUS, {WINDOW_RULE_EFFECT_ROUNDING}));
+    EXPECT_EQ(engine.candidates(RULE_TYPE_WINDOW, RULE_PROP_ALL), fullScan(engine, RULE_PROP_ALL, {}));
+    EXPECT_TRUE(engine.candidates(RULE_TYPE_WINDOW, RULE_PROP_PINNED).empty());
+    EXPECT_EQ(engine.candidates(RULE_TYPE_LAYER, RULE_PROP_ALL).size(), 1);
+}
+
+TEST(RuleEngine, indexFollowsMutations) {
+    CRuleEngine engine;
+    fillEngine(engine, 10);
+
+    EXPECT_EQ(engine.candidates(RULE_TYPE_WINDOW, RULE_PROP_FOCUS).size(), 1);
+
+    // matchers added after registration must be picked up
+    engine.rules()[1]->registerMatch(RULE_PROP_FOCUS, "false");
+    EXPECT_EQ(engine.candidates(RULE_TYPE_WINDOW, RULE_PROP_FOCUS).size(), 2);
+
+    engine.unregisterRule("rule-0");
+    EXPECT_EQ(engine.candidates(RULE_TYPE_WINDOW, RULE_PROP_FOCUS).size(), 1);
+    EXPECT_EQ(engine.candidates(RULE_TYPE_WINDOW, RULE_PROP_FOCUS).front()->name(), "rule-1");
+
+    engine.clearAllRules();
+    EXPECT_TRUE(engine.candidates(RULE_TYPE_WINDOW, RULE_PROP_ALL).empty());
+}
+
+TEST(RuleEngine, DISABLED_indexedLookupBenchmark) {
+    constexpr size_t ITERATIONS = 2000;
+
+    for (const size_t count : {10, 100, 1000}) {
+        CRuleEngine engine;
+        fillEngine(engine, count);
+
+        size_t     sink = 0;
+
+        const auto SCAN_BEGIN = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            sink += fullScan(engine, RULE_PROP_FOCUS, {}).size();
+        }
+        const auto SCAN_TIME = std::chrono::steady_clock::now() - SCAN_BEGIN;
+
+        const auto INDEX_BEGIN = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            sink -= engine.candidates(RULE_TYPE_WINDOW, RULE_PROP_FOCUS).size();
+        }
+        const auto INDEX_TIME = std::chrono::steady_clock::now() - INDEX_BEGIN;
+
+        EXPECT_EQ(sink, 0);
+
+        std::cout << std::format("[ BENCH    ] {} rules: full scan {:.2f}us, indexed {:.2f}us per lookup\n", count,
+                                 std::chrono::duration<double, std::micro>(SCAN_TIME).count() / ITERATIONS,
+                                 std::chrono::duration<double, std::micro>(INDEX_TIME).count() / ITERATIONS);
+    }
+}
+
+TEST(RuleEngine, contentHashIdentifiesRuleContent) {
+    const auto makeRule = [](const std::string& name, const std::string& cls, const std::string& rounding) {
+        auto rule = makeShared<CWindowRule>(name);
+        rule->registerMatch(RULE_PROP_CLASS, cls);
+        rule->addEffect(WINDOW_RULE_EFFECT_ROUNDING, rounding);
+        return rule;
+    };
+
+    // names don't change what a rule does
+    EXPECT_EQ(makeRule("a", "kitty", "5")->contentHash(), makeRule("b", "kitty", "5")->contentHash());
+    EXPECT_NE(makeRule("a", "kitty", "5")->contentHash(), makeRule("a", "foot", "5")->contentHash());
+    EXPECT_NE(makeRule("a", "kitty", "5")->contentHash(), makeRule("a", "kitty", "6")->contentHash());
+
+    auto disabled = makeRule("a", "kitty", "5");
+    disabled->setEnabled(false);
+    EXPECT_NE(disabled->contentHash(), makeRule("a", "kitty", "5")->contentHash());
+}
+
+namespace {
+    SP<CWindowRule> makeClassRule(const std::string& cls) {
+        auto rule = makeShared<CWindowRule>(cls);
+        rule->registerMatch(RULE_PROP_CLASS, cls);
+        rule->addEffect(WINDOW_RULE_EFFECT_ROUNDING, "5");
+        return rule;
+    }
+
+    SAppliedRule applied(const SP<IRule>& rule) {
+        return SAppliedRule{.content = rule->contentKey(), .rule = rule, .type = rule->type(), .props = rule->getPropertiesMask()};
+    }
+}
+
+TEST(RuleEngine, diffFindsAddedAndRemovedRules) {
+    const SP<IRule> A = makeClassRule("kitty"), B = makeClassRule("foot"), C = makeClassRule("alacritty");
+
+    const auto      UNCHANGED = diffRuleSets({applied(A), applied(B)}, {applied(A), applied(B)});
+    ASSERT_TRUE(UNCHANGED.has_value());
+    EXPECT_TRUE(UNCHANGED->rules.empty());
+
+    const auto ADDED = diffRuleSets({applied(A)}, {applied(A), applied(C)});
+    ASSERT_TRUE(ADDED.has_value());
+    EXPECT_EQ(ADDED->rules, std::vector<SP<IRule>>{C});
+    EXPECT_FALSE(ADDED->mutatedInPlace);
+
+    const auto REMOVED = diffRuleSets({applied(A), applied(B)}, {applied(B)});
+    ASSERT_TRUE(REMOVED.has_value());
+    EXPECT_EQ(REMOVED->rules, std::vector<SP<IRule>>{A});
+    EXPECT_FALSE(REMOVED->mutatedInPlace);
+
+    // rules are a multiset, dropping one of two identical rules is still a change
+    const SP<IRule> A2      = makeClassRule("kitty");
+    const auto      DROPPED = diffRuleSets({applied(A), applied(A2)}, {applied(A)});
+    ASSERT_TRUE(DROPPED.has_value());
+    EXPECT_EQ(DROPPED->rules.size(), 1);
+}
+
+TEST(RuleEngine, diffRejectsReorderedRules) {
+    const SP<IRule> A = makeClassRule("kitty"), B = makeClassRule("foot"), C = makeClassRule("alacritty");
+
+    EXPECT_FALSE(diffRuleSets({applied(A), applied(B)}, {applied(B), applied(A)}).has_value());
+    // an added rule doesn't hide that the kept ones swapped places
+    EXPECT_FALSE(diffRuleSets({applied(A), applied(B)}, {applied(B), applied(C), applied(A)}).has_value());
+}
+
+TEST(RuleEngine, diffFlagsRulesMutatedInPlace) {
+    const SP<IRule> A = makeClassRule("kitty");
+
+    const auto      BEFORE = std::vector<SAppliedRule>{applied(A)};
+    A->registerMatch(RULE_PROP_CLASS, "foot");
+
+    const auto DIFF = diffRuleSets(BEFORE, {applied(A)});
+    ASSERT_TRUE(DIFF.has_value());
+    EXPECT_TRUE(DIFF->mutatedInPlace);
+    EXPECT_EQ(DIFF->rules.size(), 2);
+}
+
+TEST(RuleEngine, diffReportsPropsOfExpiredRules) {
+    const SP<IRule> A    = makeClassRule("kitty");
+    SP<IRule>       gone = makeClassRule("foot");
+    gone->registerMatch(RULE_PROP_FOCUS, "true");
+
+    const auto BEFORE = std::vector<SAppliedRule>{applied(A), applied(gone)};
+    const auto PROPS  = gone->getPropertiesMask();
+    gone.reset();
+
+    const auto DIFF = diffRuleSets(BEFORE, {applied(A)});
+    ASSERT_TRUE(DIFF.has_value());
+    EXPECT_TRUE(DIFF->rules.empty());
+    EXPECT_FALSE(DIFF->mutatedInPlace);
+    EXPECT_EQ(DIFF->lostProps[RULE_TYPE_WINDOW], PROPS);
+    EXPECT_EQ(DIFF->lostProps[RULE_TYPE_LAYER], RULE_PROP_NONE);
+}
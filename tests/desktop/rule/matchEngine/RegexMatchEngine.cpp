@@ -67,3 +67,17 @@ TEST(RegexMatchEngine, alternation) {
     EXPECT_TRUE(engine.match("dog"));
     EXPECT_FALSE(engine.match("bird"));
 }
+
+TEST(RegexMatchEngine, repeatedValuesHitCache) {
+    CRegexMatchEngine engine("negative:firefox");
+    auto&             stats  = matchCacheStats(RULE_MATCH_ENGINE_REGEX);
+    const auto        HITS   = stats.hits;
+    const auto        MISSES = stats.misses;
+
+    EXPECT_FALSE(engine.match("firefox"));
+    EXPECT_FALSE(engine.match("firefox"));
+    EXPECT_TRUE(engine.match("kitty"));
+
+    EXPECT_EQ(stats.hits - HITS, 1);
+    EXPECT_EQ(stats.misses - MISSES, 2);
+}
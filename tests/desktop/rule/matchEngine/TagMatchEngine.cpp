@@ -66,3 +66,15 @@ TEST(TagMatchEngine, tagRemoval) {
     CTagMatchEngine engine("myTag");
     EXPECT_FALSE(engine.match(keeper));
 }
+
+TEST(TagMatchEngine, cacheFollowsTagChanges) {
+    CTagKeeper      keeper;
+    CTagMatchEngine engine("myTag");
+
+    EXPECT_FALSE(engine.match(keeper));
+    keeper.applyTag("myTag");
+    EXPECT_TRUE(engine.match(keeper));
+    EXPECT_TRUE(engine.match(keeper));
+    keeper.applyTag("-myTag");
+    EXPECT_FALSE(engine.match(keeper));
+}
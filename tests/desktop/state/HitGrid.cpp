@@ -0,0 +1,128 @@
+#include <desktop/state/HitGrid.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <optional>
+#include <random>
+
+using namespace Desktop;
+
+namespace {
+    // windows spread over three 2560x1440 monitors side by side
+    std::vector<CBox> randomWindows(size_t count) {
+        std::mt19937                           rng(1337);
+        std::uniform_real_distribution<double> x(0, 7680), y(0, 1440), w(100, 1600), h(100, 1000);
+
+        std::vector<CBox>                      boxes;
+        for (size_t i = 0; i < count; ++i) {
+            boxes.emplace_back(x(rng), y(rng), w(rng), h(rng));
+        }
+        return boxes;
+    }
+
+    // what windowAt used to do, topmost first
+    std::optional<uint32_t> scanTopmost(const std::vector<CBox>& boxes, const Vector2D& pos) {
+        for (size_t i = boxes.size(); i > 0; --i) {
+            if (boxes[i - 1].containsPoint(pos))
+                return i - 1;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<uint32_t> gridTopmost(const CHitGrid& grid, const std::vector<CBox>& boxes, const Vector2D& pos) {
+        const auto& CANDIDATES = grid.at(pos);
+        for (size_t i = CANDIDATES.size(); i > 0; --i) {
+            if (boxes[CANDIDATES[i - 1]].containsPoint(pos))
+                return CANDIDATES[i - 1];
+        }
+        return std::nullopt;
+    }
+}
+
+TEST(HitGrid, returnsOverlappingInOrder) {
+    CHitGrid grid(100);
+    grid.insert(0, {0, 0, 50, 50});
+    grid.insert(1, {-150, -150, 500, 500});
+    grid.insert(2, {1000, 1000, 10, 10});
+
+    EXPECT_EQ(grid.at({10, 10}), (std::vector<uint32_t>{0, 1}));
+    EXPECT_EQ(grid.at({-120, -120}), (std::vector<uint32_t>{1}));
+    EXPECT_EQ(grid.at({1005, 1005}), (std::vector<uint32_t>{2}));
+    EXPECT_TRUE(grid.at({5000, 5000}).empty());
+    EXPECT_EQ(grid.size(), 3);
+}
+
+TEST(HitGrid, unboundedEntriesAreMergedByZ) {
+    CHitGrid grid(100);
+    grid.insert(0, {0, 0, 50, 50});
+    grid.insertUnbounded(1);
+    grid.insert(2, {0, 0, 50, 50});
+    // way more cells than worth tracking, ends up unbounded as well
+    grid.insert(3, {-100000, -100000, 200000, 200000});
+
+    EXPECT_EQ(grid.at({10, 10}), (std::vector<uint32_t>{0, 1, 2, 3}));
+    EXPECT_EQ(grid.at({5000, 5000}), (std::vector<uint32_t>{1, 3}));
+
+    grid.clear();
+    EXPECT_TRUE(grid.at({10, 10}).empty());
+    EXPECT_EQ(grid.size(), 0);
+}
+
+TEST(HitGrid, matchesFullScan) {
+    const auto BOXES = randomWindows(500);
+
+    CHitGrid   grid;
+    for (uint32_t i = 0; i < BOXES.size(); ++i) {
+        grid.insert(i, BOXES[i]);
+    }
+
+    std::mt19937                           rng(42);
+    std::uniform_real_distribution<double> x(-100, 7800), y(-100, 1500);
+    for (size_t i = 0; i < 5000; ++i) {
+        const Vector2D POS = {x(rng), y(rng)};
+        EXPECT_EQ(gridTopmost(grid, BOXES, POS), scanTopmost(BOXES, POS));
+    }
+}
+
+TEST(HitGrid, DISABLED_lookupBenchmark) {
+    constexpr size_t QUERIES = 20000;
+
+    for (const size_t count : {10, 100, 1000}) {
+        const auto BOXES = randomWindows(count);
+
+        CHitGrid   grid;
+        for (uint32_t i = 0; i < BOXES.size(); ++i) {
+            grid.insert(i, BOXES[i]);
+        }
+
+        std::mt19937                           rng(42);
+        std::uniform_real_distribution<double> x(0, 7680), y(0, 1440);
+        std::vector<Vector2D>                  points;
+        for (size_t i = 0; i < QUERIES; ++i) {
+            points.emplace_back(x(rng), y(rng));
+        }
+
+        size_t     sink = 0;
+
+        const auto SCAN_BEGIN = std::chrono::steady_clock::now();
+        for (const auto& p : points) {
+            sink += scanTopmost(BOXES, p).value_or(0);
+        }
+        const auto SCAN_TIME = std::chrono::steady_clock::now() - SCAN_BEGIN;
+
+        const auto GRID_BEGIN = std::chrono::steady_clock::now();
+        for (const auto& p : points) {
+            sink -= gridTopmost(grid, BOXES, p).value_or(0);
+        }
+        const auto GRID_TIME = std::chrono::steady_clock::now() - GRID_BEGIN;
+
+        EXPECT_EQ(sink, 0);
+
+        std::cout << std::format("[ BENCH    ] {} windows: full scan {:.3f}us, grid {:.3f}us per lookup\n", count,
+                                 std::chrono::duration<double, std::micro>(SCAN_TIME).count() / QUERIES,
+                                 std::chrono::duration<double, std::micro>(GRID_TIME).count() / QUERIES);
+    }
+}
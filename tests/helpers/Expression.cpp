@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <format>
+
 using namespace Math;
 
 TEST(Helpers, expressionBasicArithmetic) {
@@ -76,3 +78,36 @@ TEST(Helpers, expressionVec2ParsesLegacyString) {
 
     EXPECT_FALSE(parseExpressionVec2("monitor_w*0.5").has_value());
 }
+
+TEST(Helpers, expressionCacheRebindsVariables) {
+    CExpressionCache cache({"w", "h"});
+    cache.setVariable(0, 1920);
+    cache.setVariable(1, 1080);
+    EXPECT_DOUBLE_EQ(cache.compute("w / 2").value(), 960.0);
+    EXPECT_DOUBLE_EQ(cache.compute("w - h").value(), 840.0);
+
+    // same expressions, new values, nothing gets parsed again
+    cache.setVariable(0, 1000);
+    cache.setVariable(1, 100);
+    EXPECT_DOUBLE_EQ(cache.compute("w / 2").value(), 500.0);
+    EXPECT_DOUBLE_EQ(cache.compute("w - h").value(), 900.0);
+    EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(Helpers, expressionCacheRemembersFailures) {
+    CExpressionCache cache({"x"});
+    EXPECT_EQ(cache.compute("x +"), std::nullopt);
+    EXPECT_EQ(cache.compute("y * 2"), std::nullopt);
+    EXPECT_EQ(cache.compute("x +"), std::nullopt);
+    EXPECT_EQ(cache.size(), 2);
+
+    EXPECT_DOUBLE_EQ(cache.compute("x + 1").value(), 1.0);
+}
+
+TEST(Helpers, expressionCacheIsBounded) {
+    CExpressionCache cache({"x"}, 4);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_DOUBLE_EQ(cache.compute(std::format("x + {}", i)).value(), i);
+        EXPECT_LE(cache.size(), 4);
+    }
+}
@@ -146,3 +146,24 @@ TEST(TagKeeper, getTagsReturnsAllStoredTags) {
     EXPECT_TRUE(tags.contains("b"));
     EXPECT_TRUE(tags.contains("c*"));
 }
+
+// --- generation ---
+
+TEST(TagKeeper, generationChangesOnlyOnMutation) {
+    CTagKeeper keeper;
+    EXPECT_EQ(keeper.generation(), 0u);
+
+    keeper.applyTag("+a");
+    const auto GEN = keeper.generation();
+    EXPECT_NE(GEN, 0u);
+
+    keeper.applyTag("+a");
+    EXPECT_EQ(keeper.generation(), GEN);
+
+    CTagKeeper other;
+    other.applyTag("+a");
+    EXPECT_NE(other.generation(), GEN);
+
+    keeper.clearTags();
+    EXPECT_NE(keeper.generation(), GEN);
+}
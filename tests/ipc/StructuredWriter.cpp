@@ -0,0 +1,92 @@
+#include <ipc/s1/StructuredWriter.hpp>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+
+using namespace IPC::Socket1;
+
+namespace {
+    void writeSample(IStructuredWriter& out) {
+        out.beginArray();
+        out.beginMap();
+        out.key("id");
+        out.integer(1);
+        out.key("name");
+        out.string("a\"b");
+        out.key("pos");
+        out.beginArray();
+        out.integer(-1);
+        out.integer(300);
+        out.endArray();
+        out.key("floating");
+        out.boolean(true);
+        out.key("mirror");
+        out.null();
+        out.endMap();
+        out.endArray();
+    }
+}
+
+TEST(StructuredWriter, json) {
+    CJSONWriter out;
+    writeSample(out);
+
+    EXPECT_EQ(out.take(), R"#([{"id":1,"name":"a\"b","pos":[-1,300],"floating":true,"mirror":null}])#");
+}
+
+TEST(StructuredWriter, jsonEscapesControlCharacters) {
+    CJSONWriter out;
+    out.string("\x01\n");
+
+    EXPECT_EQ(out.take(), R"#("\u0001\n")#");
+}
+
+TEST(StructuredWriter, jsonNonFiniteNumbersAreNull) {
+    CJSONWriter out;
+    out.beginArray();
+    out.number(1.5);
+    out.number(std::numeric_limits<double>::infinity());
+    out.number(std::numeric_limits<double>::quiet_NaN());
+    out.endArray();
+
+    EXPECT_EQ(out.take(), "[1.5,null,null]");
+}
+
+TEST(StructuredWriter, hex) {
+    CJSONWriter out;
+    out.beginArray();
+    out.hex(0xdeadbeef);
+    out.hex(0xdeadbeef, false);
+    out.endArray();
+
+    EXPECT_EQ(out.take(), R"#(["0xdeadbeef","deadbeef"])#");
+}
+
+TEST(StructuredWriter, msgpack) {
+    CMsgPackWriter out;
+    writeSample(out);
+
+    // containers are always 32-bit, with their counts patched in on close
+    const std::string EXPECTED = std::string{"\xdd\x00\x00\x00\x01"
+                                             "\xdf\x00\x00\x00\x05"
+                                             "\xa2id\x01"
+                                             "\xa4name\xa3"
+                                             "a\"b"
+                                             "\xa3pos\xdd\x00\x00\x00\x02\xff\xd2\x00\x00\x01\x2c"
+                                             "\xa8" "floating\xc3"
+                                             "\xa6mirror\xc0",
+                                             56};
+
+    EXPECT_EQ(out.take(), EXPECTED);
+}
+
+TEST(StructuredWriter, msgpackLongString) {
+    CMsgPackWriter out;
+    out.string(std::string(40, 'x'));
+
+    const auto DATA = out.take();
+    ASSERT_EQ(DATA.size(), 42);
+    EXPECT_EQ(static_cast<uint8_t>(DATA[0]), 0xd9);
+    EXPECT_EQ(static_cast<uint8_t>(DATA[1]), 40);
+}
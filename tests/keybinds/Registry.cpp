@@ -2,6 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <chrono>
+#include <format>
+#include <iostream>
+
 using namespace Keybinds;
 using namespace Input;
 
@@ -55,3 +60,113 @@ TEST(KeybindsRegistry, FindsShortcutWithSidedModifier) {
 
     EXPECT_EQ(registry.findShortcutConflict(XKB_KEY_k, HL_MODIFIER_SHIFT), BIND);
 }
+
+namespace {
+    struct SModCombo {
+        std::vector<std::string> names;
+        ModifierMask             mask;
+    };
+
+    const std::array<SModCombo, 4>   MOD_COMBOS = {SModCombo{{}, HL_MODIFIER_NONE}, SModCombo{{"SUPER"}, HL_MODIFIER_META},
+                                                   SModCombo{{"SUPER", "SHIFT"}, HL_MODIFIER_META | HL_MODIFIER_SHIFT}, SModCombo{{"ALT"}, HL_MODIFIER_ALT}};
+    const std::array<std::string, 3> SUBMAPS    = {"", "resize", "launch"};
+
+    // every letter under every modifier combo in every submap, plus a few binds the index has to special-case
+    void fillRegistry(CRegistry& registry) {
+        for (const auto& submap : SUBMAPS) {
+            for (const auto& mods : MOD_COMBOS) {
+                for (char c = 'a'; c <= 'z'; ++c) {
+                    auto keys = mods.names;
+                    keys.emplace_back(1, c);
+                    auto result = CBind::make(std::move(keys), sc<BindFlags>(0), [] { return SBindResult{}; }, {.metadata = {.submap = submap}});
+                    ASSERT_TRUE(result.has_value());
+                    registry.add(std::move(*result));
+                }
+            }
+        }
+
+        for (const auto flags : {BIND_FLAG_IGNORE_MODS, BIND_FLAG_SUBMAP_UNIVERSAL, BIND_FLAG_CATCH_ALL}) {
+            auto result = CBind::make({"SUPER", "K"}, flags, [] { return SBindResult{}; });
+            ASSERT_TRUE(result.has_value());
+            registry.add(std::move(*result));
+        }
+    }
+
+    std::vector<PBind> matching(std::span<const PBind> binds, const SBindEventContext& ctx) {
+        std::vector<PBind> result;
+        for (const auto& bind : binds) {
+            if (bind->hasFlag(BIND_FLAG_CATCH_ALL) ? bind->matchesContext(ctx) : bind->matches(ctx) != BIND_MATCH_NONE)
+                result.emplace_back(bind);
+        }
+        return result;
+    }
+
+    SResolvedKey letter(char c) {
+        const std::string NAME(1, c);
+        return {.sym = xkb_keysym_from_name(NAME.c_str(), XKB_KEYSYM_CASE_INSENSITIVE), .code = sc<xkb_keycode_t>(c)};
+    }
+}
+
+TEST(KeybindsRegistry, CandidatesMatchFullScan) {
+    CRegistry registry;
+    fillRegistry(registry);
+
+    for (const auto& submap : SUBMAPS) {
+        for (const auto& mods : MOD_COMBOS) {
+            for (const char c : {'a', 'k', 'z'}) {
+                const std::array        held = {letter(c)};
+                const SBindEventContext CTX  = {.heldKeys = held, .trigger = letter(c), .modifiersNow = mods.mask, .submap = submap};
+
+                EXPECT_EQ(matching(registry.candidates(CTX), CTX), matching(registry.binds(), CTX));
+                EXPECT_LT(registry.candidates(CTX).size(), registry.size());
+            }
+        }
+    }
+}
+
+TEST(KeybindsRegistry, IndexFollowsRemoval) {
+    CRegistry registry;
+    fillRegistry(registry);
+
+    const std::array        held = {letter('k')};
+    const SBindEventContext CTX  = {.heldKeys = held, .trigger = letter('k'), .modifiersNow = HL_MODIFIER_META};
+
+    const auto              BEFORE = matching(registry.candidates(CTX), CTX);
+    ASSERT_FALSE(BEFORE.empty());
+
+    EXPECT_TRUE(registry.remove(BEFORE.front()));
+    EXPECT_EQ(matching(registry.candidates(CTX), CTX).size(), BEFORE.size() - 1);
+
+    registry.clear();
+    EXPECT_TRUE(registry.candidates(CTX).empty());
+}
+
+TEST(KeybindsRegistry, DISABLED_IndexedLookupBenchmark) {
+    constexpr size_t ITERATIONS = 2000;
+
+    CRegistry        registry;
+    fillRegistry(registry);
+
+    const std::array        held = {letter('k')};
+    const SBindEventContext CTX  = {.heldKeys = held, .trigger = letter('k'), .modifiersNow = HL_MODIFIER_META, .submap = "resize"};
+
+    size_t                  sink = 0;
+
+    const auto              SCAN_BEGIN = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITERATIONS; ++i) {
+        sink += matching(registry.binds(), CTX).size();
+    }
+    const auto SCAN_TIME = std::chrono::steady_clock::now() - SCAN_BEGIN;
+
+    const auto INDEX_BEGIN = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITERATIONS; ++i) {
+        sink -= matching(registry.candidates(CTX), CTX).size();
+    }
+    const auto INDEX_TIME = std::chrono::steady_clock::now() - INDEX_BEGIN;
+
+    EXPECT_EQ(sink, 0);
+
+    std::cout << std::format("[ BENCH    ] {} binds: full scan {:.2f}us, indexed {:.2f}us per event\n", registry.size(),
+                             std::chrono::duration<double, std::micro>(SCAN_TIME).count() / ITERATIONS,
+                             std::chrono::duration<double, std::micro>(INDEX_TIME).count() / ITERATIONS);
+}
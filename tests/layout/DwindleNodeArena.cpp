@@ -0,0 +1,128 @@
+#include <layout/algorithm/tiled/dwindle/DwindleNodeArena.hpp>
+#include <layout/target/Target.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Layout;
+using namespace Layout::Tiled;
+
+namespace {
+    class CFakeTarget : public ITarget {
+      public:
+        virtual eTargetType type() override {
+            return TARGET_TYPE_WINDOW;
+        }
+        virtual PHLWINDOW window() const override {
+            return nullptr;
+        }
+        virtual bool floating() override {
+            return false;
+        }
+        virtual void setFloating(bool x) override {
+            ;
+        }
+        virtual std::expected<SGeometryRequested, eGeometryFailure> desiredGeometry() override {
+            return std::unexpected(GEOMETRY_NO_DESIRED);
+        }
+        virtual std::optional<Vector2D> minSize() override {
+            return std::nullopt;
+        }
+        virtual std::optional<Vector2D> maxSize() override {
+            return std::nullopt;
+        }
+        virtual void damageEntire() override {
+            ;
+        }
+        virtual void warpPositionSize() override {
+            ;
+        }
+        virtual void onUpdateSpace() override {
+            ;
+        }
+    };
+}
+
+TEST(DwindleNodeArena, reusesFreedSlots) {
+    CDwindleNodeArena arena;
+
+    const auto        A = arena.create();
+    const auto        B = arena.create();
+    const auto        C = arena.create();
+    EXPECT_EQ(arena.size(), 3);
+
+    arena.destroy(B);
+    EXPECT_EQ(arena.size(), 2);
+    EXPECT_FALSE(arena[B].valid);
+
+    // B's slot comes back, but as the newest node
+    const auto D = arena.create();
+    EXPECT_EQ(D, B);
+    EXPECT_TRUE(arena[D].valid);
+    EXPECT_GT(arena[D].seq, arena[C].seq);
+    EXPECT_EQ(arena.oldest(), A);
+
+    // destroying twice is harmless
+    arena.destroy(A);
+    arena.destroy(A);
+    EXPECT_EQ(arena.size(), 2);
+    EXPECT_EQ(arena.oldest(), C);
+}
+
+TEST(DwindleNodeArena, mapsTargetsToNodes) {
+    CDwindleNodeArena arena;
+    SP<ITarget>       first  = makeShared<CFakeTarget>();
+    SP<ITarget>       second = makeShared<CFakeTarget>();
+
+    const auto        A = arena.create();
+    const auto        B = arena.create();
+    arena.setTarget(A, first);
+    arena.setTarget(B, second);
+
+    EXPECT_EQ(arena.find(first), A);
+    EXPECT_EQ(arena.find(second), B);
+    EXPECT_EQ(arena.find(nullptr), DWINDLE_NONE);
+    EXPECT_EQ(arena.oldest(true), A);
+
+    // a swap, like swapTargets does it
+    arena.setTarget(A, second);
+    arena.setTarget(B, first);
+    EXPECT_EQ(arena.find(first), B);
+    EXPECT_EQ(arena.find(second), A);
+
+    arena.destroy(A);
+    EXPECT_EQ(arena.find(second), DWINDLE_NONE);
+    EXPECT_EQ(arena.find(first), B);
+    EXPECT_EQ(arena.oldest(true), B);
+}
+
+TEST(DwindleNodeArena, tracksRoot) {
+    CDwindleNodeArena arena;
+    EXPECT_EQ(arena.root(), DWINDLE_NONE);
+
+    const auto ROOT = arena.create();
+    arena.setRoot(ROOT);
+    EXPECT_EQ(arena.root(), ROOT);
+
+    arena.destroy(ROOT);
+    EXPECT_EQ(arena.root(), DWINDLE_NONE);
+}
+
+TEST(DwindleNodeArena, forEachSkipsFreeSlots) {
+    CDwindleNodeArena arena;
+    for (int i = 0; i < 30; ++i) {
+        arena.create();
+    }
+
+    for (DwindleNodeID id = 0; id < 30; id += 3) {
+        arena.destroy(id);
+    }
+
+    size_t visited = 0;
+    arena.forEach([&visited](DwindleNodeID id, SDwindleNodeData& node) {
+        EXPECT_NE(id % 3, 0);
+        EXPECT_TRUE(node.valid);
+        visited++;
+    });
+    EXPECT_EQ(visited, 20);
+    EXPECT_EQ(arena.size(), 20);
+}
@@ -0,0 +1,126 @@
+#include <managers/eventLoop/EventLoopTimer.hpp>
+#include <managers/eventLoop/EventLoopTimerHeap.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <iostream>
+
+using namespace std::chrono_literals;
+
+namespace {
+    SP<CEventLoopTimer> timer(std::optional<Time::steady_dur> timeout) {
+        return makeShared<CEventLoopTimer>(timeout, [](SP<CEventLoopTimer>, void*) {}, nullptr);
+    }
+
+    Time::steady_tp later() {
+        return Time::steadyNow() + 1h;
+    }
+}
+
+TEST(EventLoopTimerHeap, popsInDeadlineOrder) {
+    CEventLoopTimerHeap heap;
+    const auto          A        = timer(30ms);
+    const auto          B        = timer(10ms);
+    const auto          C        = timer(20ms);
+    const auto          DISARMED = timer(std::nullopt);
+
+    for (const auto& t : {A, B, C, DISARMED}) {
+        heap.push(t);
+    }
+    EXPECT_EQ(heap.size(), 3);
+    EXPECT_EQ(heap.next(), B->expires());
+
+    // nothing is due yet
+    EXPECT_TRUE(heap.popDue(Time::steadyNow()).empty());
+
+    const auto DUE = heap.popDue(later());
+    ASSERT_EQ(DUE.size(), 3);
+    EXPECT_EQ(DUE[0].timer, B);
+    EXPECT_EQ(DUE[1].timer, C);
+    EXPECT_EQ(DUE[2].timer, A);
+    EXPECT_EQ(heap.next(), std::nullopt);
+}
+
+TEST(EventLoopTimerHeap, skipsStaleEntries) {
+    CEventLoopTimerHeap heap;
+    const auto          CANCELLED   = timer(10ms);
+    const auto          RESCHEDULED = timer(20ms);
+    auto                dropped     = timer(5ms);
+
+    heap.push(CANCELLED);
+    heap.push(RESCHEDULED);
+    heap.push(dropped);
+
+    CANCELLED->cancel();
+    dropped.reset();
+
+    // the old entry stays behind, only the new deadline may come out
+    RESCHEDULED->updateTimeout(40ms);
+    heap.push(RESCHEDULED);
+
+    EXPECT_EQ(heap.next(), RESCHEDULED->expires());
+
+    const auto DUE = heap.popDue(later());
+    ASSERT_EQ(DUE.size(), 1);
+    EXPECT_EQ(DUE[0].timer, RESCHEDULED);
+    EXPECT_EQ(DUE[0].stamp, RESCHEDULED->stamp());
+}
+
+TEST(EventLoopTimerHeap, compactsStaleEntries) {
+    CEventLoopTimerHeap heap;
+    const auto          T = timer(10ms);
+
+    for (int i = 0; i < 100000; ++i) {
+        T->updateTimeout(std::chrono::milliseconds(i % 100));
+        heap.push(T);
+    }
+
+    EXPECT_LT(heap.size(), 4096);
+    EXPECT_EQ(heap.popDue(later()).size(), 1);
+}
+
+TEST(EventLoopTimerHeap, DISABLED_benchmark) {
+    constexpr size_t                 TIMERS = 10000;
+    constexpr size_t                 FIRES  = 20000;
+
+    std::vector<SP<CEventLoopTimer>> timers;
+    for (size_t i = 0; i < TIMERS; ++i) {
+        timers.emplace_back(timer(std::chrono::microseconds((i * 7919) % 100000)));
+    }
+
+    // what nudgeTimers used to do: scan all of them for the soonest, then fire it and rearm
+    const auto BEGIN = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < FIRES; ++i) {
+        const auto NEXT = std::ranges::min_element(timers, {}, [](const auto& t) { return t->leftUs(); });
+        (*NEXT)->updateTimeout(100ms);
+    }
+    const auto SCANNED = std::chrono::steady_clock::now();
+
+    CEventLoopTimerHeap heap;
+    for (const auto& t : timers) {
+        t->updateTimeout(std::chrono::microseconds(t->stamp() % 100000));
+        heap.push(t);
+    }
+
+    size_t     fired     = 0;
+    const auto HEAPBEGIN = std::chrono::steady_clock::now();
+    while (fired < FIRES) {
+        const auto NEXT = heap.next();
+        ASSERT_TRUE(NEXT.has_value());
+
+        for (const auto& [t, stamp] : heap.popDue(*NEXT)) {
+            t->updateTimeout(100ms);
+            heap.push(t);
+            fired++;
+        }
+    }
+    const auto HEAPED = std::chrono::steady_clock::now();
+
+    std::cout << std::format("[ BENCH    ] {} timers, linear scan: {:.2f}us per fire\n", TIMERS, std::chrono::duration<double, std::micro>(SCANNED - BEGIN).count() / FIRES);
+    std::cout << std::format("[ BENCH    ] {} timers, heap: {:.2f}us per fire\n", TIMERS, std::chrono::duration<double, std::micro>(HEAPED - HEAPBEGIN).count() / fired);
+
+    EXPECT_LT(heap.size(), TIMERS * 3);
+}
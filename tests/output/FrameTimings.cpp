@@ -0,0 +1,152 @@
+#include <output/FrameTimings.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Monitor;
+
+namespace {
+    // one frame that took renderMs to render and presentMs from render begin to presentation
+    void pushFrame(CFrameTimings& timings, Time::steady_tp& now, int renderMs, int presentMs) {
+        timings.mark(FRAME_STAGE_SCHEDULED, now);
+        timings.mark(FRAME_STAGE_RENDER_BEGIN, now);
+        timings.mark(FRAME_STAGE_RENDER_END, now + std::chrono::milliseconds(renderMs));
+        timings.onPresented(now + std::chrono::milliseconds(presentMs));
+        now += std::chrono::milliseconds(presentMs);
+    }
+}
+
+TEST(FrameTimings, emptyHasNoStats) {
+    CFrameTimings timings;
+    const auto    STATS = timings.stats(60.F);
+
+    EXPECT_EQ(STATS.frames, 0);
+    EXPECT_EQ(STATS.missed, 0);
+    EXPECT_FLOAT_EQ(STATS.render.p99, 0.F);
+}
+
+TEST(FrameTimings, percentilesAndMissed) {
+    CFrameTimings   timings;
+    Time::steady_tp now = Time::steadyNow();
+
+    for (int i = 0; i < 98; ++i) {
+        pushFrame(timings, now, 2, 16);
+    }
+
+    // two slow frames, 60Hz deadline is 25ms
+    pushFrame(timings, now, 30, 40);
+    pushFrame(timings, now, 30, 40);
+
+    const auto STATS = timings.stats(60.F);
+
+    EXPECT_EQ(STATS.frames, 100);
+    EXPECT_EQ(STATS.missed, 2);
+    EXPECT_FLOAT_EQ(STATS.render.p50, 2.F);
+    EXPECT_FLOAT_EQ(STATS.render.p95, 2.F);
+    EXPECT_FLOAT_EQ(STATS.render.p99, 30.F);
+    EXPECT_FLOAT_EQ(STATS.presentLatency.p50, 16.F);
+}
+
+TEST(FrameTimings, firstScheduleWins) {
+    CFrameTimings   timings;
+    Time::steady_tp now = Time::steadyNow();
+
+    timings.mark(FRAME_STAGE_SCHEDULED, now);
+    timings.mark(FRAME_STAGE_SCHEDULED, now + std::chrono::milliseconds(5));
+    timings.mark(FRAME_STAGE_RENDER_BEGIN, now + std::chrono::milliseconds(8));
+    timings.onPresented(now + std::chrono::milliseconds(10));
+
+    EXPECT_FLOAT_EQ(timings.stats(60.F).frameLatency.p50, 10.F);
+}
+
+TEST(FrameTimings, ringKeepsLastFrames) {
+    CFrameTimings   timings;
+    Time::steady_tp now = Time::steadyNow();
+
+    for (size_t i = 0; i < FRAME_TIMINGS_HISTORY; ++i) {
+        pushFrame(timings, now, 30, 40);
+    }
+
+    for (size_t i = 0; i < FRAME_TIMINGS_HISTORY; ++i) {
+        pushFrame(timings, now, 2, 16);
+    }
+
+    const auto STATS = timings.stats(60.F);
+
+    EXPECT_EQ(timings.size(), FRAME_TIMINGS_HISTORY);
+    EXPECT_EQ(STATS.missed, 0);
+    EXPECT_FLOAT_EQ(STATS.render.p99, 2.F);
+}
+
+TEST(FrameTimings, droppedFrameIsForgotten) {
+    CFrameTimings   timings;
+    Time::steady_tp now = Time::steadyNow();
+
+    // nothing to render, the frame never gets presented
+    timings.mark(FRAME_STAGE_SCHEDULED, now);
+    timings.mark(FRAME_STAGE_RENDER_BEGIN, now);
+    timings.onDropped();
+
+    timings.mark(FRAME_STAGE_SCHEDULED, now + std::chrono::milliseconds(100));
+    timings.mark(FRAME_STAGE_RENDER_BEGIN, now + std::chrono::milliseconds(102));
+    timings.mark(FRAME_STAGE_RENDER_END, now + std::chrono::milliseconds(104));
+    timings.onPresented(now + std::chrono::milliseconds(110));
+
+    const auto STATS = timings.stats(60.F);
+
+    EXPECT_EQ(STATS.frames, 1);
+    EXPECT_FLOAT_EQ(STATS.frameLatency.p50, 10.F);
+    EXPECT_FLOAT_EQ(STATS.presentLatency.p50, 8.F);
+}
+
+TEST(FrameTimings, scheduleDuringRenderStartsNextFrame) {
+    CFrameTimings   timings;
+    Time::steady_tp now = Time::steadyNow();
+
+    timings.mark(FRAME_STAGE_SCHEDULED, now);
+    timings.mark(FRAME_STAGE_RENDER_BEGIN, now + std::chrono::milliseconds(2));
+    timings.mark(FRAME_STAGE_SCHEDULED, now + std::chrono::milliseconds(4));
+    timings.onPresented(now + std::chrono::milliseconds(10));
+
+    EXPECT_FLOAT_EQ(timings.stats(60.F).frameLatency.p50, 10.F);
+
+    timings.mark(FRAME_STAGE_RENDER_BEGIN, now + std::chrono::milliseconds(16));
+    timings.onPresented(now + std::chrono::milliseconds(24));
+
+    const auto STATS = timings.stats(60.F);
+
+    EXPECT_EQ(STATS.frames, 2);
+    EXPECT_FLOAT_EQ(STATS.frameLatency.p99, 20.F);
+}
+
+TEST(FrameTimings, missedSyncRendersAheadOfPresentation) {
+    CFrameTimings   timings;
+    Time::steady_tp now = Time::steadyNow();
+
+    // the first frame is still waiting for its presentation when its sync fires late and the next one gets rendered
+    timings.mark(FRAME_STAGE_SCHEDULED, now);
+    timings.mark(FRAME_STAGE_RENDER_BEGIN, now + std::chrono::milliseconds(1));
+    timings.mark(FRAME_STAGE_RENDER_END, now + std::chrono::milliseconds(3));
+    timings.mark(FRAME_STAGE_SYNC_FIRED, now + std::chrono::milliseconds(20));
+    timings.mark(FRAME_STAGE_RENDER_BEGIN, now + std::chrono::milliseconds(20));
+    timings.mark(FRAME_STAGE_RENDER_END, now + std::chrono::milliseconds(24));
+
+    timings.onPresented(now + std::chrono::milliseconds(30));
+
+    auto STATS = timings.stats(60.F);
+
+    EXPECT_EQ(STATS.frames, 1);
+    EXPECT_EQ(STATS.missed, 1);
+    EXPECT_FLOAT_EQ(STATS.render.p50, 2.F);
+    EXPECT_FLOAT_EQ(STATS.gpu.p50, 17.F);
+    EXPECT_FLOAT_EQ(STATS.presentLatency.p50, 29.F);
+    EXPECT_FLOAT_EQ(STATS.frameLatency.p50, 30.F);
+
+    timings.onPresented(now + std::chrono::milliseconds(50));
+
+    STATS = timings.stats(60.F);
+
+    EXPECT_EQ(STATS.frames, 2);
+    EXPECT_EQ(STATS.missed, 2);
+    EXPECT_FLOAT_EQ(STATS.render.p99, 4.F);
+    EXPECT_FLOAT_EQ(STATS.presentLatency.p99, 30.F);
+}
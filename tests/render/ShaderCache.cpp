@@ -0,0 +1,113 @@
+#include <render/ShaderCache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <format>
+
+using namespace Render;
+
+namespace {
+    class CTempDir {
+      public:
+        CTempDir() {
+            const auto NOW = std::chrono::steady_clock::now().time_since_epoch().count();
+            m_path         = std::filesystem::temp_directory_path() / std::format("hyprland-shader-cache-{}", NOW);
+            std::filesystem::create_directories(m_path);
+        }
+
+        ~CTempDir() {
+            std::error_code ec;
+            std::filesystem::remove_all(m_path, ec);
+        }
+
+        std::string root() const {
+            return m_path.string() + "/";
+        }
+
+      private:
+        std::filesystem::path m_path;
+    };
+
+    const SShaderVariant VARIANT = {.features = 3, .sourceTF = SHADER_DEFAULT_TF, .targetTF = SHADER_DEFAULT_TF};
+}
+
+TEST(ShaderCache, hashIsStableAndSeeded) {
+    EXPECT_EQ(CShaderCache::hash("void main() {}"), CShaderCache::hash("void main() {}"));
+    EXPECT_NE(CShaderCache::hash("void main() {}"), CShaderCache::hash("void main() { }"));
+    EXPECT_NE(CShaderCache::hash("a", 1), CShaderCache::hash("a", 2));
+    // FNV-1a of the empty string is the offset basis
+    EXPECT_EQ(CShaderCache::hash(""), 0xcbf29ce484222325ULL);
+}
+
+TEST(ShaderCache, sourceRoundtripChecksInputHash) {
+    CTempDir     dir;
+    CShaderCache cache(dir.root(), "driver");
+
+    EXPECT_FALSE(cache.source(SH_FRAG_QUAD, VARIANT, 1).has_value());
+
+    cache.storeSource(SH_FRAG_QUAD, VARIANT, 1, "#version 300 es\nvoid main() {}\n");
+    EXPECT_EQ(cache.source(SH_FRAG_QUAD, VARIANT, 1), "#version 300 es\nvoid main() {}\n");
+
+    // edited shader file or include
+    EXPECT_FALSE(cache.source(SH_FRAG_QUAD, VARIANT, 2).has_value());
+
+    EXPECT_EQ(cache.stats().sourceHits, 1);
+    EXPECT_EQ(cache.stats().sourceMisses, 2);
+}
+
+TEST(ShaderCache, binaryRoundtripChecksSourceHash) {
+    CTempDir       dir;
+    CShaderCache   cache(dir.root(), "driver");
+
+    SProgramBinary binary = {.format = 0x8740, .data = {1, 2, 3, 4, 5}};
+    cache.storeBinary(SH_FRAG_QUAD, VARIANT, 42, binary);
+
+    const auto LOADED = cache.binary(SH_FRAG_QUAD, VARIANT, 42);
+    ASSERT_TRUE(LOADED.has_value());
+    EXPECT_EQ(LOADED->format, binary.format);
+    EXPECT_EQ(LOADED->data, binary.data);
+
+    EXPECT_FALSE(cache.binary(SH_FRAG_QUAD, VARIANT, 43).has_value());
+}
+
+TEST(ShaderCache, driversDontShareEntries) {
+    CTempDir     dir;
+    CShaderCache a(dir.root(), "mesa");
+    CShaderCache b(dir.root(), "nvidia");
+
+    a.storeSource(SH_FRAG_QUAD, VARIANT, 1, "src");
+
+    EXPECT_NE(a.directory(), b.directory());
+    EXPECT_FALSE(b.source(SH_FRAG_QUAD, VARIANT, 1).has_value());
+}
+
+TEST(ShaderCache, recordedVariantsPersist) {
+    CTempDir dir;
+
+    {
+        CShaderCache cache(dir.root(), "driver");
+        cache.record(SH_FRAG_QUAD, VARIANT);
+        cache.record(SH_FRAG_QUAD, VARIANT);
+        cache.record(SH_FRAG_SURFACE, VARIANT);
+        EXPECT_EQ(cache.recorded().size(), 2);
+    }
+
+    CShaderCache cache(dir.root(), "driver");
+    ASSERT_EQ(cache.recorded().size(), 2);
+    EXPECT_EQ(cache.recorded()[0].frag, SH_FRAG_QUAD);
+    EXPECT_EQ(cache.recorded()[1].frag, SH_FRAG_SURFACE);
+    EXPECT_EQ(cache.recorded()[1].variant, VARIANT);
+}
+
+TEST(ShaderCache, emptyRootStaysInMemory) {
+    CShaderCache cache("", "driver");
+
+    cache.storeSource(SH_FRAG_QUAD, VARIANT, 1, "src");
+    cache.record(SH_FRAG_QUAD, VARIANT);
+
+    EXPECT_TRUE(cache.directory().empty());
+    EXPECT_FALSE(cache.source(SH_FRAG_QUAD, VARIANT, 1).has_value());
+    EXPECT_EQ(cache.recorded().size(), 1);
+}
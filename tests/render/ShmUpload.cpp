@@ -0,0 +1,113 @@
+#include <render/ShmUpload.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Render;
+
+namespace {
+    double totalArea(const std::vector<CBox>& boxes) {
+        double area = 0;
+        for (const auto& b : boxes) {
+            area += b.w * b.h;
+        }
+        return area;
+    }
+
+    bool covers(const std::vector<CBox>& boxes, const CRegion& damage) {
+        CRegion covered;
+        for (const auto& b : boxes) {
+            covered.add(b);
+        }
+        return CRegion{damage}.subtract(covered).empty();
+    }
+}
+
+TEST(ShmUpload, noMergingKeepsRects) {
+    CRegion damage;
+    damage.add(CBox{0, 0, 10, 10});
+    damage.add(CBox{100, 100, 10, 10});
+
+    const auto RECTS = coalesceUploadRects(damage, 0);
+    EXPECT_EQ(RECTS.size(), 2);
+    EXPECT_TRUE(covers(RECTS, damage));
+}
+
+TEST(ShmUpload, mergesCloseRects) {
+    // a blinking cursor and a line of text next to it, 2px apart
+    CRegion damage;
+    damage.add(CBox{0, 0, 100, 20});
+    damage.add(CBox{102, 0, 2, 20});
+
+    const auto RECTS = coalesceUploadRects(damage, 0.3);
+    ASSERT_EQ(RECTS.size(), 1);
+    EXPECT_EQ(RECTS[0], (CBox{0, 0, 104, 20}));
+}
+
+TEST(ShmUpload, keepsFarApartRects) {
+    CRegion damage;
+    damage.add(CBox{0, 0, 10, 10});
+    damage.add(CBox{1000, 1000, 10, 10});
+
+    const auto RECTS = coalesceUploadRects(damage, 0.3);
+    EXPECT_EQ(RECTS.size(), 2);
+    EXPECT_TRUE(covers(RECTS, damage));
+}
+
+TEST(ShmUpload, wasteStaysBounded) {
+    // a sparse grid of small rects, like a terminal redrawing scattered cells
+    CRegion damage;
+    for (int y = 0; y < 40; ++y) {
+        for (int x = 0; x < 40; x += 3) {
+            damage.add(CBox{x * 10.0, y * 20.0, 8, 16});
+        }
+    }
+
+    double damaged = 0;
+    damage.forEachRect([&damaged](const auto& r) {
+        const double W = r.x2 - r.x1, H = r.y2 - r.y1;
+        damaged += W * H;
+    });
+
+    for (const double waste : {0.2, 0.3, 0.6}) {
+        const auto RECTS = coalesceUploadRects(damage, waste);
+        EXPECT_TRUE(covers(RECTS, damage));
+        EXPECT_LE(totalArea(RECTS) * (1.0 - waste), damaged + 1);
+
+        size_t count = 0;
+        damage.forEachRect([&count](const auto&) { count++; });
+        EXPECT_LT(RECTS.size(), count);
+    }
+}
+
+TEST(ShmUpload, uploadBytesFollowStride) {
+    const std::vector<CBox> RECTS = {{0, 0, 10, 10}, {20, 20, 5, 2}};
+    EXPECT_EQ(uploadBytes(RECTS, 400, 100), (100 + 10) * 4);
+    EXPECT_EQ(uploadBytes(RECTS, 400, 0), 0);
+}
+
+TEST(ShmUpload, statsAddUpPerClient) {
+    CShmUploadStats stats;
+    stats.record(10, {.uploads = 1, .damageRects = 4, .rects = 2, .bytes = 100, .ms = 0.5});
+    stats.record(10, {.uploads = 1, .offloaded = 1, .damageRects = 1, .rects = 1, .bytes = 50, .ms = 0.25});
+    stats.record(20, {.uploads = 1, .damageRects = 1, .rects = 1, .bytes = 10});
+
+    ASSERT_EQ(stats.clients().size(), 2);
+    const auto& FIRST = stats.clients().at(10);
+    EXPECT_EQ(FIRST.uploads, 2);
+    EXPECT_EQ(FIRST.offloaded, 1);
+    EXPECT_EQ(FIRST.damageRects, 5);
+    EXPECT_EQ(FIRST.rects, 3);
+    EXPECT_EQ(FIRST.bytes, 150);
+    EXPECT_DOUBLE_EQ(FIRST.ms, 0.75);
+
+    const auto TOTAL = stats.total();
+    EXPECT_EQ(TOTAL.uploads, 3);
+    EXPECT_EQ(TOTAL.bytes, 160);
+
+    stats.forget(10);
+    ASSERT_EQ(stats.clients().size(), 1);
+    EXPECT_TRUE(stats.clients().contains(20));
+
+    stats.reset();
+    EXPECT_TRUE(stats.clients().empty());
+}
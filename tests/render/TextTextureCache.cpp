@@ -0,0 +1,90 @@
+#include <render/TextTextureCache.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace Render;
+
+namespace {
+    class CFakeTexture : public ITexture {
+      public:
+        virtual void setTexParameter(GLenum pname, GLint param) override {
+            ;
+        }
+        virtual void allocate(const Vector2D& size, uint32_t drmFormat) override {
+            ;
+        }
+        virtual void update(uint32_t drmFormat, uint8_t* pixels, uint32_t stride, std::span<const CBox> rects) override {
+            ;
+        }
+    };
+
+    STextTextureKey key(const std::string& text) {
+        return STextTextureKey{.text = text, .font = "Sans", .size = 12, .color = CHyprColor{1.F, 1.F, 1.F, 1.F}, .maxWidth = 200};
+    }
+}
+
+TEST(TextTextureCache, keysCoverEveryInput) {
+    const auto          BASE = key("kitty");
+    STextTextureKeyHash hash;
+
+    EXPECT_EQ(BASE, key("kitty"));
+    EXPECT_EQ(hash(BASE), hash(key("kitty")));
+
+    auto other = BASE;
+    other.size = 24;
+    EXPECT_NE(BASE, other);
+
+    other        = BASE;
+    other.weight = 700;
+    EXPECT_NE(BASE, other);
+
+    other       = BASE;
+    other.color = CHyprColor{1.F, 0.F, 0.F, 1.F};
+    EXPECT_NE(BASE, other);
+
+    other          = BASE;
+    other.maxWidth = 400;
+    EXPECT_NE(BASE, other);
+
+    other      = BASE;
+    other.font = "Monospace";
+    EXPECT_NE(BASE, other);
+}
+
+TEST(TextTextureCache, evictsLeastRecentlyUsed) {
+    CTextTextureCache  cache(2);
+    const SP<ITexture> A = makeShared<CFakeTexture>();
+    const SP<ITexture> B = makeShared<CFakeTexture>();
+    const SP<ITexture> C = makeShared<CFakeTexture>();
+
+    cache.store(key("a"), A);
+    cache.store(key("b"), B);
+    EXPECT_EQ(cache.size(), 2);
+
+    // touching a makes b the oldest
+    cache.store(key("a"), A);
+    cache.store(key("c"), C);
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.peek(key("a")), A);
+    EXPECT_EQ(cache.peek(key("b")), nullptr);
+    EXPECT_EQ(cache.peek(key("c")), C);
+    EXPECT_EQ(cache.stats().evictions, 1);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.peek(key("a")), nullptr);
+}
+
+TEST(TextTextureCache, replacesStoredTexture) {
+    CTextTextureCache  cache;
+    const SP<ITexture> OLD = makeShared<CFakeTexture>();
+    const SP<ITexture> NEW = makeShared<CFakeTexture>();
+
+    cache.store(key("title"), OLD);
+    cache.store(key("title"), NEW);
+
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_EQ(cache.peek(key("title")), NEW);
+    EXPECT_EQ(cache.pending(), 0);
+}